@@ -1,8 +1,10 @@
 #include <cassert>
 #include <iostream>
+#include <string>
 
 #include "basic_player.h"
 #include "battle_info_impl.h"
+#include "UserCommon/row_access_satellite_view.h"
 
 using namespace UserCommon_318835816_211314471;
 
@@ -15,7 +17,9 @@ BasicPlayer::BasicPlayer(int playerIndex, size_t x, size_t y, size_t maxSteps, s
       m_maxSteps(maxSteps),
       m_numShells(numShells),
       // Cast to int as BattleInfoImpl constructor expects int parameters for board dimensions
-      m_battleInfo(static_cast<int>(x), static_cast<int>(y)) {}
+      m_battleInfo(static_cast<int>(x), static_cast<int>(y)) {
+    m_battleInfo.setInitialShells(static_cast<int>(numShells));
+}
 
 BasicPlayer::~BasicPlayer() = default;
 
@@ -36,9 +40,11 @@ void BasicPlayer::parseSatelliteViewToBattleInfo(BattleInfoImpl& battleInfo,
                                                  size_t boardWidth, 
                                                  size_t boardHeight) {
     battleInfo.softClear(); // clear only tanks and shells, board will be overriden.
+    std::string row(boardWidth, ' ');
     for (size_t y = 0; y < boardHeight; ++y) {
+        RowAccessSatelliteView::copyRow(satelliteView, y, boardWidth, row.data());
         for (size_t x = 0; x < boardWidth; ++x) {
-            char obj = satelliteView.getObjectAt(x, y);
+            char obj = row[x];
             GameBoard::CellType cellType = battleInfo.getCellType(x, y);
             switch (obj) {
                 case '#':
@@ -121,4 +121,9 @@ TEST_F(BasicPlayerTest, NoOwnTankPositionIfNotPresent) {
     EXPECT_EQ(info.getOwnTankPosition(), Point(0, 0));
 }
 
+TEST_F(BasicPlayerTest, PassesGameShellsToBattleInfo) {
+    // The fixture player was created with numShells = 5
+    EXPECT_EQ(getBattleInfo().getInitialShells(), 5);
+}
+
 } // namespace Algorithm_318835816_211314471
\ No newline at end of file
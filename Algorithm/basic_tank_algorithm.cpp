@@ -14,7 +14,7 @@ BasicTankAlgorithm::BasicTankAlgorithm(int playerId, int tankIndex)
     : m_playerId(playerId), m_tankIndex(tankIndex), m_gameBoard(5, 5) {
     m_trackedPosition = Point(0, 0);
     m_trackedDirection = getInitialDirection(playerId);
-    m_trackedShells = Tank::INITIAL_SHELLS;
+    m_trackedShells = Tank::DEFAULT_INITIAL_SHELLS;
     m_trackedCooldown = 0;
     m_turnsSinceLastUpdate = 4;
 }
@@ -54,11 +54,38 @@ ActionRequest BasicTankAlgorithm::getAction() {
 void BasicTankAlgorithm::updateBattleInfo(BattleInfo& info) {
     m_turnsSinceLastUpdate = 0;
     auto& impl = dynamic_cast<BattleInfoImpl&>(info);
+    if (!m_hasBattleInfo) {
+        // The shells of this game are first known here, the first action asks for battle info
+        m_trackedShells = impl.getInitialShells();
+        m_hasBattleInfo = true;
+    }
     m_trackedPosition = impl.getOwnTankPosition();
-    m_gameBoard = impl.getGameBoard();
+    m_gameBoard = impl.getSharedGameBoard();
     m_enemyTanks = impl.getEnemyTankPositions();
     m_friendlyTanks = impl.getFriendlyTankPositions();
     m_shells = impl.getShellPositions();
+    markBoardChanged();
+}
+
+void BasicTankAlgorithm::markBoardChanged() {
+    m_lineOfSightValid = false;
+    m_shellDangerValid = false;
+}
+
+const LineOfSightTable& BasicTankAlgorithm::getLineOfSightTable() const {
+    if (!m_lineOfSightValid) {
+        m_lineOfSightTable.build(*m_gameBoard, m_enemyTanks, m_friendlyTanks);
+        m_lineOfSightValid = true;
+    }
+    return m_lineOfSightTable;
+}
+
+const ShellDangerMap& BasicTankAlgorithm::getShellDangerMap() const {
+    if (!m_shellDangerValid) {
+        m_shellDangerMap.build(*m_gameBoard, m_shells, getLineOfSightTable());
+        m_shellDangerValid = true;
+    }
+    return m_shellDangerMap;
 }
 
 bool BasicTankAlgorithm::canShootEnemy() const {
@@ -82,68 +109,15 @@ std::optional<Direction> BasicTankAlgorithm::getLineOfSightDirection(const Point
 }
 
 bool BasicTankAlgorithm::checkLineOfSightInDirection(const Point& from, const Point& to, Direction direction) const {
-    if (from == to) {
-        return true;
-    }
-    Point current = from;
-    Point delta = getDirectionDelta(direction);
-    int maxSteps = m_gameBoard.getWidth() + m_gameBoard.getHeight();
-    int steps = 0;
-    while (steps < maxSteps) {
-        current = m_gameBoard.wrapPosition(current + delta);
-        steps++;
-        if (current == to) {
-            return true;
-        }
-        // Check for walls blocking line of sight
-        if (m_gameBoard.isWall(current)) {
-            return false;
-        }
-        // Check for tanks blocking line of sight
-        if (isTankAtPosition(current)) {
-            return false;
-        }
-    }
-    return false;
+    return getLineOfSightTable().hasLineOfSight(from, to, direction);
 }
 
 bool BasicTankAlgorithm::isTankAtPosition(const Point& position) const {
-    // Check enemy tanks
-    for (const auto& tankPos : m_enemyTanks) {
-        if (tankPos == position) {
-            return true;
-        }
-    }
-    
-    // Check friendly tanks
-    for (const auto& tankPos : m_friendlyTanks) {
-        if (tankPos == position) {
-            return true;
-        }
-    }
-    
-    return false;
+    return getLineOfSightTable().isTankAt(position);
 }
 
 bool BasicTankAlgorithm::isInDangerFromShells(const Point& position) const {
-    for (const Point& shellPos : m_shells) {
-        // Filter out shells that are too far away
-        if (GameBoard::stepDistance(shellPos, position, m_gameBoard.getWidth(), m_gameBoard.getHeight()) > 4) {
-            continue;
-        }
-
-        for (const Direction& dir : ALL_DIRECTIONS) {
-            if (!checkLineOfSightInDirection(shellPos, position, dir)) continue;
-            Point current = shellPos;
-            for (int step = 1; step < 4; ++step) {
-                current = m_gameBoard.wrapPosition(current + getDirectionDelta(dir));
-                if (current == position) {
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
+    return getShellDangerMap().isInDanger(position);
 }
 
 bool BasicTankAlgorithm::isInDangerFromShells() const {
@@ -152,19 +126,16 @@ bool BasicTankAlgorithm::isInDangerFromShells() const {
 
 bool BasicTankAlgorithm::isPositionSafe(const Point& position) const {
     // Check for wall
-    if (!m_gameBoard.canMoveTo(position)) {
+    if (!m_gameBoard->canMoveTo(position)) {
         return false;
     }
     // Check for mine
-    if (m_gameBoard.isMine(Point(position.getX(), position.getY()))) {
+    if (m_gameBoard->isMine(Point(position.getX(), position.getY()))) {
         return false;
     }
     // Check for tanks (enemy or friendly)
-    for (const auto& tankPos : m_enemyTanks) {
-        if (tankPos == position) return false;
-    }
-    for (const auto& tankPos : m_friendlyTanks) {
-        if (tankPos == position) return false;
+    if (isTankAtPosition(position)) {
+        return false;
     }
     // Check for shell danger at this position
     if (isInDangerFromShells(position)) {
@@ -176,7 +147,7 @@ bool BasicTankAlgorithm::isPositionSafe(const Point& position) const {
 std::vector<Point> BasicTankAlgorithm::getSafePositions() const {
     std::vector<Point> safePositions;
     for (const Direction& dir : ALL_DIRECTIONS) {
-        Point adj = m_gameBoard.wrapPosition(m_trackedPosition + getDirectionDelta(dir));
+        Point adj = m_gameBoard->wrapPosition(m_trackedPosition + getDirectionDelta(dir));
         if (isPositionSafe(adj)) {
             safePositions.push_back(adj);
         }
@@ -266,7 +237,7 @@ void BasicTankAlgorithm::updateState(ActionRequest lastAction) {
     switch (lastAction) {
         case ActionRequest::MoveForward: {
             Point delta = getDirectionDelta(m_trackedDirection);
-            m_trackedPosition = m_gameBoard.wrapPosition(m_trackedPosition + delta);
+            m_trackedPosition = m_gameBoard->wrapPosition(m_trackedPosition + delta);
             break;
         }
         case ActionRequest::RotateLeft90:
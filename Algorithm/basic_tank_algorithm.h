@@ -5,6 +5,9 @@
 #include <vector>
 
 #include "battle_info_impl.h"
+#include "line_of_sight_table.h"
+#include "shared_game_board.h"
+#include "shell_danger_map.h"
 #include "UserCommon/game_board.h"
 #include "UserCommon/objects/tank.h"
 #include "UserCommon/utils/point.h"
@@ -82,15 +85,37 @@ protected:
     // State tracking for position, direction, shells, and cooldown
     Point m_trackedPosition;
     Direction m_trackedDirection;
-    int m_trackedShells = Tank::INITIAL_SHELLS;
+    int m_trackedShells = Tank::DEFAULT_INITIAL_SHELLS;
+    bool m_hasBattleInfo = false;
     int m_trackedCooldown = 0;
 
-    // Known game state
-    GameBoard m_gameBoard;
+    // Known game state, the board is shared with the player's battle info
+    SharedGameBoard m_gameBoard;
     std::vector<Point> m_enemyTanks;
     std::vector<Point> m_friendlyTanks;
     std::vector<Point> m_shells;
 
+    /**
+     * @brief Drops the tables derived from the known board, tanks and shells.
+     *
+     * Called by updateBattleInfo, and by anything else that changes the
+     * known game state, so the tables are rebuilt on their next use.
+     * Derived algorithms with their own board-derived state extend it.
+     */
+    virtual void markBoardChanged();
+
+    /**
+     * @brief Gets the line-of-sight table of the known board and tanks.
+     * @return The table, rebuilt first if the board changed
+     */
+    const LineOfSightTable& getLineOfSightTable() const;
+
+    /**
+     * @brief Gets the shell danger map of the known board, tanks and shells.
+     * @return The map, rebuilt first if the board changed
+     */
+    const ShellDangerMap& getShellDangerMap() const;
+
     /**
      * @struct SafeMoveOption
      * @brief Represents a possible move to a safe position, with associated action and cost.
@@ -132,6 +157,7 @@ protected:
 
     /**
      * @brief Checks if the given position is in immediate danger from shells (distance < 3).
+     *        A lookup in the shell danger map.
      * @param position The position to check
      * @return true if in danger, false otherwise
      */
@@ -167,7 +193,8 @@ protected:
 
     /**
      * @brief Checks if there is a line of sight from 'from' to 'to' in the given direction.
-     *        Returns false if a wall blocks the path.
+     *        Returns false if a wall or tank blocks the path. Constant time,
+     *        see LineOfSightTable.
      * @param from The starting point
      * @param to The target point
      * @param direction The direction to check
@@ -196,6 +223,12 @@ protected:
      */
     static ActionRequest getRotationToDirection(Direction current, Direction target);
 
+private:
+    mutable LineOfSightTable m_lineOfSightTable;
+    mutable bool m_lineOfSightValid = false;
+    mutable ShellDangerMap m_shellDangerMap;
+    mutable bool m_shellDangerValid = false;
+
     friend class BasicTankAlgorithmTest;
 };
 
@@ -60,7 +60,7 @@ protected:
         return info;
     }
     // Helpers to access private members for testing
-    const GameBoard& getGameBoard() const { return algo->m_gameBoard; }
+    const GameBoard& getGameBoard() const { return *algo->m_gameBoard; }
     const std::vector<Point>& getEnemyTanks() const { return algo->m_enemyTanks; }
     const std::vector<Point>& getFriendlyTanks() const { return algo->m_friendlyTanks; }
     const std::vector<Point>& getShells() const { return algo->m_shells; }
@@ -681,6 +681,18 @@ TEST_F(BasicTankAlgorithmTest, UpdateState_Shoot) {
     EXPECT_EQ(getAlgoCooldown(), Tank::SHOOT_COOLDOWN);
 }
 
+TEST_F(BasicTankAlgorithmTest, UpdateBattleInfo_FirstUpdateSetsGameShells) {
+    BattleInfoImpl info = makeBattleInfo(board, {}, {}, {});
+    info.setInitialShells(5);
+    algo->updateBattleInfo(info);
+    EXPECT_EQ(getAlgoShells(), 5);
+
+    // Later updates keep the shells tracked since
+    callUpdateState(ActionRequest::Shoot);
+    algo->updateBattleInfo(info);
+    EXPECT_EQ(getAlgoShells(), 4);
+}
+
 TEST_F(BasicTankAlgorithmTest, UpdateState_DoNothing) {
     BattleInfoImpl info = makeBattleInfo(board, {}, {}, {});
     algo->updateBattleInfo(info);
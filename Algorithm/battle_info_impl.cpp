@@ -8,7 +8,7 @@ BattleInfoImpl::BattleInfoImpl(int boardWidth, int boardHeight)
     : m_boardWidth(boardWidth), m_boardHeight(boardHeight), m_gameBoard(boardWidth, boardHeight) {}
 
 void BattleInfoImpl::clear() {
-    m_gameBoard = GameBoard(m_boardWidth, m_boardHeight);
+    m_gameBoard = SharedGameBoard(m_boardWidth, m_boardHeight);
     m_enemyTankPositions.clear();
     m_friendlyTankPositions.clear();
     m_shellPositions.clear();
@@ -21,14 +21,21 @@ void BattleInfoImpl::softClear() {
 }
 
 void BattleInfoImpl::setCellType(int x, int y, GameBoard::CellType cellType) {
-    m_gameBoard.setCellType(x, y, cellType);
+    // Unchanged cells must not detach the board from the tanks sharing it
+    if (m_gameBoard->getCellType(x, y) != cellType) {
+        m_gameBoard.edit().setCellType(x, y, cellType);
+    }
 }
 
 GameBoard::CellType BattleInfoImpl::getCellType(int x, int y) const {
-    return m_gameBoard.getCellType(x, y);
+    return m_gameBoard->getCellType(x, y);
 }
 
 const GameBoard& BattleInfoImpl::getGameBoard() const {
+    return *m_gameBoard;
+}
+
+const SharedGameBoard& BattleInfoImpl::getSharedGameBoard() const {
     return m_gameBoard;
 }
 
@@ -64,4 +71,12 @@ const Point& BattleInfoImpl::getOwnTankPosition() const {
     return m_ownTankPosition;
 }
 
+void BattleInfoImpl::setInitialShells(int shells) {
+    m_initialShells = shells;
+}
+
+int BattleInfoImpl::getInitialShells() const {
+    return m_initialShells;
+}
+
 } // namespace Algorithm_318835816_211314471 
\ No newline at end of file
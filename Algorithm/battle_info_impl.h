@@ -2,7 +2,9 @@
 
 #include <vector>
 
+#include "shared_game_board.h"
 #include "UserCommon/game_board.h"
+#include "UserCommon/objects/tank.h"
 #include "UserCommon/utils/point.h"
 #include "common/BattleInfo.h"
 
@@ -26,6 +28,8 @@ public:
     void setCellType(int x, int y, GameBoard::CellType cellType);
     GameBoard::CellType getCellType(int x, int y) const;
     const GameBoard& getGameBoard() const;
+    // Shares the board with tanks instead of copying it, see SharedGameBoard
+    const SharedGameBoard& getSharedGameBoard() const;
     
     // Tank position management
     void addEnemyTankPosition(const Point& position);
@@ -39,15 +43,20 @@ public:
     
     void setOwnTankPosition(const Point& pos);
     const Point& getOwnTankPosition() const;
+
+    // Shells each tank starts the game with
+    void setInitialShells(int shells);
+    int getInitialShells() const;
     
 private:
     int m_boardWidth;
     int m_boardHeight;
-    GameBoard m_gameBoard;
+    SharedGameBoard m_gameBoard;
     std::vector<Point> m_enemyTankPositions;
     std::vector<Point> m_friendlyTankPositions;
     std::vector<Point> m_shellPositions;
     Point m_ownTankPosition;
+    int m_initialShells = Tank::DEFAULT_INITIAL_SHELLS;
 };
 
 } // namespace Algorithm_318835816_211314471
\ No newline at end of file
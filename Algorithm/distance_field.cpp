@@ -0,0 +1,77 @@
+#include "distance_field.h"
+
+namespace Algorithm_318835816_211314471 {
+
+void DistanceField::build(const GameBoard& board, const std::vector<Point>& sources) {
+    m_width = static_cast<int>(board.getWidth());
+    m_height = static_cast<int>(board.getHeight());
+    const size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+    m_distance.assign(cells, UNREACHABLE);
+    m_frontier.resize(cells);
+    if (cells == 0) return;
+
+    size_t head = 0;
+    size_t tail = 0;
+    for (const auto& source : sources) {
+        const int32_t cell = toCell(board.wrapPosition(source));
+        if (m_distance[cell] == UNREACHABLE) {
+            m_distance[cell] = 0;
+            m_frontier[tail++] = cell;
+        }
+    }
+
+    while (head != tail) {
+        const int32_t current = m_frontier[head++];
+        const int32_t nextDistance = m_distance[current] + 1;
+        const int x = current % m_width;
+        const int y = current / m_width;
+        for (int i = 0; i < DIRECTION_COUNT; ++i) {
+            int nx = x + DIRECTION_DELTA_X[i];
+            int ny = y + DIRECTION_DELTA_Y[i];
+            nx = nx < 0 ? nx + m_width : (nx >= m_width ? nx - m_width : nx);
+            ny = ny < 0 ? ny + m_height : (ny >= m_height ? ny - m_height : ny);
+            const int32_t neighbor = ny * m_width + nx;
+            if (m_distance[neighbor] != UNREACHABLE) {
+                continue;
+            }
+            GameBoard::CellType type = board.getCellTypeUnchecked(nx, ny);
+            if (type == GameBoard::CellType::Wall || type == GameBoard::CellType::Mine) {
+                continue;
+            }
+            m_distance[neighbor] = nextDistance;
+            m_frontier[tail++] = neighbor;
+        }
+    }
+}
+
+int32_t DistanceField::getDistance(const Point& position) const {
+    if (m_distance.empty()) return UNREACHABLE;
+    return m_distance[toCell(position)];
+}
+
+std::optional<Direction> DistanceField::getDownhillDirection(const Point& from, Direction preferred,
+                                                             const StepFilter& isStepAllowed) const {
+    const int32_t distance = getDistance(from);
+    if (distance == UNREACHABLE || distance == 0) return std::nullopt;
+
+    const int first = static_cast<int>(preferred);
+    for (int i = 0; i < DIRECTION_COUNT; ++i) {
+        const int index = (first + i) % DIRECTION_COUNT;
+        const Point neighbor(wrapAxis(from.getX() + DIRECTION_DELTA_X[index], m_width),
+                             wrapAxis(from.getY() + DIRECTION_DELTA_Y[index], m_height));
+        if (m_distance[toCell(neighbor)] != distance - 1) {
+            continue;
+        }
+        if (isStepAllowed && !isStepAllowed(neighbor)) {
+            continue;
+        }
+        return ALL_DIRECTIONS[index];
+    }
+    return std::nullopt;
+}
+
+int32_t DistanceField::toCell(const Point& position) const {
+    return wrapAxis(position.getY(), m_height) * m_width + wrapAxis(position.getX(), m_width);
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "UserCommon/game_board.h"
+#include "UserCommon/utils/direction.h"
+#include "UserCommon/utils/point.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class DistanceField
+ * @brief Step distance from every cell of a wrapping board to the nearest of several sources.
+ *
+ * Built with one breadth-first search started from all sources at once,
+ * moving in the 8 directions and avoiding walls and mines. A player builds
+ * one field from all enemy tanks and shares it with its tanks: a tank then
+ * closes in on the nearest enemy by stepping to any neighbour that is one
+ * step closer, without a search of its own.
+ */
+class DistanceField {
+public:
+    // Decides whether a tank may step onto a cell
+    using StepFilter = std::function<bool(const Point&)>;
+
+    // Distance of cells that cannot reach any source
+    static constexpr int32_t UNREACHABLE = -1;
+
+    /**
+     * @brief Computes the distances for a board and set of sources
+     * @param board The known game board
+     * @param sources The positions to measure the distance to
+     */
+    void build(const GameBoard& board, const std::vector<Point>& sources);
+
+    /**
+     * @brief Gets the distance from a position to the nearest source
+     * @param position The position, wrapped onto the board
+     * @return The number of steps, or UNREACHABLE
+     */
+    int32_t getDistance(const Point& position) const;
+
+    /**
+     * @brief Finds the direction of a neighbour one step closer to a source
+     *
+     * Neighbours are checked in ALL_DIRECTIONS order, starting from the
+     * preferred direction so a tank already facing a good step keeps going.
+     *
+     * @param from The position to step away from
+     * @param preferred The direction to try first
+     * @param isStepAllowed Extra check for the neighbour
+     * @return The direction of the step, or std::nullopt if none is allowed
+     *         or the position cannot reach a source
+     */
+    std::optional<Direction> getDownhillDirection(const Point& from, Direction preferred,
+                                                  const StepFilter& isStepAllowed) const;
+
+    size_t getWidth() const { return static_cast<size_t>(m_width); }
+    size_t getHeight() const { return static_cast<size_t>(m_height); }
+
+private:
+    int32_t toCell(const Point& position) const;
+
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<int32_t> m_distance;
+
+    // Every cell is queued at most once, so a plain array serves as the queue
+    std::vector<int32_t> m_frontier;
+};
+
+} // namespace Algorithm_318835816_211314471
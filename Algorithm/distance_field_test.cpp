@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "distance_field.h"
+#include "path_finder.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Algorithm_318835816_211314471 {
+
+namespace {
+
+GameBoard makeBoard(const std::vector<std::string>& lines) {
+    GameBoard board(lines[0].size(), lines.size());
+    std::vector<std::pair<int, Point>> tankPositions;
+    board.initialize(lines, tankPositions);
+    return board;
+}
+
+} // namespace
+
+TEST(DistanceFieldTest, MeasuresToNearestSource) {
+    GameBoard board = makeBoard({
+        "         ",
+        "         ",
+        "         "
+    });
+    DistanceField field;
+    field.build(board, {Point(0, 1), Point(6, 1)});
+
+    EXPECT_EQ(field.getDistance(Point(0, 1)), 0);
+    EXPECT_EQ(field.getDistance(Point(6, 1)), 0);
+    EXPECT_EQ(field.getDistance(Point(2, 1)), 2);
+    EXPECT_EQ(field.getDistance(Point(4, 0)), 2);
+    // Closer to (0,1) across the wrapped edge than to (6,1)
+    EXPECT_EQ(field.getDistance(Point(8, 1)), 1);
+}
+
+TEST(DistanceFieldTest, WallsAndMinesBlock) {
+    GameBoard board = makeBoard({
+        "  #  ",
+        "  #  ",
+        "  @  ",
+        "  #  ",
+        "  #  "
+    });
+    DistanceField field;
+    field.build(board, {Point(0, 0)});
+
+    EXPECT_EQ(field.getDistance(Point(2, 0)), DistanceField::UNREACHABLE);
+    EXPECT_EQ(field.getDistance(Point(2, 2)), DistanceField::UNREACHABLE);
+    // Only reachable around the wrapped edges
+    EXPECT_EQ(field.getDistance(Point(3, 0)), 2);
+    EXPECT_EQ(field.getDistance(Point(1, 2)), 2);
+}
+
+TEST(DistanceFieldTest, DownhillPrefersFacingDirectionAndRespectsFilter) {
+    GameBoard board = makeBoard({
+        "     ",
+        "     ",
+        "     ",
+        "     ",
+        "     "
+    });
+    DistanceField field;
+    field.build(board, {Point(2, 0)});
+
+    // Up and both upper diagonals from (2,2) lead to distance 1
+    EXPECT_EQ(field.getDownhillDirection(Point(2, 2), Direction::UpLeft, nullptr), Direction::UpLeft);
+    EXPECT_EQ(field.getDownhillDirection(Point(2, 2), Direction::Down, nullptr), Direction::UpLeft);
+    EXPECT_EQ(field.getDownhillDirection(Point(2, 2), Direction::Up,
+                                         [](const Point& p) { return p != Point(2, 1); }),
+              Direction::UpRight);
+    EXPECT_FALSE(field.getDownhillDirection(Point(2, 2), Direction::Up,
+                                            [](const Point&) { return false; }).has_value());
+    EXPECT_FALSE(field.getDownhillDirection(Point(2, 0), Direction::Up, nullptr).has_value());
+}
+
+TEST(DistanceFieldTest, DISABLED_Benchmark_TeamPlanning) {
+    const size_t size = 200;
+    const int tankCount = 16;
+    const int updates = 20;
+    std::vector<std::string> lines(size, std::string(size, ' '));
+    for (size_t y = 0; y < size; ++y) {
+        for (size_t x = 0; x < size; ++x) {
+            if ((x * 7 + y * 3) % 11 == 0) lines[y][x] = '#';
+        }
+    }
+    std::vector<Point> enemies = {Point(100, 3), Point(150, 170), Point(20, 120)};
+    std::vector<Point> tanks;
+    for (int i = 0; i < tankCount; ++i) {
+        tanks.emplace_back(i * 12 + 1, (i * 37 + 5) % static_cast<int>(size));
+    }
+    for (const auto& p : enemies) lines[p.getY()][p.getX()] = ' ';
+    for (const auto& p : tanks) lines[p.getY()][p.getX()] = ' ';
+    GameBoard board = makeBoard(lines);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    PathFinder finder;
+    size_t pathSteps = 0;
+    for (int update = 0; update < updates; ++update) {
+        for (const auto& tank : tanks) {
+            for (const auto& enemy : enemies) {
+                pathSteps += finder.findPath(board, tank, enemy, nullptr).empty() ? 0 : 1;
+            }
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    size_t fieldSteps = 0;
+    for (int update = 0; update < updates; ++update) {
+        DistanceField field;
+        field.build(board, enemies);
+        for (const auto& tank : tanks) {
+            fieldSteps += field.getDownhillDirection(tank, Direction::Up, nullptr).has_value() ? 1 : 0;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double perTankTime = std::chrono::duration<double>(middle - start).count();
+    double fieldTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("per_tank_ms", std::to_string(perTankTime * 1000));
+    RecordProperty("shared_field_ms", std::to_string(fieldTime * 1000));
+
+    EXPECT_EQ(fieldSteps, static_cast<size_t>(updates * tankCount));
+    EXPECT_GT(pathSteps, 0u);
+}
+
+} // namespace Algorithm_318835816_211314471
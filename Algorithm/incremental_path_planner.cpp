@@ -0,0 +1,306 @@
+#include "incremental_path_planner.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "UserCommon/utils/direction.h"
+
+namespace Algorithm_318835816_211314471 {
+
+void IncrementalPathPlanner::markBoardChanged() {
+    m_boardChanged = true;
+}
+
+void IncrementalPathPlanner::reset() {
+    m_initialized = false;
+}
+
+size_t IncrementalPathPlanner::getExpansionCount() const {
+    return m_expansions;
+}
+
+void IncrementalPathPlanner::neighborsOf(int32_t cell, int32_t (&neighbors)[8]) const {
+    const int x = cell % m_width;
+    const int y = cell / m_width;
+    for (int i = 0; i < 8; ++i) {
+        int nx = x + DIRECTION_DELTA_X[i];
+        int ny = y + DIRECTION_DELTA_Y[i];
+        nx = nx < 0 ? nx + m_width : (nx >= m_width ? nx - m_width : nx);
+        ny = ny < 0 ? ny + m_height : (ny >= m_height ? ny - m_height : ny);
+        neighbors[i] = ny * m_width + nx;
+    }
+}
+
+int IncrementalPathPlanner::heuristic(int32_t from, int32_t to) const {
+    int dx = std::abs(from % m_width - to % m_width);
+    int dy = std::abs(from / m_width - to / m_width);
+    return std::max(std::min(dx, m_width - dx), std::min(dy, m_height - dy));
+}
+
+IncrementalPathPlanner::Key IncrementalPathPlanner::calculateKey(int32_t cell) const {
+    int32_t distance = std::min(m_g[cell], m_rhs[cell]);
+    return {static_cast<int64_t>(distance) + heuristic(m_start, cell) + m_keyModifier, distance};
+}
+
+void IncrementalPathPlanner::refreshPassable(const GameBoard& board) {
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            GameBoard::CellType type = board.getCellTypeUnchecked(x, y);
+            uint8_t passable = type != GameBoard::CellType::Wall && type != GameBoard::CellType::Mine;
+            int32_t cell = y * m_width + x;
+            if (passable == m_passable[cell]) {
+                continue;
+            }
+            // Entering the cell changed cost, which only its neighbours see
+            m_passable[cell] = passable;
+            int32_t neighbors[8];
+            neighborsOf(cell, neighbors);
+            for (int32_t neighbor : neighbors) {
+                updateVertex(neighbor);
+            }
+        }
+    }
+}
+
+void IncrementalPathPlanner::initialize(const GameBoard& board, int32_t start, int32_t goal) {
+    m_width = static_cast<int>(board.getWidth());
+    m_height = static_cast<int>(board.getHeight());
+    const size_t cells = static_cast<size_t>(m_width) * static_cast<size_t>(m_height);
+    m_passable.assign(cells, 0);
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            GameBoard::CellType type = board.getCellTypeUnchecked(x, y);
+            m_passable[y * m_width + x] = type != GameBoard::CellType::Wall && type != GameBoard::CellType::Mine;
+        }
+    }
+    m_g.assign(cells, INF);
+    m_rhs.assign(cells, INF);
+    m_heap.clear();
+    m_heapKeys.clear();
+    m_heapPosition.assign(cells, -1);
+
+    m_start = start;
+    m_goal = goal;
+    m_keyModifier = 0;
+    m_rhs[goal] = 0;
+    heapPush(goal, calculateKey(goal));
+    m_initialized = true;
+}
+
+int32_t IncrementalPathPlanner::lookahead(int32_t cell) const {
+    if (cell == m_goal) {
+        return 0;
+    }
+    int32_t best = INF;
+    int32_t neighbors[8];
+    neighborsOf(cell, neighbors);
+    for (int32_t neighbor : neighbors) {
+        if (m_passable[neighbor] && m_g[neighbor] < INF) {
+            best = std::min(best, m_g[neighbor] + 1);
+        }
+    }
+    return best;
+}
+
+void IncrementalPathPlanner::updateQueue(int32_t cell) {
+    const bool queued = m_heapPosition[cell] >= 0;
+    if (m_g[cell] != m_rhs[cell]) {
+        if (queued) {
+            heapUpdate(cell, calculateKey(cell));
+        } else {
+            heapPush(cell, calculateKey(cell));
+        }
+    } else if (queued) {
+        heapRemove(cell);
+    }
+}
+
+void IncrementalPathPlanner::updateVertex(int32_t cell) {
+    m_rhs[cell] = lookahead(cell);
+    updateQueue(cell);
+}
+
+void IncrementalPathPlanner::computeShortestPath() {
+    while (!m_heap.empty() &&
+           (m_heapKeys[0] < calculateKey(m_start) || m_rhs[m_start] != m_g[m_start])) {
+        int32_t cell = m_heap[0];
+        Key oldKey = m_heapKeys[0];
+        Key newKey = calculateKey(cell);
+        m_expansions++;
+
+        if (oldKey < newKey) {
+            // Queued before the tank moved, requeue with the current key
+            heapUpdate(cell, newKey);
+            continue;
+        }
+
+        int32_t neighbors[8];
+        neighborsOf(cell, neighbors);
+        if (m_g[cell] > m_rhs[cell]) {
+            // Distance dropped, it can only lower the neighbours' lookahead
+            m_g[cell] = m_rhs[cell];
+            heapRemove(cell);
+            if (m_passable[cell]) {
+                for (int32_t neighbor : neighbors) {
+                    if (neighbor != m_goal && m_g[cell] + 1 < m_rhs[neighbor]) {
+                        m_rhs[neighbor] = m_g[cell] + 1;
+                        updateQueue(neighbor);
+                    }
+                }
+            }
+        } else {
+            // Distance grew, neighbours that relied on it look again
+            int32_t oldDistance = m_g[cell];
+            m_g[cell] = INF;
+            updateVertex(cell);
+            if (m_passable[cell]) {
+                for (int32_t neighbor : neighbors) {
+                    if (m_rhs[neighbor] == oldDistance + 1) {
+                        updateVertex(neighbor);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool IncrementalPathPlanner::tracePath(const PathFinder::StepFilter& isFirstStepAllowed,
+                                       std::vector<Point>& path) const {
+    // The start distance is exact, so a route losing one step of distance
+    // per move is a shortest path. Anything else is left to the caller.
+    path.clear();
+    int32_t current = m_start;
+    while (current != m_goal) {
+        int32_t next = -1;
+        int32_t neighbors[8];
+        neighborsOf(current, neighbors);
+        for (int32_t neighbor : neighbors) {
+            if (!m_passable[neighbor] || m_g[neighbor] >= INF) {
+                continue;
+            }
+            if (current == m_start && isFirstStepAllowed &&
+                !isFirstStepAllowed(Point(neighbor % m_width, neighbor / m_width))) {
+                continue;
+            }
+            if (next < 0 || m_g[neighbor] < m_g[next]) {
+                next = neighbor;
+            }
+        }
+        if (next < 0 || m_g[next] != m_g[current] - 1) {
+            return false;
+        }
+        path.emplace_back(next % m_width, next / m_width);
+        current = next;
+    }
+    return true;
+}
+
+std::vector<Point> IncrementalPathPlanner::findPath(const GameBoard& board, const Point& start, const Point& target,
+                                                    const PathFinder::StepFilter& isFirstStepAllowed) {
+    if (start == target) return {};
+
+    int width = static_cast<int>(board.getWidth());
+    int height = static_cast<int>(board.getHeight());
+    if (width == 0 || height == 0) return {};
+
+    Point wrappedStart = board.wrapPosition(start);
+    Point wrappedTarget = board.wrapPosition(target);
+    const int32_t startCell = wrappedStart.getY() * width + wrappedStart.getX();
+    const int32_t goalCell = wrappedTarget.getY() * width + wrappedTarget.getX();
+
+    if (!m_initialized || width != m_width || height != m_height) {
+        initialize(board, startCell, goalCell);
+    } else {
+        if (startCell != m_start) {
+            m_keyModifier += heuristic(m_start, startCell);
+            m_start = startCell;
+        }
+        if (m_boardChanged) {
+            refreshPassable(board);
+        }
+        if (goalCell != m_goal) {
+            int32_t oldGoal = m_goal;
+            m_goal = goalCell;
+            updateVertex(oldGoal);
+            updateVertex(goalCell);
+        }
+    }
+
+    m_boardChanged = false;
+    computeShortestPath();
+
+    if (m_g[m_start] >= INF) {
+        return {};
+    }
+    std::vector<Point> path;
+    if (!tracePath(isFirstStepAllowed, path)) {
+        // Every shortest first step is filtered out, search around it
+        return m_fallback.findPath(board, start, target, isFirstStepAllowed);
+    }
+    return path;
+}
+
+void IncrementalPathPlanner::heapPush(int32_t cell, const Key& key) {
+    m_heap.push_back(cell);
+    m_heapKeys.push_back(key);
+    m_heapPosition[cell] = static_cast<int32_t>(m_heap.size() - 1);
+    heapSiftUp(m_heap.size() - 1);
+}
+
+void IncrementalPathPlanner::heapUpdate(int32_t cell, const Key& key) {
+    size_t position = static_cast<size_t>(m_heapPosition[cell]);
+    m_heapKeys[position] = key;
+    heapSiftUp(position);
+    heapSiftDown(static_cast<size_t>(m_heapPosition[cell]));
+}
+
+void IncrementalPathPlanner::heapRemove(int32_t cell) {
+    size_t position = static_cast<size_t>(m_heapPosition[cell]);
+    size_t last = m_heap.size() - 1;
+    if (position != last) {
+        heapSwap(position, last);
+    }
+    m_heap.pop_back();
+    m_heapKeys.pop_back();
+    m_heapPosition[cell] = -1;
+    if (position < m_heap.size()) {
+        heapSiftUp(position);
+        heapSiftDown(position);
+    }
+}
+
+void IncrementalPathPlanner::heapSiftUp(size_t position) {
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (!(m_heapKeys[position] < m_heapKeys[parent])) {
+            break;
+        }
+        heapSwap(position, parent);
+        position = parent;
+    }
+}
+
+void IncrementalPathPlanner::heapSiftDown(size_t position) {
+    const size_t size = m_heap.size();
+    while (true) {
+        size_t smallest = position;
+        size_t left = 2 * position + 1;
+        size_t right = left + 1;
+        if (left < size && m_heapKeys[left] < m_heapKeys[smallest]) smallest = left;
+        if (right < size && m_heapKeys[right] < m_heapKeys[smallest]) smallest = right;
+        if (smallest == position) {
+            break;
+        }
+        heapSwap(position, smallest);
+        position = smallest;
+    }
+}
+
+void IncrementalPathPlanner::heapSwap(size_t a, size_t b) {
+    std::swap(m_heap[a], m_heap[b]);
+    std::swap(m_heapKeys[a], m_heapKeys[b]);
+    m_heapPosition[m_heap[a]] = static_cast<int32_t>(a);
+    m_heapPosition[m_heap[b]] = static_cast<int32_t>(b);
+}
+
+} // namespace Algorithm_318835816_211314471
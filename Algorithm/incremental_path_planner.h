@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "path_finder.h"
+#include "UserCommon/game_board.h"
+#include "UserCommon/utils/point.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class IncrementalPathPlanner
+ * @brief Keeps a shortest path to a moving target up to date with D* Lite.
+ *
+ * The search runs backwards from the target, so each cell holds its distance
+ * to the target (g) and a one-step lookahead of it (rhs). Between calls the
+ * planner keeps both fields and its priority queue, and only repairs what
+ * changed:
+ *   - the tank moving is absorbed by the key modifier, as in D* Lite
+ *   - cells that become passable or blocked update their neighbours, the
+ *     board is only compared after markBoardChanged
+ *   - the target moving is treated as moving the zero-cost edge from a
+ *     virtual source, updating the old and new target cells
+ * The queue is ordered by distance plus the wrapping step distance to the
+ * tank, so only cells that can matter to the tank's path are expanded.
+ *
+ * Paths have the same length as a breadth-first search with the same rules:
+ * walls and mines cannot be entered and the first step must pass a filter.
+ * When the filter rejects every first step of a shortest path, the planner
+ * falls back to a full PathFinder search for that call.
+ */
+class IncrementalPathPlanner {
+public:
+    /**
+     * @brief Finds the shortest path, repairing the previous search where possible.
+     * @param board The known game board
+     * @param start The tank position
+     * @param target The position to reach
+     * @param isFirstStepAllowed Extra check for cells adjacent to the start
+     * @return The path excluding the start and including the target, empty
+     *         if the target is the start or cannot be reached
+     */
+    std::vector<Point> findPath(const GameBoard& board, const Point& start, const Point& target,
+                                const PathFinder::StepFilter& isFirstStepAllowed);
+
+    /**
+     * @brief Makes the next search check the board for walls and mines that changed.
+     *
+     * Reading the whole board is skipped otherwise, so callers must mark
+     * every change to the board they pass in.
+     */
+    void markBoardChanged();
+
+    /**
+     * @brief Forgets the previous search, the next call starts from scratch.
+     */
+    void reset();
+
+    /**
+     * @brief Number of cells taken off the queue by all searches so far.
+     */
+    size_t getExpansionCount() const;
+
+private:
+    static constexpr int32_t INF = INT32_MAX / 4;
+
+    struct Key {
+        int64_t primary;
+        int32_t secondary;
+        bool operator<(const Key& other) const {
+            return primary < other.primary ||
+                   (primary == other.primary && secondary < other.secondary);
+        }
+    };
+
+    void initialize(const GameBoard& board, int32_t start, int32_t goal);
+    void refreshPassable(const GameBoard& board);
+    int heuristic(int32_t from, int32_t to) const;
+    Key calculateKey(int32_t cell) const;
+    int32_t lookahead(int32_t cell) const;
+    void updateQueue(int32_t cell);
+    void updateVertex(int32_t cell);
+    void computeShortestPath();
+    void neighborsOf(int32_t cell, int32_t (&neighbors)[8]) const;
+    bool tracePath(const PathFinder::StepFilter& isFirstStepAllowed, std::vector<Point>& path) const;
+
+    // Indexed binary heap over cells
+    void heapPush(int32_t cell, const Key& key);
+    void heapUpdate(int32_t cell, const Key& key);
+    void heapRemove(int32_t cell);
+    void heapSiftUp(size_t position);
+    void heapSiftDown(size_t position);
+    void heapSwap(size_t a, size_t b);
+
+    bool m_initialized = false;
+    bool m_boardChanged = false;
+    int m_width = 0;
+    int m_height = 0;
+    int32_t m_start = -1;
+    int32_t m_goal = -1;
+    int64_t m_keyModifier = 0;
+    size_t m_expansions = 0;
+
+    std::vector<uint8_t> m_passable;
+    std::vector<int32_t> m_g;
+    std::vector<int32_t> m_rhs;
+
+    std::vector<int32_t> m_heap;
+    std::vector<Key> m_heapKeys;
+    std::vector<int32_t> m_heapPosition;
+
+    // Full search used when the distances cannot give a valid path
+    PathFinder m_fallback;
+};
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,236 @@
+#include "gtest/gtest.h"
+#include "incremental_path_planner.h"
+#include "path_finder.h"
+#include "UserCommon/utils/direction.h"
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Algorithm_318835816_211314471 {
+
+class IncrementalPathPlannerTest : public ::testing::Test {
+protected:
+    static GameBoard makeBoard(const std::vector<std::string>& lines) {
+        GameBoard board(lines[0].size(), lines.size());
+        std::vector<std::pair<int, Point>> tankPositions;
+        board.initialize(lines, tankPositions);
+        return board;
+    }
+
+    static GameBoard makeRandomBoard(size_t width, size_t height, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<std::string> lines(height, std::string(width, ' '));
+        for (auto& line : lines) {
+            for (char& cell : line) {
+                unsigned roll = rng() % 12;
+                cell = roll < 3 ? '#' : (roll == 3 ? '@' : ' ');
+            }
+        }
+        return makeBoard(lines);
+    }
+
+    static Point randomFreeCell(const GameBoard& board, std::mt19937& rng) {
+        while (true) {
+            Point cell(rng() % board.getWidth(), rng() % board.getHeight());
+            if (board.getCellType(cell) == GameBoard::CellType::Empty) {
+                return cell;
+            }
+        }
+    }
+
+    static bool isValidPath(const GameBoard& board, const Point& start, const Point& target,
+                            const std::vector<Point>& path) {
+        Point current = start;
+        for (const Point& step : path) {
+            bool adjacent = false;
+            for (Direction dir : ALL_DIRECTIONS) {
+                adjacent = adjacent || board.wrapPosition(current + getDirectionDelta(dir)) == step;
+            }
+            if (!adjacent || !board.canMoveTo(step) || board.isMine(step)) {
+                return false;
+            }
+            current = step;
+        }
+        return path.empty() || current == target;
+    }
+
+    static bool anyStep(const Point&) { return true; }
+};
+
+TEST_F(IncrementalPathPlannerTest, FindPath_ShortestOnStaticBoard) {
+    GameBoard board = makeBoard({
+        "       ",
+        " ##### ",
+        "   #   ",
+        "   #   "
+    });
+    IncrementalPathPlanner planner;
+    auto path = planner.findPath(board, Point(0, 2), Point(6, 2), anyStep);
+    // Left around the wrapping edge
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(path[0], Point(6, 2));
+
+    // Around the wall through the wrapping top row
+    path = planner.findPath(board, Point(2, 3), Point(4, 3), anyStep);
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_TRUE(isValidPath(board, Point(2, 3), Point(4, 3), path));
+
+    EXPECT_TRUE(planner.findPath(board, Point(4, 3), Point(4, 3), anyStep).empty());
+}
+
+TEST_F(IncrementalPathPlannerTest, FindPath_RepairsWhenWallDisappears) {
+    GameBoard sealed = makeBoard({
+        " # # ",
+        " # # ",
+        " # # "
+    });
+    IncrementalPathPlanner planner;
+    EXPECT_TRUE(planner.findPath(sealed, Point(0, 1), Point(2, 1), anyStep).empty());
+    sealed.setCellType(1, 1, GameBoard::CellType::Empty);
+    planner.markBoardChanged();
+    auto path = planner.findPath(sealed, Point(0, 1), Point(2, 1), anyStep);
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(path[0], Point(1, 1));
+    sealed.setCellType(1, 1, GameBoard::CellType::Wall);
+    planner.markBoardChanged();
+    // And back when the wall returns
+    EXPECT_TRUE(planner.findPath(sealed, Point(0, 1), Point(2, 1), anyStep).empty());
+}
+
+TEST_F(IncrementalPathPlannerTest, FindPath_FirstStepFilterFallsBackToSearch) {
+    GameBoard board = makeBoard({
+        "       ",
+        "       ",
+        "       "
+    });
+    IncrementalPathPlanner planner;
+    auto notRight = [](const Point& step) { return step.getX() != 2; };
+    auto path = planner.findPath(board, Point(1, 1), Point(3, 1), notRight);
+    PathFinder finder;
+    EXPECT_EQ(path.size(), finder.findPath(board, Point(1, 1), Point(3, 1), notRight).size());
+    EXPECT_TRUE(isValidPath(board, Point(1, 1), Point(3, 1), path));
+    ASSERT_FALSE(path.empty());
+    EXPECT_NE(path[0].getX(), 2);
+}
+
+TEST_F(IncrementalPathPlannerTest, FindPath_MatchesSearchLengthsWhileEverythingMoves) {
+    const std::vector<std::pair<size_t, size_t>> sizes = {{12, 9}, {20, 20}, {7, 15}};
+    for (size_t seed = 0; seed < sizes.size(); ++seed) {
+        auto [width, height] = sizes[seed];
+        GameBoard board = makeRandomBoard(width, height, static_cast<unsigned>(seed));
+        std::mt19937 rng(static_cast<unsigned>(seed) + 30);
+        Point tank = randomFreeCell(board, rng);
+        Point target = randomFreeCell(board, rng);
+        IncrementalPathPlanner planner;
+        PathFinder finder;
+
+        for (int turn = 0; turn < 300; ++turn) {
+            auto filter = [turn](const Point& step) { return (step.getX() * 7 + step.getY() + turn) % 5 != 0; };
+            auto path = planner.findPath(board, tank, target, filter);
+            auto expected = finder.findPath(board, tank, target, filter);
+            ASSERT_EQ(path.size(), expected.size())
+                << width << "x" << height << " turn " << turn << " " << tank << " -> " << target;
+            ASSERT_TRUE(isValidPath(board, tank, target, path));
+
+            // The tank follows its path, the target wanders and the board changes
+            if (!path.empty() && rng() % 3 != 0) {
+                tank = path[0];
+            }
+            Point step = board.wrapPosition(target + getDirectionDelta(ALL_DIRECTIONS[rng() % 8]));
+            if (board.getCellType(step) == GameBoard::CellType::Empty && rng() % 2 == 0) {
+                target = step;
+            }
+            if (rng() % 10 == 0) {
+                target = randomFreeCell(board, rng);
+            }
+            for (int change = 0; change < 2; ++change) {
+                Point cell(rng() % width, rng() % height);
+                if (cell == tank || cell == target) {
+                    continue;
+                }
+                board.setCellType(cell, board.getCellType(cell) == GameBoard::CellType::Wall
+                                            ? GameBoard::CellType::Empty
+                                            : GameBoard::CellType::Wall);
+                planner.markBoardChanged();
+            }
+        }
+    }
+}
+
+TEST_F(IncrementalPathPlannerTest, DISABLED_Benchmark_ChasingWanderingTarget) {
+    const size_t size = 200;
+    GameBoard board = makeRandomBoard(size, size, 21);
+    std::mt19937 rng(4);
+    Point tank = randomFreeCell(board, rng);
+    Point target = randomFreeCell(board, rng);
+
+    // Scripted game: the tank follows its path while the target wanders, and
+    // walls shot away show up with battle info every fourth turn
+    struct Turn {
+        Point tank;
+        Point target;
+        std::vector<Point> removedWalls;
+    };
+    std::vector<Turn> turns;
+    {
+        GameBoard script = board;
+        PathFinder finder;
+        for (int turn = 0; turn < 150; ++turn) {
+            Turn entry{tank, target, {}};
+            for (int i = 0; turn % 4 == 0 && i < 8; ++i) {
+                Point cell(rng() % size, rng() % size);
+                if (script.getCellType(cell) == GameBoard::CellType::Wall) {
+                    script.setCellType(cell, GameBoard::CellType::Empty);
+                    entry.removedWalls.push_back(cell);
+                }
+            }
+            turns.push_back(entry);
+            auto path = finder.findPath(script, tank, target, anyStep);
+            if (path.size() > 1) {
+                tank = path[0];
+            }
+            Point step = script.wrapPosition(target + getDirectionDelta(ALL_DIRECTIONS[rng() % 8]));
+            if (script.getCellType(step) == GameBoard::CellType::Empty) {
+                target = step;
+            }
+        }
+    }
+
+    auto play = [&](auto&& findPath) {
+        GameBoard current = board;
+        size_t steps = 0;
+        for (const Turn& turn : turns) {
+            for (const Point& wall : turn.removedWalls) {
+                current.setCellType(wall, GameBoard::CellType::Empty);
+            }
+            steps += findPath(current, turn.tank, turn.target, !turn.removedWalls.empty()).size();
+        }
+        return steps;
+    };
+
+    IncrementalPathPlanner planner;
+    PathFinder finder;
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t plannerSteps = play([&](const GameBoard& current, const Point& from, const Point& to, bool changed) {
+        if (changed) {
+            planner.markBoardChanged();
+        }
+        return planner.findPath(current, from, to, anyStep);
+    });
+    auto middle = std::chrono::high_resolution_clock::now();
+    size_t finderSteps = play([&](const GameBoard& current, const Point& from, const Point& to, bool) {
+        return finder.findPath(current, from, to, anyStep);
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double plannerTime = std::chrono::duration<double>(middle - start).count();
+    double finderTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("incremental_ms", std::to_string(plannerTime * 1000));
+    RecordProperty("incremental_expansions", static_cast<int>(planner.getExpansionCount()));
+    RecordProperty("full_search_ms", std::to_string(finderTime * 1000));
+
+    EXPECT_EQ(plannerSteps, finderSteps);
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,157 @@
+#include "line_of_sight_table.h"
+
+namespace Algorithm_318835816_211314471 {
+
+namespace {
+
+// Step of each ray type, travelled forward with sign +1
+constexpr int RAY_DX[] = {1, 0, 1, 1};
+constexpr int RAY_DY[] = {0, 1, 1, -1};
+
+} // namespace
+
+LineOfSightTable::RayDirection LineOfSightTable::getRayDirection(Direction direction) {
+    switch (direction) {
+        case Direction::Right:     return {0, 1};
+        case Direction::Left:      return {0, -1};
+        case Direction::Down:      return {1, 1};
+        case Direction::Up:        return {1, -1};
+        case Direction::DownRight: return {2, 1};
+        case Direction::UpLeft:    return {2, -1};
+        case Direction::UpRight:   return {3, 1};
+        case Direction::DownLeft:  return {3, -1};
+    }
+    return {0, 1};
+}
+
+bool LineOfSightTable::contains(const Point& position) const {
+    return position.getX() >= 0 && position.getX() < m_width &&
+           position.getY() >= 0 && position.getY() < m_height;
+}
+
+int LineOfSightTable::indexOf(const Point& position) const {
+    return position.getY() * m_width + position.getX();
+}
+
+void LineOfSightTable::buildRays() {
+    const int cells = m_width * m_height;
+    for (int type = 0; type < RAY_TYPES; ++type) {
+        m_rayId[type].assign(cells, -1);
+        m_rayPosition[type].assign(cells, 0);
+        m_rayCells[type].clear();
+        m_rayCells[type].reserve(cells);
+
+        // Every ray of a type has the same length, so ray r occupies
+        // m_rayCells[r * length, (r + 1) * length)
+        int rayCount = 0;
+        for (int start = 0; start < cells; ++start) {
+            if (m_rayId[type][start] >= 0) {
+                continue;
+            }
+            int x = start % m_width;
+            int y = start / m_width;
+            int position = 0;
+            int cell = start;
+            do {
+                m_rayId[type][cell] = rayCount;
+                m_rayPosition[type][cell] = position++;
+                m_rayCells[type].push_back(cell);
+                x = wrapAxis(x + RAY_DX[type], m_width);
+                y = wrapAxis(y + RAY_DY[type], m_height);
+                cell = y * m_width + x;
+            } while (cell != start);
+            m_rayLength[type] = position;
+            rayCount++;
+        }
+    }
+}
+
+void LineOfSightTable::build(const GameBoard& board,
+                             const std::vector<Point>& enemyTanks,
+                             const std::vector<Point>& friendlyTanks) {
+    int width = static_cast<int>(board.getWidth());
+    int height = static_cast<int>(board.getHeight());
+    if (width != m_width || height != m_height) {
+        m_width = width;
+        m_height = height;
+        m_maxSteps = width + height;
+        buildRays();
+    }
+
+    const int cells = m_width * m_height;
+    m_tankAt.assign(cells, 0);
+    for (const auto* tanks : {&enemyTanks, &friendlyTanks}) {
+        for (const Point& tank : *tanks) {
+            if (contains(tank)) {
+                m_tankAt[indexOf(tank)] = 1;
+            }
+        }
+    }
+
+    std::vector<uint8_t> blocked(cells, 0);
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            int cell = y * m_width + x;
+            blocked[cell] = m_tankAt[cell] || board.getCellTypeUnchecked(x, y) == GameBoard::CellType::Wall;
+        }
+    }
+
+    for (const Direction direction : ALL_DIRECTIONS) {
+        RayDirection ray = getRayDirection(direction);
+        const int length = m_rayLength[ray.type];
+        const std::vector<int32_t>& rayCells = m_rayCells[ray.type];
+        std::vector<int32_t>& distance = m_blockerDistance[static_cast<int>(direction)];
+        distance.assign(cells, NO_BLOCKER);
+
+        // Walk each ray twice against the travel direction, remembering the
+        // nearest blocker ahead, so rays that wrap around are covered
+        for (int rayStart = 0; rayStart < cells; rayStart += length) {
+            int nearest = -1;
+            for (int step = 2 * length - 1; step >= 0; --step) {
+                int position = ray.sign > 0 ? step % length : (length - 1 - step % length);
+                int cell = rayCells[rayStart + position];
+                if (step < length && nearest >= 0) {
+                    distance[cell] = nearest - step;
+                }
+                if (blocked[cell]) {
+                    nearest = step;
+                }
+            }
+        }
+    }
+}
+
+bool LineOfSightTable::hasLineOfSight(const Point& from, const Point& to, Direction direction) const {
+    if (from == to) {
+        return true;
+    }
+    if (m_width == 0 || !contains(to)) {
+        return false;
+    }
+
+    Point start(wrapAxis(from.getX(), m_width), wrapAxis(from.getY(), m_height));
+    RayDirection ray = getRayDirection(direction);
+    int fromCell = indexOf(start);
+    int toCell = indexOf(to);
+    if (m_rayId[ray.type][fromCell] != m_rayId[ray.type][toCell]) {
+        return false;
+    }
+
+    // Steps along the ray, a full turn if the start wraps onto the target
+    const int length = m_rayLength[ray.type];
+    int offset = m_rayPosition[ray.type][toCell] - m_rayPosition[ray.type][fromCell];
+    int steps = ((ray.sign * offset) % length + length) % length;
+    if (steps == 0) {
+        steps = length;
+    }
+
+    // Reaching the target first counts even if the target itself blocks
+    return steps <= m_maxSteps &&
+           steps <= m_blockerDistance[static_cast<int>(direction)][fromCell];
+}
+
+bool LineOfSightTable::isTankAt(const Point& position) const {
+    return contains(position) && m_tankAt[indexOf(position)] != 0;
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "UserCommon/game_board.h"
+#include "UserCommon/utils/direction.h"
+#include "UserCommon/utils/point.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class LineOfSightTable
+ * @brief Answers line-of-sight queries on a wrapping board in constant time.
+ *
+ * Moving in one direction on a wrapping board walks a closed ray through the
+ * board. For each of the four ray orientations the table stores which ray a
+ * cell lies on and its position along it, which depends only on the board
+ * size. For each cell and direction it stores the number of steps to the
+ * first blocking cell (wall or tank), rebuilt whenever the board or the
+ * tanks change.
+ *
+ * A query then compares the steps to the target with the steps to the first
+ * blocker, matching a walk of at most width + height steps that stops at the
+ * target before checking it for walls or tanks.
+ */
+class LineOfSightTable {
+public:
+    /**
+     * @brief Rebuilds the blocker distances for a board and its tanks.
+     * @param board The known game board
+     * @param enemyTanks Positions of enemy tanks
+     * @param friendlyTanks Positions of friendly tanks
+     */
+    void build(const GameBoard& board,
+               const std::vector<Point>& enemyTanks,
+               const std::vector<Point>& friendlyTanks);
+
+    /**
+     * @brief Checks if 'to' is seen from 'from' when looking in a direction.
+     * @param from The starting point
+     * @param to The target point
+     * @param direction The direction to look in
+     * @return true if the target is reached before any wall or tank
+     */
+    bool hasLineOfSight(const Point& from, const Point& to, Direction direction) const;
+
+    /**
+     * @brief Checks if a tank (enemy or friendly) occupies a cell.
+     * @param position The position to check, outside the board is never occupied
+     * @return true if a tank is at the position
+     */
+    bool isTankAt(const Point& position) const;
+
+private:
+    static constexpr int NO_BLOCKER = INT32_MAX;
+    static constexpr int RAY_TYPES = 4;
+
+    // Ray orientation and travel sign of a direction
+    struct RayDirection {
+        int type;
+        int sign;
+    };
+    static RayDirection getRayDirection(Direction direction);
+
+    bool contains(const Point& position) const;
+    int indexOf(const Point& position) const;
+    void buildRays();
+
+    int m_width = 0;
+    int m_height = 0;
+    int m_maxSteps = 0;
+
+    // Per ray type: length of every ray, ray and position of each cell, and
+    // the cells of each ray in order (ray * length + position)
+    int m_rayLength[RAY_TYPES] = {};
+    std::vector<int32_t> m_rayId[RAY_TYPES];
+    std::vector<int32_t> m_rayPosition[RAY_TYPES];
+    std::vector<int32_t> m_rayCells[RAY_TYPES];
+
+    // Steps to the first blocker per direction and cell, NO_BLOCKER if none
+    std::vector<int32_t> m_blockerDistance[8];
+    std::vector<uint8_t> m_tankAt;
+};
+
+} // namespace Algorithm_318835816_211314471
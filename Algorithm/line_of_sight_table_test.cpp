@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+#include "line_of_sight_table.h"
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Algorithm_318835816_211314471 {
+
+class LineOfSightTableTest : public ::testing::Test {
+protected:
+    static GameBoard makeBoard(const std::vector<std::string>& lines) {
+        GameBoard board(lines[0].size(), lines.size());
+        std::vector<std::pair<int, Point>> tankPositions;
+        board.initialize(lines, tankPositions);
+        return board;
+    }
+
+    static GameBoard makeRandomBoard(size_t width, size_t height, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<std::string> lines(height, std::string(width, ' '));
+        for (auto& line : lines) {
+            for (char& cell : line) {
+                cell = rng() % 6 == 0 ? '#' : ' ';
+            }
+        }
+        return makeBoard(lines);
+    }
+
+    // The walk the table replaces
+    static bool walkLineOfSight(const GameBoard& board, const std::vector<Point>& tanks,
+                                const Point& from, const Point& to, Direction direction) {
+        if (from == to) {
+            return true;
+        }
+        Point current = from;
+        int maxSteps = board.getWidth() + board.getHeight();
+        for (int steps = 0; steps < maxSteps; ++steps) {
+            current = board.wrapPosition(current + getDirectionDelta(direction));
+            if (current == to) {
+                return true;
+            }
+            if (board.isWall(current)) {
+                return false;
+            }
+            for (const Point& tank : tanks) {
+                if (tank == current) {
+                    return false;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(LineOfSightTableTest, WallsAndTanksBlock) {
+    GameBoard board = makeBoard({
+        "       ",
+        "   #   ",
+        "       ",
+        "       "
+    });
+    LineOfSightTable table;
+    table.build(board, {Point(5, 2)}, {});
+
+    EXPECT_TRUE(table.hasLineOfSight(Point(0, 1), Point(2, 1), Direction::Right));
+    EXPECT_FALSE(table.hasLineOfSight(Point(0, 1), Point(5, 1), Direction::Right));
+    // The blocking wall itself is seen
+    EXPECT_TRUE(table.hasLineOfSight(Point(0, 1), Point(3, 1), Direction::Right));
+    // Around the board the other way
+    EXPECT_TRUE(table.hasLineOfSight(Point(0, 1), Point(5, 1), Direction::Left));
+
+    EXPECT_TRUE(table.hasLineOfSight(Point(0, 2), Point(5, 2), Direction::Right));
+    EXPECT_FALSE(table.hasLineOfSight(Point(0, 2), Point(6, 2), Direction::Right));
+    EXPECT_TRUE(table.isTankAt(Point(5, 2)));
+    EXPECT_FALSE(table.isTankAt(Point(4, 2)));
+    EXPECT_FALSE(table.isTankAt(Point(50, 2)));
+
+    EXPECT_TRUE(table.hasLineOfSight(Point(1, 1), Point(1, 1), Direction::Up));
+    EXPECT_FALSE(table.hasLineOfSight(Point(0, 0), Point(3, 0), Direction::Up));
+}
+
+TEST_F(LineOfSightTableTest, RebuildFollowsNewBoard) {
+    LineOfSightTable table;
+    table.build(makeBoard({"     ", "  #  ", "     "}), {}, {});
+    EXPECT_FALSE(table.hasLineOfSight(Point(0, 1), Point(4, 1), Direction::Right));
+
+    table.build(makeBoard({"     ", "     ", "     "}), {}, {});
+    EXPECT_TRUE(table.hasLineOfSight(Point(0, 1), Point(4, 1), Direction::Right));
+}
+
+TEST_F(LineOfSightTableTest, MatchesWalkOnRandomBoards) {
+    const std::vector<std::pair<size_t, size_t>> sizes = {{7, 5}, {6, 4}, {9, 9}, {1, 5}, {12, 3}};
+    for (size_t seed = 0; seed < sizes.size(); ++seed) {
+        auto [width, height] = sizes[seed];
+        GameBoard board = makeRandomBoard(width, height, static_cast<unsigned>(seed));
+        std::mt19937 rng(static_cast<unsigned>(seed) + 100);
+        std::vector<Point> tanks;
+        for (int i = 0; i < 3; ++i) {
+            tanks.emplace_back(rng() % width, rng() % height);
+        }
+
+        LineOfSightTable table;
+        table.build(board, {tanks[0]}, {tanks[1], tanks[2]});
+
+        for (size_t from = 0; from < width * height; ++from) {
+            for (size_t to = 0; to < width * height; ++to) {
+                Point a(from % width, from / width);
+                Point b(to % width, to / width);
+                for (Direction direction : ALL_DIRECTIONS) {
+                    ASSERT_EQ(table.hasLineOfSight(a, b, direction),
+                              walkLineOfSight(board, tanks, a, b, direction))
+                        << width << "x" << height << " " << a << " -> " << b << " " << direction;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(LineOfSightTableTest, DISABLED_Benchmark_QueriesOnLargeBoard) {
+    GameBoard board = makeRandomBoard(300, 200, 7);
+    std::vector<Point> tanks = {Point(10, 10), Point(150, 100), Point(290, 190)};
+    std::mt19937 rng(3);
+    std::vector<std::pair<Point, Point>> queries;
+    for (int i = 0; i < 20000; ++i) {
+        queries.emplace_back(Point(rng() % 300, rng() % 200), Point(rng() % 300, rng() % 200));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    LineOfSightTable table;
+    table.build(board, tanks, {});
+    auto built = std::chrono::high_resolution_clock::now();
+    size_t tableHits = 0;
+    for (const auto& [from, to] : queries) {
+        for (Direction direction : ALL_DIRECTIONS) {
+            tableHits += table.hasLineOfSight(from, to, direction);
+        }
+    }
+    auto queried = std::chrono::high_resolution_clock::now();
+    size_t walkHits = 0;
+    for (const auto& [from, to] : queries) {
+        for (Direction direction : ALL_DIRECTIONS) {
+            walkHits += walkLineOfSight(board, tanks, from, to, direction);
+        }
+    }
+    auto walked = std::chrono::high_resolution_clock::now();
+
+    double buildTime = std::chrono::duration<double>(built - start).count();
+    double tableTime = std::chrono::duration<double>(queried - built).count();
+    double walkTime = std::chrono::duration<double>(walked - queried).count();
+    RecordProperty("build_ms", std::to_string(buildTime * 1000));
+    RecordProperty("table_ms", std::to_string(tableTime * 1000));
+    RecordProperty("walk_ms", std::to_string(walkTime * 1000));
+
+    EXPECT_EQ(tableHits, walkHits);
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -1,3 +1,5 @@
+#include <utility>
+
 #include "offensive_battle_info.h"
 
 using namespace UserCommon_318835816_211314471;
@@ -18,4 +20,14 @@ std::optional<Point> OffensiveBattleInfo::getTargetTankPosition() const {
     return m_target_tank_position;
 }
 
+// --- Enemy Distance Field Implementation ---
+
+void OffensiveBattleInfo::setEnemyDistanceField(std::shared_ptr<const DistanceField> field) {
+    m_enemy_distance_field = std::move(field);
+}
+
+const std::shared_ptr<const DistanceField>& OffensiveBattleInfo::getEnemyDistanceField() const {
+    return m_enemy_distance_field;
+}
+
 } // namespace Algorithm_318835816_211314471
\ No newline at end of file
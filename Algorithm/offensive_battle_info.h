@@ -1,8 +1,10 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include "battle_info_impl.h"
+#include "distance_field.h"
 #include "UserCommon/utils/point.h"
 
 using namespace UserCommon_318835816_211314471;
@@ -18,8 +20,13 @@ public:
     void clearTargetTankPosition();
     std::optional<Point> getTargetTankPosition() const;
 
+    // --- Distance to the nearest enemy, shared by all the player's tanks ---
+    void setEnemyDistanceField(std::shared_ptr<const DistanceField> field);
+    const std::shared_ptr<const DistanceField>& getEnemyDistanceField() const;
+
 private:
     std::optional<Point> m_target_tank_position;
+    std::shared_ptr<const DistanceField> m_enemy_distance_field;
 };
 
 } // namespace Algorithm_318835816_211314471
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <utility>
 
 #include "offensive_player.h"
 #include "common/PlayerRegistration.h"
@@ -10,7 +12,10 @@ namespace Algorithm_318835816_211314471 {
 
 Player_318835816_211314471_A::Player_318835816_211314471_A(int playerIndex, size_t x, size_t y, size_t maxSteps, size_t numShells)
     : BasicPlayer(playerIndex, x, y, maxSteps, numShells),
-      m_offensiveBattleInfo(static_cast<int>(x), static_cast<int>(y)) {}
+      m_offensiveBattleInfo(static_cast<int>(x), static_cast<int>(y)) {
+    // The tanks read this info, not the base class one
+    m_offensiveBattleInfo.setInitialShells(static_cast<int>(numShells));
+}
 
 Player_318835816_211314471_A::~Player_318835816_211314471_A() = default;
 
@@ -24,6 +29,7 @@ void Player_318835816_211314471_A::populateBattleInfo(SatelliteView& satelliteVi
     BasicPlayer::parseSatelliteViewToBattleInfo(m_offensiveBattleInfo, satelliteView, 
                                                 m_playerIndex, m_boardWidth, m_boardHeight);
     updateTarget();
+    updateEnemyDistanceField();
 }
 
 void Player_318835816_211314471_A::updateTarget() {
@@ -70,6 +76,25 @@ std::optional<Point> Player_318835816_211314471_A::selectNewTarget(const std::ve
     return closest;
 }
 
+void Player_318835816_211314471_A::updateEnemyDistanceField() {
+    const auto& enemyTanks = m_offensiveBattleInfo.getEnemyTankPositions();
+    if (enemyTanks.empty()) {
+        m_offensiveBattleInfo.setEnemyDistanceField(nullptr);
+        return;
+    }
+    const SharedGameBoard& board = m_offensiveBattleInfo.getSharedGameBoard();
+    if (m_offensiveBattleInfo.getEnemyDistanceField() &&
+        m_fieldBoard.isSameVersion(board) && m_fieldSources == enemyTanks) {
+        return;
+    }
+    // Tanks may still hold the previous field, so build a new one
+    auto field = std::make_shared<DistanceField>();
+    field->build(*board, enemyTanks);
+    m_offensiveBattleInfo.setEnemyDistanceField(std::move(field));
+    m_fieldBoard = board;
+    m_fieldSources = enemyTanks;
+}
+
 } // namespace Algorithm_318835816_211314471
 
 // Registration at global scope (disabled for testing)
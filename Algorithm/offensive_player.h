@@ -1,9 +1,11 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "basic_player.h"
 #include "offensive_battle_info.h"
+#include "shared_game_board.h"
 
 using namespace UserCommon_318835816_211314471;
 
@@ -11,11 +13,17 @@ namespace Algorithm_318835816_211314471 {
 
 /**
  * @class Player_318835816_211314471_A
- * @brief Player that coordinates all tanks to target a single enemy tank.
+ * @brief Player whose tanks advance on the nearest enemy tank.
  *
- * Inherits from BasicPlayer and uses OffensiveBattleInfo to communicate
- * target information to all tanks. If the current target is destroyed, selects
- * the closest enemy tank to the last known target position.
+ * Inherits from BasicPlayer and keeps one distance field to all enemy tanks
+ * in its OffensiveBattleInfo. Every tank follows the same field towards the
+ * enemy closest to it, and the field is only rebuilt when the board or the
+ * enemy positions change.
+ *
+ * The player still selects a target enemy and shares it through the battle
+ * info, but the target does not steer movement. Tanks only use it to turn
+ * towards it to shoot and in the fallback planner. If the target is
+ * destroyed, the closest enemy tank to its last known position is selected.
  */
 class Player_318835816_211314471_A : public BasicPlayer {
 public:
@@ -46,6 +54,11 @@ protected:
      */
     std::optional<Point> selectNewTarget(const std::vector<Point>& enemyTanks, const Point& reference) const;
 
+    /**
+     * @brief Rebuilds the shared enemy distance field if its inputs changed.
+     */
+    void updateEnemyDistanceField();
+
     /**
      * @brief The last known target tank position (if any)
      */
@@ -55,6 +68,12 @@ protected:
      * @brief The offensive battle info object
      */
     OffensiveBattleInfo m_offensiveBattleInfo;
+
+    /**
+     * @brief The board and enemy positions the distance field was built from
+     */
+    SharedGameBoard m_fieldBoard;
+    std::vector<Point> m_fieldSources;
 };
 
 } // namespace Algorithm_318835816_211314471
@@ -161,4 +161,42 @@ TEST(OffensivePlayerTest, ChoosesClosestOfMultipleTanksAfterTargetDestroyed) {
     EXPECT_EQ(info2->getTargetTankPosition().value(), Point(3, 2));
 }
 
+TEST(OffensivePlayerTest, SharesDistanceFieldUntilEnemiesMove) {
+    std::vector<std::vector<char>> board1 = {
+        {' ', ' ', '2', ' '},
+        {' ', '%', ' ', ' '},
+        {' ', ' ', ' ', '1'}
+    };
+    Player_318835816_211314471_A player(1, 4, 3, 10, 5);
+    MockSatelliteView view1(board1);
+    MockTankAlgorithm algo1;
+    player.updateTankWithBattleInfo(algo1, view1);
+    auto* info = dynamic_cast<OffensiveBattleInfo*>(algo1.lastInfo);
+    ASSERT_NE(info, nullptr);
+    auto field1 = info->getEnemyDistanceField();
+    ASSERT_NE(field1, nullptr);
+    EXPECT_EQ(field1->getDistance(Point(2, 0)), 0);
+    EXPECT_EQ(field1->getDistance(Point(0, 2)), 2);
+
+    // Another tank asking about the same state gets the same field
+    std::vector<std::vector<char>> board2 = board1;
+    board2[1][1] = '1';
+    board2[2][3] = '%';
+    MockSatelliteView view2(board2);
+    MockTankAlgorithm algo2;
+    player.updateTankWithBattleInfo(algo2, view2);
+    EXPECT_EQ(info->getEnemyDistanceField(), field1);
+
+    // Once the enemy moves the field is rebuilt, the old one stays intact
+    board2[0][2] = ' ';
+    board2[0][0] = '2';
+    MockSatelliteView view3(board2);
+    player.updateTankWithBattleInfo(algo2, view3);
+    auto field2 = info->getEnemyDistanceField();
+    ASSERT_NE(field2, nullptr);
+    EXPECT_NE(field2, field1);
+    EXPECT_EQ(field2->getDistance(Point(0, 0)), 0);
+    EXPECT_EQ(field1->getDistance(Point(2, 0)), 0);
+}
+
 } // namespace Algorithm_318835816_211314471 
\ No newline at end of file
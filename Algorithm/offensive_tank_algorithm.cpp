@@ -1,7 +1,4 @@
-#include <algorithm>
 #include <iostream>
-#include <queue>
-#include <set>
 
 #include "offensive_battle_info.h"
 #include "offensive_tank_algorithm.h"
@@ -26,10 +23,16 @@ void TankAlgorithm_318835816_211314471_A::updateBattleInfo(BattleInfo& info) {
     } else {
         m_targetPosition = std::nullopt;
     }
+    m_enemyDistanceField = offensiveInfo ? offensiveInfo->getEnemyDistanceField() : nullptr;
     // Call base to update tracked state
     BasicTankAlgorithm::updateBattleInfo(info);
 }
 
+void TankAlgorithm_318835816_211314471_A::markBoardChanged() {
+    BasicTankAlgorithm::markBoardChanged();
+    m_pathPlanner.markBoardChanged();
+}
+
 ActionRequest TankAlgorithm_318835816_211314471_A::getAction() {
     ActionRequest action = ActionRequest::GetBattleInfo;
     // 1. Update battle info if necessary
@@ -47,8 +50,11 @@ ActionRequest TankAlgorithm_318835816_211314471_A::getAction() {
             if (turnAction.has_value()) {
                 action = turnAction.value();
             } else {
-                updatePathToTarget();
-                auto moveAction = followCurrentPath();
+                auto moveAction = followDistanceField();
+                if (!moveAction.has_value()) {
+                    updatePathToTarget();
+                    moveAction = followCurrentPath();
+                }
                 if (moveAction.has_value()) {
                     action = moveAction.value();
                 }
@@ -70,6 +76,18 @@ std::optional<ActionRequest> TankAlgorithm_318835816_211314471_A::turnToShootAct
     return std::nullopt;
 }
 
+std::optional<ActionRequest> TankAlgorithm_318835816_211314471_A::followDistanceField() const {
+    if (!m_enemyDistanceField) return std::nullopt;
+    auto dirOpt = m_enemyDistanceField->getDownhillDirection(
+        m_trackedPosition, m_trackedDirection,
+        [this](const Point& step) { return isPositionSafe(step); });
+    if (!dirOpt.has_value()) return std::nullopt;
+    if (dirOpt.value() != m_trackedDirection) {
+        return getRotationToDirection(m_trackedDirection, dirOpt.value());
+    }
+    return ActionRequest::MoveForward;
+}
+
 void TankAlgorithm_318835816_211314471_A::updatePathToTarget() {
     // Check if we've reached the target
     if (m_trackedPosition == m_targetPosition.value()) {
@@ -84,8 +102,8 @@ void TankAlgorithm_318835816_211314471_A::updatePathToTarget() {
         int distance = GameBoard::stepDistance(
             m_previousTargetPosition.value(),
             m_targetPosition.value(),
-            m_gameBoard.getWidth(),
-            m_gameBoard.getHeight()
+            m_gameBoard->getWidth(),
+            m_gameBoard->getHeight()
         );
         targetMovedSignificantly = (distance > 1);
     }
@@ -97,7 +115,10 @@ void TankAlgorithm_318835816_211314471_A::updatePathToTarget() {
         !isFirstStepValid();
 
     if (needRecalculation) {
-        m_currentPath = findPathBFS(m_trackedPosition, m_targetPosition.value());
+        std::vector<Point> path = m_pathPlanner.findPath(
+            *m_gameBoard, m_trackedPosition, m_targetPosition.value(),
+            [this](const Point& step) { return isPositionSafe(step); });
+        m_currentPath.assign(path.begin(), path.end());
         m_previousTargetPosition = m_targetPosition;
     }
 }
@@ -121,7 +142,7 @@ bool TankAlgorithm_318835816_211314471_A::isFirstStepValid() const {
 
 std::optional<ActionRequest> TankAlgorithm_318835816_211314471_A::followCurrentPath() {
     if (!m_currentPath.empty() && m_trackedPosition == m_currentPath.front()) {
-        m_currentPath.erase(m_currentPath.begin());
+        m_currentPath.pop_front();
     }
     
     if (m_currentPath.empty()) return std::nullopt;
@@ -135,53 +156,13 @@ std::optional<ActionRequest> TankAlgorithm_318835816_211314471_A::followCurrentP
         return getRotationToDirection(m_trackedDirection, dirOpt.value());
     }
 
-    m_currentPath.erase(m_currentPath.begin());
+    m_currentPath.pop_front();
     return ActionRequest::MoveForward;
 }
 
 std::vector<Point> TankAlgorithm_318835816_211314471_A::findPathBFS(const Point& start, const Point& target) const {
-    if (start == target) return {};
-    std::queue<Point> q;
-    std::map<Point, Point> cameFrom;
-    std::set<Point> visited;
-    q.push(start);
-    visited.insert(start);
-    bool foundPath = false;
-    while (!q.empty() && !foundPath) {
-        Point current = q.front();
-        q.pop();
-        if (current == target) {
-            foundPath = true;
-            break;
-        }
-        for (const Direction& dir : ALL_DIRECTIONS) {
-            Point neighbor = m_gameBoard.wrapPosition(current + getDirectionDelta(dir));
-            if (visited.count(neighbor) > 0 ||
-                !m_gameBoard.canMoveTo(neighbor) ||
-                m_gameBoard.isMine(neighbor)) {
-                continue;
-            }
-
-            if (current == start && !isPositionSafe(neighbor)) {
-                continue;
-            }
-
-            visited.insert(neighbor);
-            cameFrom[neighbor] = current;
-            q.push(neighbor);
-        }
-    }
-    if (foundPath) {
-        std::vector<Point> path;
-        Point current = target;
-        while (current != start) {
-            path.push_back(current);
-            current = cameFrom[current];
-        }
-        std::reverse(path.begin(), path.end());
-        return path;
-    }
-    return {};
+    return m_pathFinder.findPath(*m_gameBoard, start, target,
+                                 [this](const Point& step) { return isPositionSafe(step); });
 }
 
 } // namespace Algorithm_318835816_211314471
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <deque>
+#include <memory>
 #include <optional>
 #include <vector>
 
 #include "basic_tank_algorithm.h"
+#include "distance_field.h"
 #include "offensive_battle_info.h"
+#include "incremental_path_planner.h"
+#include "path_finder.h"
 
 using namespace UserCommon_318835816_211314471;
 
@@ -19,7 +24,9 @@ namespace Algorithm_318835816_211314471 {
  *   2. Avoid if in danger (from shells)
  *   3. Shoot if possible
  *   4. Turn to shoot if in line of sight
- *   5. Chase using BFS
+ *   5. Close in on the nearest enemy along the player's shared distance
+ *      field, or chase the target along a shortest path of its own, repaired
+ *      as the target moves, when the field offers no safe step
  */
 class TankAlgorithm_318835816_211314471_A : public BasicTankAlgorithm {
 public:
@@ -29,13 +36,22 @@ public:
     void updateBattleInfo(BattleInfo& info) override;
     ActionRequest getAction() override;
 
+protected:
+    void markBoardChanged() override;
+
 private:
     // Most recent target tank position
     std::optional<Point> m_targetPosition;
-    // Current BFS path to target
-    std::vector<Point> m_currentPath;
+    // Current BFS path to target, steps are taken from the front
+    std::deque<Point> m_currentPath;
     // Previous target tank position
     std::optional<Point> m_previousTargetPosition;
+    // Search buffers reused by every replan
+    mutable PathFinder m_pathFinder;
+    // Distances to the target repaired between replans
+    IncrementalPathPlanner m_pathPlanner;
+    // Distances to the nearest enemy, built by the player and shared by its tanks
+    std::shared_ptr<const DistanceField> m_enemyDistanceField;
 
     // --- Helpers ---
     /**
@@ -43,6 +59,11 @@ private:
      */
     std::optional<ActionRequest> turnToShootAction() const;
 
+    /**
+     * @brief Returns the action that steps down the shared enemy distance field, if any.
+     */
+    std::optional<ActionRequest> followDistanceField() const;
+
     /**
      * @brief Recalculates the BFS path to the target if needed.
      */
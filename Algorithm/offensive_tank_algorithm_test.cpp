@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "offensive_tank_algorithm.h"
 #include "offensive_battle_info.h"
+#include "offensive_player.h"
+#include "SatelliteView.h"
 #include "utils/point.h"
 #include "utils/direction.h"
 
@@ -25,13 +27,14 @@ protected:
     }
     void setTrackedPosition(const Point& pos) { algo->m_trackedPosition = pos; }
     void setTrackedDirection(Direction dir) { algo->m_trackedDirection = dir; }
-    void setGameBoard(const GameBoard& board) { algo->m_gameBoard = board; }
-    void setShells(const std::vector<Point>& shells) { algo->m_shells = shells; }
-    void setEnemyTanks(const std::vector<Point>& enemies) { algo->m_enemyTanks = enemies; }
-    void setCurrentPath(const std::vector<Point>& path) { algo->m_currentPath = path; }
+    void setGameBoard(const GameBoard& board) { algo->m_gameBoard = board; algo->markBoardChanged(); }
+    void setShells(const std::vector<Point>& shells) { algo->m_shells = shells; algo->markBoardChanged(); }
+    void setEnemyTanks(const std::vector<Point>& enemies) { algo->m_enemyTanks = enemies; algo->markBoardChanged(); }
+    void setCurrentPath(const std::vector<Point>& path) { algo->m_currentPath.assign(path.begin(), path.end()); }
     void setTurnsSinceLastUpdate(int turns) { algo->m_turnsSinceLastUpdate = turns; }
+    int getTrackedShells() const { return algo->m_trackedShells; }
     std::optional<Point> getTargetPosition() const { return algo->m_targetPosition; }
-    std::vector<Point> getCurrentPath() const { return algo->m_currentPath; }
+    std::vector<Point> getCurrentPath() const { return {algo->m_currentPath.begin(), algo->m_currentPath.end()}; }
     // Helper to create a board from string lines
     GameBoard makeBoard(const std::vector<std::string>& lines) {
         GameBoard board(lines[0].size(), lines.size());
@@ -82,6 +85,25 @@ TEST_F(OffensiveTankAlgorithmTest, UpdateBattleInfo_SetsAndClearsTarget) {
     EXPECT_FALSE(getTargetPosition().has_value());
 }
 
+TEST_F(OffensiveTankAlgorithmTest, UpdateBattleInfo_FromPlayerSetsGameShells) {
+    class BoardView : public SatelliteView {
+    public:
+        char getObjectAt(size_t x, size_t y) const override {
+            if (x == 1 && y == 1) return '%';
+            if (x == 3 && y == 3) return '2';
+            return ' ';
+        }
+    };
+
+    // The map's NumShells, not the default, reaches the tank through Player_A
+    const size_t numShells = 3;
+    ASSERT_NE(static_cast<int>(numShells), Tank::DEFAULT_INITIAL_SHELLS);
+    Player_318835816_211314471_A player(1, 5, 5, 100, numShells);
+    BoardView view;
+    player.updateTankWithBattleInfo(*algo, view);
+    EXPECT_EQ(getTrackedShells(), static_cast<int>(numShells));
+}
+
 TEST_F(OffensiveTankAlgorithmTest, TurnToShootAction_RotatesCorrectly) {
     injectBattleInfoWithBoard({
         "     ",
@@ -192,4 +214,23 @@ TEST_F(OffensiveTankAlgorithmTest, GetAction_Priority5_ChaseWithBFS) {
     EXPECT_TRUE(action == ActionRequest::MoveForward || action == ActionRequest::RotateRight90 || action == ActionRequest::RotateLeft90);
 }
 
+TEST_F(OffensiveTankAlgorithmTest, GetAction_Priority5_FollowsSharedDistanceField) {
+    GameBoard board(7, 7);
+    auto field = std::make_shared<DistanceField>();
+    field->build(board, {Point(4, 0)});
+    OffensiveBattleInfo info(board.getWidth(), board.getHeight());
+    info.addEnemyTankPosition(Point(4, 0));
+    info.setTargetTankPosition(Point(4, 0));
+    info.setEnemyDistanceField(field);
+    algo->updateBattleInfo(info);
+    setGameBoard(board);
+    setTrackedPosition(Point(2, 3));
+    setTrackedDirection(Direction::Up);
+    setEnemyTanks({Point(4, 0)});
+
+    // Facing a cell one step closer, the tank moves without planning a path
+    EXPECT_EQ(algo->getAction(), ActionRequest::MoveForward);
+    EXPECT_TRUE(getCurrentPath().empty());
+}
+
 } // namespace Algorithm_318835816_211314471 
\ No newline at end of file
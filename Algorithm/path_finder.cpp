@@ -0,0 +1,110 @@
+#include "path_finder.h"
+
+#include <algorithm>
+
+#include "UserCommon/utils/direction.h"
+
+namespace Algorithm_318835816_211314471 {
+
+void PathFinder::resize(int width, int height) {
+    m_width = width;
+    m_height = height;
+    const size_t cells = static_cast<size_t>(width) * static_cast<size_t>(height);
+
+    m_passable.assign(cells, 0);
+    m_visited.assign(cells, 0);
+    m_parent.assign(cells, -1);
+    m_generation = 0;
+
+    size_t capacity = 1;
+    while (capacity < cells) {
+        capacity <<= 1;
+    }
+    m_frontier.assign(capacity, 0);
+    m_frontierMask = capacity - 1;
+}
+
+void PathFinder::push(int32_t cell) {
+    m_frontier[m_tail & m_frontierMask] = cell;
+    m_tail++;
+}
+
+int32_t PathFinder::pop() {
+    return m_frontier[m_head++ & m_frontierMask];
+}
+
+std::vector<Point> PathFinder::findPath(const GameBoard& board, const Point& start, const Point& target,
+                                        const StepFilter& isFirstStepAllowed) {
+    if (start == target) return {};
+
+    int width = static_cast<int>(board.getWidth());
+    int height = static_cast<int>(board.getHeight());
+    if (width == 0 || height == 0) return {};
+    if (width != m_width || height != m_height) {
+        resize(width, height);
+    }
+
+    Point wrappedStart = board.wrapPosition(start);
+    Point wrappedTarget = board.wrapPosition(target);
+    const int32_t startCell = wrappedStart.getY() * m_width + wrappedStart.getX();
+    const int32_t targetCell = wrappedTarget.getY() * m_width + wrappedTarget.getX();
+
+    // A wrapped generation could match stale stamps, start over from clean buffers
+    if (++m_generation == 0) {
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_generation = 1;
+    }
+    m_head = 0;
+    m_tail = 0;
+
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            GameBoard::CellType type = board.getCellTypeUnchecked(x, y);
+            m_passable[y * m_width + x] = type != GameBoard::CellType::Wall && type != GameBoard::CellType::Mine;
+        }
+    }
+
+    m_visited[startCell] = m_generation;
+    push(startCell);
+    bool foundPath = false;
+    while (m_head != m_tail) {
+        const int32_t current = pop();
+        if (current == targetCell) {
+            foundPath = true;
+            break;
+        }
+        const int x = current % m_width;
+        const int y = current / m_width;
+        for (int i = 0; i < DIRECTION_COUNT; ++i) {
+            int nx = x + DIRECTION_DELTA_X[i];
+            int ny = y + DIRECTION_DELTA_Y[i];
+            nx = nx < 0 ? nx + m_width : (nx >= m_width ? nx - m_width : nx);
+            ny = ny < 0 ? ny + m_height : (ny >= m_height ? ny - m_height : ny);
+            const int32_t neighbor = ny * m_width + nx;
+            if (m_visited[neighbor] == m_generation || !m_passable[neighbor]) {
+                continue;
+            }
+            if (current == startCell && isFirstStepAllowed && !isFirstStepAllowed(Point(nx, ny))) {
+                continue;
+            }
+
+            m_visited[neighbor] = m_generation;
+            m_parent[neighbor] = current;
+            push(neighbor);
+        }
+    }
+
+    if (!foundPath) return {};
+
+    size_t length = 0;
+    for (int32_t cell = targetCell; cell != startCell; cell = m_parent[cell]) {
+        length++;
+    }
+    std::vector<Point> path(length);
+    for (int32_t cell = targetCell; cell != startCell; cell = m_parent[cell]) {
+        path[--length] = Point(cell % m_width, cell / m_width);
+    }
+    return path;
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "UserCommon/game_board.h"
+#include "UserCommon/utils/point.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class PathFinder
+ * @brief Breadth-first search over a wrapping board with buffers reused between searches.
+ *
+ * Cells are addressed by their flat index (y * width + x). The parent of each
+ * reached cell and the generation in which it was reached are kept in flat
+ * arrays, so starting a new search only bumps the generation instead of
+ * clearing anything. Walls and mines are read from the board once per
+ * search into a flat passability array. The frontier is a ring buffer that
+ * holds every cell at most once. All buffers are reallocated only when the
+ * board size changes.
+ *
+ * Neighbours are expanded in ALL_DIRECTIONS order, so ties between equally
+ * short paths are broken the same way on every search.
+ */
+class PathFinder {
+public:
+    // Decides whether the first step away from the start may use a cell
+    using StepFilter = std::function<bool(const Point&)>;
+
+    /**
+     * @brief Finds the shortest path avoiding walls and mines.
+     * @param board The known game board
+     * @param start The starting position
+     * @param target The position to reach
+     * @param isFirstStepAllowed Extra check for cells adjacent to the start
+     * @return The path excluding the start and including the target, empty
+     *         if the target is the start or cannot be reached
+     */
+    std::vector<Point> findPath(const GameBoard& board, const Point& start, const Point& target,
+                                const StepFilter& isFirstStepAllowed);
+
+private:
+    void resize(int width, int height);
+    void push(int32_t cell);
+    int32_t pop();
+
+    int m_width = 0;
+    int m_height = 0;
+
+    // Cells a path may use, refreshed from the board on every search
+    std::vector<uint8_t> m_passable;
+
+    // Generation of the current search, a cell is visited if its stamp matches
+    uint32_t m_generation = 0;
+    std::vector<uint32_t> m_visited;
+    std::vector<int32_t> m_parent;
+
+    // Ring buffer frontier, capacity is a power of two of at least the cell count
+    std::vector<int32_t> m_frontier;
+    size_t m_frontierMask = 0;
+    size_t m_head = 0;
+    size_t m_tail = 0;
+};
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,195 @@
+#include "gtest/gtest.h"
+#include "path_finder.h"
+#include "UserCommon/utils/direction.h"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Algorithm_318835816_211314471 {
+
+class PathFinderTest : public ::testing::Test {
+protected:
+    static GameBoard makeBoard(const std::vector<std::string>& lines) {
+        GameBoard board(lines[0].size(), lines.size());
+        std::vector<std::pair<int, Point>> tankPositions;
+        board.initialize(lines, tankPositions);
+        return board;
+    }
+
+    static GameBoard makeRandomBoard(size_t width, size_t height, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<std::string> lines(height, std::string(width, ' '));
+        for (auto& line : lines) {
+            for (char& cell : line) {
+                unsigned roll = rng() % 12;
+                cell = roll < 2 ? '#' : (roll == 2 ? '@' : ' ');
+            }
+        }
+        return makeBoard(lines);
+    }
+
+    // The map and set search the path finder replaces
+    static std::vector<Point> referencePath(const GameBoard& board, const Point& start, const Point& target,
+                                            const PathFinder::StepFilter& isFirstStepAllowed) {
+        if (start == target) return {};
+        std::queue<Point> q;
+        std::map<Point, Point> cameFrom;
+        std::set<Point> visited;
+        q.push(start);
+        visited.insert(start);
+        bool foundPath = false;
+        while (!q.empty()) {
+            Point current = q.front();
+            q.pop();
+            if (current == target) {
+                foundPath = true;
+                break;
+            }
+            for (const Direction& dir : ALL_DIRECTIONS) {
+                Point neighbor = board.wrapPosition(current + getDirectionDelta(dir));
+                if (visited.count(neighbor) > 0 || !board.canMoveTo(neighbor) || board.isMine(neighbor)) {
+                    continue;
+                }
+                if (current == start && !isFirstStepAllowed(neighbor)) {
+                    continue;
+                }
+                visited.insert(neighbor);
+                cameFrom[neighbor] = current;
+                q.push(neighbor);
+            }
+        }
+        std::vector<Point> path;
+        if (foundPath) {
+            for (Point current = target; current != start; current = cameFrom[current]) {
+                path.push_back(current);
+            }
+            std::reverse(path.begin(), path.end());
+        }
+        return path;
+    }
+
+    static bool anyStep(const Point&) { return true; }
+};
+
+TEST_F(PathFinderTest, FindPath_ShortestAroundWalls) {
+    GameBoard board = makeBoard({
+        "     ",
+        " ### ",
+        "     "
+    });
+    PathFinder finder;
+    auto path = finder.findPath(board, Point(2, 0), Point(2, 2), anyStep);
+    // Wrapping up from row 0 reaches row 2 directly
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(path[0], Point(2, 2));
+
+    path = finder.findPath(board, Point(0, 1), Point(4, 1), anyStep);
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(path[0], Point(4, 1));
+
+    EXPECT_TRUE(finder.findPath(board, Point(1, 0), Point(1, 0), anyStep).empty());
+}
+
+TEST_F(PathFinderTest, FindPath_AvoidsMinesAndUnreachable) {
+    GameBoard board = makeBoard({
+        " # ",
+        "#@#",
+        " # "
+    });
+    PathFinder finder;
+    EXPECT_TRUE(finder.findPath(board, Point(0, 0), Point(1, 1), anyStep).empty());
+
+    GameBoard walled = makeBoard({
+        "  #  ",
+        "  #  ",
+        "  #  "
+    });
+    // Walls across the whole board, except around the edge
+    auto path = finder.findPath(walled, Point(1, 1), Point(3, 1), anyStep);
+    ASSERT_EQ(path.size(), 3u);
+    EXPECT_EQ(path.back(), Point(3, 1));
+
+    GameBoard closed = makeBoard({
+        " # # ",
+        " # # ",
+        " # # "
+    });
+    EXPECT_TRUE(finder.findPath(closed, Point(0, 1), Point(2, 1), anyStep).empty());
+}
+
+TEST_F(PathFinderTest, FindPath_FirstStepFilterOnlyAppliesNextToStart) {
+    GameBoard board = makeBoard({
+        "     ",
+        "     ",
+        "     "
+    });
+    PathFinder finder;
+    auto notRight = [](const Point& step) { return step != Point(2, 1); };
+    auto path = finder.findPath(board, Point(1, 1), Point(3, 1), notRight);
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_NE(path[0], Point(2, 1));
+    EXPECT_EQ(path[1], Point(3, 1));
+
+    // The filtered cell is still usable later on the path
+    path = finder.findPath(board, Point(0, 1), Point(2, 1), notRight);
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(path[1], Point(2, 1));
+}
+
+TEST_F(PathFinderTest, FindPath_MatchesReferenceAcrossReusedSearches) {
+    PathFinder finder;
+    const std::vector<std::pair<size_t, size_t>> sizes = {{9, 7}, {16, 16}, {5, 11}, {9, 7}};
+    for (size_t seed = 0; seed < sizes.size(); ++seed) {
+        auto [width, height] = sizes[seed];
+        GameBoard board = makeRandomBoard(width, height, static_cast<unsigned>(seed));
+        std::mt19937 rng(static_cast<unsigned>(seed) + 50);
+        auto filter = [](const Point& step) { return (step.getX() + step.getY()) % 3 != 0; };
+        for (int query = 0; query < 200; ++query) {
+            Point start(rng() % width, rng() % height);
+            Point target(rng() % width, rng() % height);
+            ASSERT_EQ(finder.findPath(board, start, target, filter),
+                      referencePath(board, start, target, filter))
+                << width << "x" << height << " " << start << " -> " << target;
+        }
+    }
+}
+
+TEST_F(PathFinderTest, DISABLED_Benchmark_ReplansPerSecond) {
+    for (size_t size : {100u, 500u}) {
+        GameBoard board = makeRandomBoard(size, size, 11);
+        std::mt19937 rng(5);
+        const int replans = size == 100 ? 200 : 5;
+        std::vector<std::pair<Point, Point>> queries;
+        for (int i = 0; i < replans; ++i) {
+            queries.emplace_back(Point(rng() % size, rng() % size), Point(rng() % size, rng() % size));
+        }
+
+        PathFinder finder;
+        size_t finderSteps = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto& [from, to] : queries) {
+            finderSteps += finder.findPath(board, from, to, anyStep).size();
+        }
+        auto middle = std::chrono::high_resolution_clock::now();
+        size_t referenceSteps = 0;
+        for (const auto& [from, to] : queries) {
+            referenceSteps += referencePath(board, from, to, anyStep).size();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double finderTime = std::chrono::duration<double>(middle - start).count();
+        double referenceTime = std::chrono::duration<double>(end - middle).count();
+        const std::string boardSize = std::to_string(size);
+        RecordProperty("replans_per_s_" + boardSize, static_cast<int>(replans / finderTime));
+        RecordProperty("reference_replans_per_s_" + boardSize, static_cast<int>(replans / referenceTime));
+
+        EXPECT_EQ(finderSteps, referenceSteps);
+    }
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,25 @@
+#include "shared_game_board.h"
+
+namespace Algorithm_318835816_211314471 {
+
+SharedGameBoard::SharedGameBoard()
+    : m_board(std::make_shared<GameBoard>()) {}
+
+SharedGameBoard::SharedGameBoard(size_t width, size_t height)
+    : m_board(std::make_shared<GameBoard>(width, height)) {}
+
+SharedGameBoard::SharedGameBoard(const GameBoard& board)
+    : m_board(std::make_shared<GameBoard>(board)) {}
+
+GameBoard& SharedGameBoard::edit() {
+    if (m_board.use_count() > 1) {
+        m_board = std::make_shared<GameBoard>(*m_board);
+    }
+    return *m_board;
+}
+
+bool SharedGameBoard::isSameVersion(const SharedGameBoard& other) const {
+    return m_board == other.m_board;
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "UserCommon/game_board.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class SharedGameBoard
+ * @brief Copy-on-write handle to a game board shared by a player and its tanks.
+ *
+ * Copying the handle shares the board. The player edits its battle info
+ * board through edit(), which first copies the board only if a tank still
+ * holds the current version. A refresh that changes nothing copies nothing,
+ * and one that does costs one board copy however many tanks there are.
+ */
+class SharedGameBoard {
+public:
+    /**
+     * @brief Creates an empty board
+     */
+    SharedGameBoard();
+
+    /**
+     * @brief Creates an empty board of the given size
+     * @param width The width of the board
+     * @param height The height of the board
+     */
+    SharedGameBoard(size_t width, size_t height);
+
+    /**
+     * @brief Takes a copy of an existing board
+     * @param board The board to copy
+     */
+    SharedGameBoard(const GameBoard& board);
+
+    const GameBoard& operator*() const { return *m_board; }
+    const GameBoard* operator->() const { return m_board.get(); }
+
+    /**
+     * @brief Gets the board for writing, detaching it from other holders first.
+     * @return The board owned by this handle alone
+     */
+    GameBoard& edit();
+
+    /**
+     * @brief Checks if two handles share the same version of the board.
+     *
+     * A shared board is never written in place, so handles that share one
+     * hold the same cells and a holder can skip work derived from a board
+     * it already has.
+     *
+     * @param other The handle to compare with
+     * @return true if both reference the same board
+     */
+    bool isSameVersion(const SharedGameBoard& other) const;
+
+private:
+    std::shared_ptr<GameBoard> m_board;
+};
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "battle_info_impl.h"
+#include "shared_game_board.h"
+#include <chrono>
+#include <vector>
+#include <string>
+
+namespace Algorithm_318835816_211314471 {
+
+TEST(SharedGameBoardTest, CopiesShareUntilEdited) {
+    SharedGameBoard board(4, 3);
+    SharedGameBoard tankView = board;
+    EXPECT_TRUE(tankView.isSameVersion(board));
+    EXPECT_EQ(&*tankView, &*board);
+
+    board.edit().setCellType(1, 1, GameBoard::CellType::Wall);
+    EXPECT_FALSE(tankView.isSameVersion(board));
+    EXPECT_TRUE(board->isWall(Point(1, 1)));
+    EXPECT_FALSE(tankView->isWall(Point(1, 1)));
+}
+
+TEST(SharedGameBoardTest, SoleOwnerEditsInPlace) {
+    SharedGameBoard board(4, 3);
+    const GameBoard* before = &*board;
+    board.edit().setCellType(2, 0, GameBoard::CellType::Mine);
+    EXPECT_EQ(&*board, before);
+    EXPECT_TRUE(board->isMine(Point(2, 0)));
+
+    SharedGameBoard fromCopy(*board);
+    EXPECT_FALSE(fromCopy.isSameVersion(board));
+    EXPECT_TRUE(fromCopy->isMine(Point(2, 0)));
+}
+
+TEST(SharedGameBoardTest, BattleInfoKeepsSharingUnchangedBoard) {
+    BattleInfoImpl info(5, 5);
+    info.setCellType(0, 0, GameBoard::CellType::Wall);
+    std::vector<SharedGameBoard> tanks(4, info.getSharedGameBoard());
+
+    // A refresh writing the same cells keeps every tank on the same board
+    for (int y = 0; y < 5; ++y) {
+        for (int x = 0; x < 5; ++x) {
+            info.setCellType(x, y, info.getCellType(x, y));
+        }
+    }
+    for (const auto& tank : tanks) {
+        EXPECT_TRUE(tank.isSameVersion(info.getSharedGameBoard()));
+    }
+
+    // A change gives the player one new board, the tanks keep theirs
+    info.setCellType(0, 0, GameBoard::CellType::Empty);
+    EXPECT_FALSE(tanks[0].isSameVersion(info.getSharedGameBoard()));
+    EXPECT_TRUE(tanks[0].isSameVersion(tanks[3]));
+    EXPECT_TRUE(tanks[0]->isWall(Point(0, 0)));
+    EXPECT_FALSE(info.getGameBoard().isWall(Point(0, 0)));
+}
+
+TEST(SharedGameBoardTest, DISABLED_Benchmark_RefreshManyTanks) {
+    const size_t size = 500;
+    const size_t tankCount = 16;
+    const int refreshes = 20;
+    BattleInfoImpl info(size, size);
+    for (size_t i = 0; i < size; i += 7) {
+        info.setCellType(static_cast<int>(i), static_cast<int>((i * 13) % size), GameBoard::CellType::Wall);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<GameBoard> copies(tankCount);
+    for (int refresh = 0; refresh < refreshes; ++refresh) {
+        for (auto& copy : copies) {
+            copy = info.getGameBoard();
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    std::vector<SharedGameBoard> shared(tankCount);
+    for (int refresh = 0; refresh < refreshes; ++refresh) {
+        // One wall shot away per refresh
+        info.setCellType(static_cast<int>(refresh * 7), static_cast<int>((refresh * 7 * 13) % size),
+                         GameBoard::CellType::Empty);
+        for (auto& board : shared) {
+            board = info.getSharedGameBoard();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double copyTime = std::chrono::duration<double>(middle - start).count();
+    double sharedTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("copies_ms", std::to_string(copyTime * 1000));
+    RecordProperty("shared_ms", std::to_string(sharedTime * 1000));
+
+    for (const auto& board : shared) {
+        EXPECT_TRUE(board.isSameVersion(info.getSharedGameBoard()));
+    }
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,48 @@
+#include "shell_danger_map.h"
+
+#include "UserCommon/utils/direction.h"
+
+namespace Algorithm_318835816_211314471 {
+
+void ShellDangerMap::build(const GameBoard& board, const std::vector<Point>& shells,
+                           const LineOfSightTable& lineOfSight) {
+    m_width = static_cast<int>(board.getWidth());
+    m_height = static_cast<int>(board.getHeight());
+    m_dangerSteps.assign(static_cast<size_t>(m_width) * static_cast<size_t>(m_height), 0);
+    if (m_width == 0 || m_height == 0) {
+        return;
+    }
+
+    for (const Point& shellPosition : shells) {
+        const Point shell = board.wrapPosition(shellPosition);
+        for (const Direction& dir : ALL_DIRECTIONS) {
+            TorusRay ray = board.rayFrom(shell, dir);
+            bool open = true;
+            for (int step = 1; step <= DANGER_STEPS; ++step) {
+                const Point current = *++ray;
+                // Wrapping back onto the shell's own cell is always seen
+                if (open || current == shell) {
+                    m_dangerSteps[ray.getIndex()] |= static_cast<uint8_t>(1 << (step - 1));
+                }
+                if (board.getCellTypeUnchecked(current) == GameBoard::CellType::Wall ||
+                    lineOfSight.isTankAt(current)) {
+                    open = false;
+                }
+            }
+        }
+    }
+}
+
+uint8_t ShellDangerMap::getDangerSteps(const Point& position) const {
+    if (position.getX() < 0 || position.getX() >= m_width ||
+        position.getY() < 0 || position.getY() >= m_height) {
+        return 0;
+    }
+    return m_dangerSteps[position.getY() * m_width + position.getX()];
+}
+
+bool ShellDangerMap::isInDanger(const Point& position) const {
+    return getDangerSteps(position) != 0;
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "line_of_sight_table.h"
+#include "UserCommon/game_board.h"
+#include "UserCommon/utils/point.h"
+
+using namespace UserCommon_318835816_211314471;
+
+namespace Algorithm_318835816_211314471 {
+
+/**
+ * @class ShellDangerMap
+ * @brief Per-cell record of when known shells may pass, built once per board update.
+ *
+ * A shell's direction is not known, so each shell is followed in all eight
+ * directions for DANGER_STEPS steps. Every cell it reaches before hitting a
+ * wall or tank gets the bit of that step set; the blocking cell itself is
+ * still reached. Safety checks then read one byte instead of walking rays.
+ */
+class ShellDangerMap {
+public:
+    // Steps ahead of a shell that count as danger
+    static constexpr int DANGER_STEPS = 3;
+
+    /**
+     * @brief Rebuilds the map for the known shells.
+     * @param board The known game board
+     * @param shells Positions of the known shells
+     * @param lineOfSight Line-of-sight table of the same board, for its tanks
+     */
+    void build(const GameBoard& board, const std::vector<Point>& shells,
+               const LineOfSightTable& lineOfSight);
+
+    /**
+     * @brief Gets the steps at which a shell may reach a cell.
+     * @param position The position to check, outside the board is never reached
+     * @return Bit (step - 1) is set if a shell may be there after that many steps
+     */
+    uint8_t getDangerSteps(const Point& position) const;
+
+    /**
+     * @brief Checks if any shell may reach a cell within DANGER_STEPS steps.
+     * @param position The position to check
+     * @return true if the position is in danger
+     */
+    bool isInDanger(const Point& position) const;
+
+private:
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<uint8_t> m_dangerSteps;
+};
+
+} // namespace Algorithm_318835816_211314471
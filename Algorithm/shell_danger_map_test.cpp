@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+#include "shell_danger_map.h"
+#include "UserCommon/utils/direction.h"
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Algorithm_318835816_211314471 {
+
+class ShellDangerMapTest : public ::testing::Test {
+protected:
+    static GameBoard makeBoard(const std::vector<std::string>& lines) {
+        GameBoard board(lines[0].size(), lines.size());
+        std::vector<std::pair<int, Point>> tankPositions;
+        board.initialize(lines, tankPositions);
+        return board;
+    }
+
+    static GameBoard makeRandomBoard(size_t width, size_t height, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::vector<std::string> lines(height, std::string(width, ' '));
+        for (auto& line : lines) {
+            for (char& cell : line) {
+                cell = rng() % 5 == 0 ? '#' : ' ';
+            }
+        }
+        return makeBoard(lines);
+    }
+
+    // The per-query check the map replaces
+    static bool walkDanger(const GameBoard& board, const LineOfSightTable& lineOfSight,
+                           const std::vector<Point>& shells, const Point& position) {
+        for (const Point& shellPos : shells) {
+            if (GameBoard::stepDistance(shellPos, position, board.getWidth(), board.getHeight()) > 4) {
+                continue;
+            }
+            for (const Direction& dir : ALL_DIRECTIONS) {
+                if (!lineOfSight.hasLineOfSight(shellPos, position, dir)) continue;
+                Point current = shellPos;
+                for (int step = 1; step < 4; ++step) {
+                    current = board.wrapPosition(current + getDirectionDelta(dir));
+                    if (current == position) {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(ShellDangerMapTest, StepsAlongEachDirection) {
+    GameBoard board = makeBoard({
+        "         ",
+        "         ",
+        "         ",
+        "         ",
+        "         ",
+        "         ",
+        "         "
+    });
+    LineOfSightTable lineOfSight;
+    lineOfSight.build(board, {}, {});
+    ShellDangerMap map;
+    map.build(board, {Point(4, 3)}, lineOfSight);
+
+    EXPECT_EQ(map.getDangerSteps(Point(5, 3)), 0b001);
+    EXPECT_EQ(map.getDangerSteps(Point(6, 3)), 0b010);
+    EXPECT_EQ(map.getDangerSteps(Point(7, 3)), 0b100);
+    EXPECT_EQ(map.getDangerSteps(Point(8, 3)), 0);
+    EXPECT_EQ(map.getDangerSteps(Point(2, 1)), 0b010);
+    EXPECT_FALSE(map.isInDanger(Point(4, 3)));
+    EXPECT_FALSE(map.isInDanger(Point(5, 5)));
+    EXPECT_FALSE(map.isInDanger(Point(40, 3)));
+}
+
+TEST_F(ShellDangerMapTest, WallsAndTanksStopTheShell) {
+    GameBoard board = makeBoard({
+        "       ",
+        " #     ",
+        "       "
+    });
+    LineOfSightTable lineOfSight;
+    lineOfSight.build(board, {Point(6, 1)}, {});
+    ShellDangerMap map;
+    map.build(board, {Point(0, 1)}, lineOfSight);
+
+    // The wall and the tank are hit, nothing behind them
+    EXPECT_EQ(map.getDangerSteps(Point(1, 1)), 0b001);
+    EXPECT_FALSE(map.isInDanger(Point(2, 1)));
+    EXPECT_EQ(map.getDangerSteps(Point(6, 1)), 0b001);
+    EXPECT_FALSE(map.isInDanger(Point(5, 1)));
+    // Wrapping around the short column back onto the shell
+    EXPECT_EQ(map.getDangerSteps(Point(0, 1)), 0b100);
+}
+
+TEST_F(ShellDangerMapTest, MatchesPerQueryWalkOnRandomBoards) {
+    const std::vector<std::pair<size_t, size_t>> sizes = {{9, 7}, {3, 2}, {12, 12}, {1, 4}, {5, 3}};
+    for (size_t seed = 0; seed < sizes.size(); ++seed) {
+        auto [width, height] = sizes[seed];
+        GameBoard board = makeRandomBoard(width, height, static_cast<unsigned>(seed));
+        std::mt19937 rng(static_cast<unsigned>(seed) + 10);
+        std::vector<Point> tanks;
+        std::vector<Point> shells;
+        for (int i = 0; i < 3; ++i) {
+            tanks.emplace_back(rng() % width, rng() % height);
+            shells.emplace_back(rng() % width, rng() % height);
+        }
+
+        LineOfSightTable lineOfSight;
+        lineOfSight.build(board, tanks, {});
+        ShellDangerMap map;
+        map.build(board, shells, lineOfSight);
+
+        for (size_t cell = 0; cell < width * height; ++cell) {
+            Point position(cell % width, cell / width);
+            ASSERT_EQ(map.isInDanger(position), walkDanger(board, lineOfSight, shells, position))
+                << width << "x" << height << " " << position;
+        }
+    }
+}
+
+TEST_F(ShellDangerMapTest, DISABLED_Benchmark_SafetyQueries) {
+    GameBoard board = makeRandomBoard(200, 200, 3);
+    std::mt19937 rng(8);
+    std::vector<Point> shells;
+    for (int i = 0; i < 60; ++i) {
+        shells.emplace_back(rng() % 200, rng() % 200);
+    }
+    std::vector<Point> queries;
+    for (int i = 0; i < 20000; ++i) {
+        queries.emplace_back(rng() % 200, rng() % 200);
+    }
+    LineOfSightTable lineOfSight;
+    lineOfSight.build(board, {}, {});
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ShellDangerMap map;
+    map.build(board, shells, lineOfSight);
+    size_t mapHits = 0;
+    for (const Point& position : queries) {
+        mapHits += map.isInDanger(position);
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    size_t walkHits = 0;
+    for (const Point& position : queries) {
+        walkHits += walkDanger(board, lineOfSight, shells, position);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double mapTime = std::chrono::duration<double>(middle - start).count();
+    double walkTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("map_ms", std::to_string(mapTime * 1000));
+    RecordProperty("walk_ms", std::to_string(walkTime * 1000));
+
+    EXPECT_EQ(mapHits, walkHits);
+}
+
+} // namespace Algorithm_318835816_211314471
@@ -16,6 +16,7 @@ TestBasicPlayer::TestBasicPlayer(int playerIndex, size_t x, size_t y, size_t max
       m_numShells(numShells),
       // Cast to int as BattleInfoImpl constructor expects int parameters for board dimensions
       m_battleInfo(static_cast<int>(x), static_cast<int>(y)) {
+    m_battleInfo.setInitialShells(static_cast<int>(numShells));
 }
 
 TestBasicPlayer::~TestBasicPlayer() = default;
@@ -16,7 +16,7 @@ TestBasicTankAlgorithm::TestBasicTankAlgorithm(int playerId, int tankIndex)
     : m_playerId(playerId), m_tankIndex(tankIndex), m_gameBoard(5, 5) {
     m_trackedPosition = Point(0, 0);
     m_trackedDirection = getInitialDirection(playerId);
-    m_trackedShells = Tank::INITIAL_SHELLS;
+    m_trackedShells = Tank::DEFAULT_INITIAL_SHELLS;
     m_trackedCooldown = 0;
     m_turnsSinceLastUpdate = 4;
 }
@@ -72,6 +72,11 @@ ActionRequest TestBasicTankAlgorithm::getAction() {
 void TestBasicTankAlgorithm::updateBattleInfo(BattleInfo& info) {
     m_turnsSinceLastUpdate = 0;
     auto& impl = dynamic_cast<TestBattleInfoImpl&>(info);
+    if (!m_hasBattleInfo) {
+        // The shells of this game are first known here, the first action asks for battle info
+        m_trackedShells = impl.getInitialShells();
+        m_hasBattleInfo = true;
+    }
     m_trackedPosition = impl.getOwnTankPosition();
     m_gameBoard = impl.getGameBoard();
     m_enemyTanks = impl.getEnemyTankPositions();
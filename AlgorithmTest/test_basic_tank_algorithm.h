@@ -82,7 +82,8 @@ protected:
     // State tracking for position, direction, shells, and cooldown
     Point m_trackedPosition;
     Direction m_trackedDirection;
-    int m_trackedShells = Tank::INITIAL_SHELLS;
+    int m_trackedShells = Tank::DEFAULT_INITIAL_SHELLS;
+    bool m_hasBattleInfo = false;
     int m_trackedCooldown = 0;
 
     // Known game state
@@ -64,4 +64,12 @@ const Point& TestBattleInfoImpl::getOwnTankPosition() const {
     return m_ownTankPosition;
 }
 
+void TestBattleInfoImpl::setInitialShells(int shells) {
+    m_initialShells = shells;
+}
+
+int TestBattleInfoImpl::getInitialShells() const {
+    return m_initialShells;
+}
+
 } // namespace Algorithm_098765432_123456789 
\ No newline at end of file
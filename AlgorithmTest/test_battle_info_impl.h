@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "UserCommon/game_board.h"
+#include "UserCommon/objects/tank.h"
 #include "UserCommon/utils/point.h"
 #include "common/BattleInfo.h"
 
@@ -39,6 +40,10 @@ public:
     
     void setOwnTankPosition(const Point& pos);
     const Point& getOwnTankPosition() const;
+
+    // Shells each tank starts the game with
+    void setInitialShells(int shells);
+    int getInitialShells() const;
     
 private:
     int m_boardWidth;
@@ -48,6 +53,7 @@ private:
     std::vector<Point> m_friendlyTankPositions;
     std::vector<Point> m_shellPositions;
     Point m_ownTankPosition;
+    int m_initialShells = Tank::DEFAULT_INITIAL_SHELLS;
 };
 
 } // namespace TestAlgorithm_098765432_123456789
\ No newline at end of file
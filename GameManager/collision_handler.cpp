@@ -1,4 +1,4 @@
-#include <map>
+#include <algorithm>
 
 #include "collision_handler.h"
 
@@ -6,21 +6,45 @@ namespace GameManager_318835816_211314471 {
 
 using namespace UserCommon_318835816_211314471;
 
+void CollisionHandler::StampedCounters::resize(size_t size) {
+  m_entries.assign(size, Entry());
+  m_generation = 1;
+}
+
+void CollisionHandler::StampedCounters::clear() {
+  if (++m_generation == 0) {
+    // Generation wrapped around, stale entries could match again
+    std::fill(m_entries.begin(), m_entries.end(), Entry());
+    m_generation = 1;
+  }
+}
+
+int CollisionHandler::StampedCounters::get(size_t index) const {
+  const Entry& entry = m_entries[index];
+  return entry.generation == m_generation ? entry.count : 0;
+}
+
+int CollisionHandler::StampedCounters::increment(size_t index) {
+  Entry& entry = m_entries[index];
+  if (entry.generation != m_generation) {
+    entry.generation = m_generation;
+    entry.count = 0;
+  }
+  return ++entry.count;
+}
+
 void CollisionHandler::resolveAllCollisions(
   std::vector<Tank>& tanks,
   std::vector<Shell>& shells,
   GameBoard& board
 ) {
-  m_positionExplosions.clear();
-  m_pathExplosions.clear();
-  m_boardWidth = board.getWidth();
-  m_boardHeight = board.getHeight();
+  prepareGrids(board.getWidth(), board.getHeight());
 
   detectPathCollisions(tanks, shells);
   applyPathExplosions(tanks, shells);
 
   checkShellWallCollisions(shells, board);
-  
+
   detectPositionCollisions(tanks, shells);
   applyPositionExplosions(tanks, shells, board);
 
@@ -29,71 +53,132 @@ void CollisionHandler::resolveAllCollisions(
   return;
 }
 
+void CollisionHandler::prepareGrids(int width, int height) {
+  if (width != m_boardWidth || height != m_boardHeight) {
+    m_boardWidth = width;
+    m_boardHeight = height;
+    size_t cells = static_cast<size_t>(width) * height;
+    m_positionCounts.resize(cells);
+    m_positionMarks.resize(cells);
+    m_pathCounts.resize(cells * 4);
+    m_pathMarks.resize(cells * 4);
+  }
+  m_positionMarks.clear();
+  m_pathMarks.clear();
+  m_positionExplosions.clear();
+  m_pathExplosions.clear();
+}
+
+std::optional<size_t> CollisionHandler::positionIndex(const Point& pos) const {
+  int x = pos.getX();
+  int y = pos.getY();
+  if (x < 0 || y < 0 || x >= m_boardWidth || y >= m_boardHeight) {
+    return std::nullopt;
+  }
+  return static_cast<size_t>(y) * m_boardWidth + x;
+}
+
+std::optional<size_t> CollisionHandler::pathIndex(const MidPoint& mp) const {
+  int x = mp.getX();
+  int y = mp.getY();
+  if (x < 0 || y < 0 || x >= m_boardWidth || y >= m_boardHeight) {
+    return std::nullopt;
+  }
+  size_t doubledX = 2 * static_cast<size_t>(x) + (mp.isHalfX() ? 1 : 0);
+  size_t doubledY = 2 * static_cast<size_t>(y) + (mp.isHalfY() ? 1 : 0);
+  return doubledY * (2 * static_cast<size_t>(m_boardWidth)) + doubledX;
+}
+
+int CollisionHandler::countPositionAt(const Point& pos) {
+  if (auto index = positionIndex(pos)) {
+    return m_positionCounts.increment(*index);
+  }
+  for (auto& [point, count] : m_overflowPositionCounts) {
+    if (point == pos) {
+      return ++count;
+    }
+  }
+  m_overflowPositionCounts.emplace_back(pos, 1);
+  return 1;
+}
+
+int CollisionHandler::countPathAt(const MidPoint& mp) {
+  if (auto index = pathIndex(mp)) {
+    return m_pathCounts.increment(*index);
+  }
+  for (auto& [midpoint, count] : m_overflowPathCounts) {
+    if (midpoint == mp) {
+      return ++count;
+    }
+  }
+  m_overflowPathCounts.emplace_back(mp, 1);
+  return 1;
+}
+
+bool CollisionHandler::isPositionExplosionAt(const Point& pos) const {
+  if (auto index = positionIndex(pos)) {
+    return m_positionMarks.get(*index) > 0;
+  }
+  return std::find(m_positionExplosions.begin(), m_positionExplosions.end(),
+                   pos) != m_positionExplosions.end();
+}
+
+bool CollisionHandler::isPathExplosionAt(const MidPoint& mp) const {
+  if (auto index = pathIndex(mp)) {
+    return m_pathMarks.get(*index) > 0;
+  }
+  return std::find(m_pathExplosions.begin(), m_pathExplosions.end(),
+                   mp) != m_pathExplosions.end();
+}
 
 void CollisionHandler::detectPathCollisions(
   std::vector<Tank>& tanks,
   std::vector<Shell>& shells
 ) {
-  struct MovingObject {
-      Point prev;
-      Point curr;
+  m_pathCounts.clear();
+  m_overflowPathCounts.clear();
+
+  // Objects crossing paths (X→Y and Y→X) share the same midpoint
+  auto countPath = [this](const GameObject& object) {
+    MidPoint mp = MidPoint::calculateMidpoint(
+        object.getPreviousPosition(),
+        object.getPosition(),
+        m_boardWidth,
+        m_boardHeight
+    );
+    if (countPathAt(mp) == 2) {
+      markPathExplosionAt(mp);
+    }
   };
 
-  std::vector<MovingObject> objects;
-
-  for (Tank& tank : tanks) {
+  for (const Tank& tank : tanks) {
       if (!tank.isDestroyed()) {
-          objects.push_back({
-              tank.getPreviousPosition(),
-              tank.getPosition(),
-          });
+          countPath(tank);
       }
   }
 
-  for (Shell& shell : shells) {
+  for (const Shell& shell : shells) {
       if (!shell.isDestroyed()) {
-          objects.push_back({
-              shell.getPreviousPosition(),
-              shell.getPosition(),
-          });
-      }
-  }
-
-  // Check for position swaps (X→Y and Y→X)
-  const size_t n = objects.size();
-  for (size_t i = 0; i < n; ++i) {
-      for (size_t j = i + 1; j < n; ++j) {
-          if (MidPoint::midpointsMatch(
-                      objects[i].prev, objects[i].curr,
-                      objects[j].prev, objects[j].curr,
-                      m_boardWidth, m_boardHeight)) {
-
-              markPathExplosionAt(objects[i].prev, objects[i].curr);
-          }
+          countPath(shell);
       }
   }
 }
 
 void CollisionHandler::detectPositionCollisions(std::vector<Tank>& tanks,
                                                 std::vector<Shell>& shells) {
-    std::map<Point, int> positionCounts;
+    m_positionCounts.clear();
+    m_overflowPositionCounts.clear();
 
+    // Any position with 2+ things is a collision
     for (const Tank& tank : tanks) {
-        if (!tank.isDestroyed()) {
-            positionCounts[tank.getPosition()]++;
+        if (!tank.isDestroyed() && countPositionAt(tank.getPosition()) == 2) {
+            markPositionExplosionAt(tank.getPosition());
         }
     }
 
     for (const Shell& shell : shells) {
-        if (!shell.isDestroyed()) {
-            positionCounts[shell.getPosition()]++;
-        }
-    }
-
-    // Any position with 2+ things is a collision
-    for (const auto& [pos, count] : positionCounts) {
-        if (count >= 2) {
-            markPositionExplosionAt(pos);
+        if (!shell.isDestroyed() && countPositionAt(shell.getPosition()) == 2) {
+            markPositionExplosionAt(shell.getPosition());
         }
     }
 }
@@ -114,7 +199,7 @@ void CollisionHandler::checkShellWallCollisions(
 }
 
 void CollisionHandler::checkTankMineCollisions(
-    std::vector<Tank>& tanks, 
+    std::vector<Tank>& tanks,
     GameBoard& board
   ) {
   for (Tank& tank : tanks) {
@@ -132,17 +217,20 @@ void CollisionHandler::checkTankMineCollisions(
 
 void CollisionHandler::applyPathExplosions(std::vector<Tank>& tanks,
                                            std::vector<Shell>& shells) {
+    if (m_pathExplosions.empty()) {
+      return;
+    }
+
     for (Tank& tank : tanks) {
         if (!tank.isDestroyed()) {
           MidPoint tankPath = MidPoint::calculateMidpoint(
-              tank.getPreviousPosition(), 
+              tank.getPreviousPosition(),
               tank.getPosition(),
               m_boardWidth,
               m_boardHeight
           );
-          
-          if (tankPath.getX() != -1 && 
-                m_pathExplosions.find(tankPath) != m_pathExplosions.end()) {
+
+          if (tankPath.getX() != -1 && isPathExplosionAt(tankPath)) {
               tank.destroy();
           }
         }
@@ -151,14 +239,13 @@ void CollisionHandler::applyPathExplosions(std::vector<Tank>& tanks,
     for (Shell& shell : shells) {
         if (!shell.isDestroyed()) {
           MidPoint shellPath = MidPoint::calculateMidpoint(
-              shell.getPreviousPosition(), 
+              shell.getPreviousPosition(),
               shell.getPosition(),
               m_boardWidth,
               m_boardHeight
           );
-          
-          if (shellPath.getX() != -1 && 
-              m_pathExplosions.find(shellPath) != m_pathExplosions.end()) {
+
+          if (shellPath.getX() != -1 && isPathExplosionAt(shellPath)) {
               shell.destroy();
           }
         }
@@ -170,21 +257,19 @@ void CollisionHandler::applyPathExplosions(std::vector<Tank>& tanks,
 void CollisionHandler::applyPositionExplosions(std::vector<Tank>& tanks,
                                                std::vector<Shell>& shells,
                                                GameBoard& board) {
+    if (m_positionExplosions.empty()) {
+      return;
+    }
+
     for (Tank& tank : tanks) {
-        if (!tank.isDestroyed()) {
-          if (m_positionExplosions.find(tank.getPosition()) != 
-                                                m_positionExplosions.end()) {
+        if (!tank.isDestroyed() && isPositionExplosionAt(tank.getPosition())) {
             tank.destroy();
-          }
         }
     }
 
     for (Shell& shell : shells) {
-        if (!shell.isDestroyed()) {
-          if (m_positionExplosions.find(shell.getPosition()) != 
-                                                m_positionExplosions.end()) {
+        if (!shell.isDestroyed() && isPositionExplosionAt(shell.getPosition())) {
             shell.destroy();
-          }
         }
     }
 
@@ -198,15 +283,33 @@ void CollisionHandler::applyPositionExplosions(std::vector<Tank>& tanks,
 }
 
 void CollisionHandler::markPositionExplosionAt(const Point& pos) {
-  m_positionExplosions.insert(pos);
+  if (auto index = positionIndex(pos)) {
+    if (m_positionMarks.increment(*index) > 1) {
+      return;
+    }
+  } else if (isPositionExplosionAt(pos)) {
+    return;
+  }
+  m_positionExplosions.push_back(pos);
 }
 
 void CollisionHandler::markPathExplosionAt(const Point& from, const Point& to) {
-    MidPoint mp = 
-          MidPoint::calculateMidpoint(from, to, m_boardWidth, m_boardHeight);
-    if (mp.getX() != -1) {
-      m_pathExplosions.insert(mp);
+    markPathExplosionAt(
+          MidPoint::calculateMidpoint(from, to, m_boardWidth, m_boardHeight));
+}
+
+void CollisionHandler::markPathExplosionAt(const MidPoint& mp) {
+  if (mp.getX() == -1) {
+    return;
+  }
+  if (auto index = pathIndex(mp)) {
+    if (m_pathMarks.increment(*index) > 1) {
+      return;
     }
+  } else if (isPathExplosionAt(mp)) {
+    return;
+  }
+  m_pathExplosions.push_back(mp);
 }
 
 } // namespace GameManager_318835816_211314471
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <set>
+#include <cstdint>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "game_board.h"
@@ -19,6 +21,11 @@ using namespace UserCommon_318835816_211314471;
  * Handles different types of collisions including path crossings, 
  * same position collisions, shell-wall interactions, and tank-mine
  * interactions.
+ * 
+ * Positions and path midpoints are tracked in flat per-board grids that
+ * are kept between calls and cleared in constant time, so resolving a
+ * step is linear in the number of objects and allocation free once the
+ * grids have been sized for the board.
  */
 class CollisionHandler {
 public:
@@ -39,11 +46,72 @@ public:
     );
 
 private:
-    std::set<MidPoint> m_pathExplosions;   
-    std::set<Point> m_positionExplosions;
-    int m_boardWidth;
-    int m_boardHeight;
+    /**
+     * @brief Flat per-cell counters that can be cleared in constant time
+     * 
+     * Each entry carries the generation it was last written in; entries
+     * from older generations read as zero.
+     */
+    class StampedCounters {
+    public:
+        // Resizes to the given number of cells, all counters reset
+        void resize(size_t size);
+
+        // Resets all counters to zero
+        void clear();
+
+        // Gets the counter of a cell
+        int get(size_t index) const;
+
+        // Increments the counter of a cell and returns the new value
+        int increment(size_t index);
+
+    private:
+        struct Entry {
+            uint32_t generation = 0;
+            int count = 0;
+        };
+        std::vector<Entry> m_entries;
+        uint32_t m_generation = 1;
+    };
+
+    // Grids sized for the current board. Path grids use doubled
+    // coordinates so that half steps get their own cell.
+    StampedCounters m_positionCounts;
+    StampedCounters m_positionMarks;
+    StampedCounters m_pathCounts;
+    StampedCounters m_pathMarks;
 
+    // Counters for coordinates outside the board (not expected in game flow)
+    std::vector<std::pair<Point, int>> m_overflowPositionCounts;
+    std::vector<std::pair<MidPoint, int>> m_overflowPathCounts;
+
+    // Explosions marked since the last resolveAllCollisions call
+    std::vector<MidPoint> m_pathExplosions;
+    std::vector<Point> m_positionExplosions;
+    int m_boardWidth = 0;
+    int m_boardHeight = 0;
+
+    // Sizes the grids for the board and clears marked explosions
+    void prepareGrids(int width, int height);
+
+    // Gets the grid index of a position, if it lies on the board
+    std::optional<size_t> positionIndex(const Point& pos) const;
+
+    // Gets the grid index of a path midpoint, if it lies on the board
+    std::optional<size_t> pathIndex(const MidPoint& mp) const;
+
+    // Counts an object at a position and returns the number counted so far
+    int countPositionAt(const Point& pos);
+
+    // Counts an object on a path and returns the number counted so far
+    int countPathAt(const MidPoint& mp);
+
+    // Checks if a position was marked for explosion
+    bool isPositionExplosionAt(const Point& pos) const;
+
+    // Checks if a path midpoint was marked for explosion
+    bool isPathExplosionAt(const MidPoint& mp) const;
 
     // Detects path collisions caused by object crossing paths
     void detectPathCollisions(
@@ -90,6 +158,9 @@ private:
     // Marks a path for explosion between two points
     void markPathExplosionAt(const Point& from, const Point& to);
 
+    // Marks a path midpoint for explosion
+    void markPathExplosionAt(const MidPoint& mp);
+
     // For Test purposes
     friend class CollisionHandlerTest;
 };
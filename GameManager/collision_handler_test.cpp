@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <set>
+
 #include "gtest/gtest.h"
 #include "collision_handler.h"
 #include "objects/tank.h"
 #include "objects/shell.h"
 #include "game_board.h"
 #include "utils/direction.h"
+#include "test/helpers/reference_collision_handler.h"
 
 namespace GameManager_318835816_211314471 {
 
@@ -13,13 +19,35 @@ class CollisionHandlerTest : public ::testing::Test {
 protected:
     CollisionHandler handler;
     GameBoard board{10, 10};
+    mutable std::set<MidPoint> pathExplosionsView;
+    mutable std::set<Point> positionExplosionsView;
 
+    // Explosions are exposed as sets; the cached copy is only replaced when
+    // it changed, so references taken within one expression stay valid
     const std::set<MidPoint>& getPathExplosions() const {
-        return handler.m_pathExplosions;
+        std::set<MidPoint> current = handlerPathExplosions(handler);
+        if (current != pathExplosionsView) {
+            pathExplosionsView = std::move(current);
+        }
+        return pathExplosionsView;
     }
 
     const std::set<Point>& getPositionExplosions() const {
-      return handler.m_positionExplosions;
+      std::set<Point> current = handlerPositionExplosions(handler);
+      if (current != positionExplosionsView) {
+          positionExplosionsView = std::move(current);
+      }
+      return positionExplosionsView;
+    }
+
+    static std::set<MidPoint> handlerPathExplosions(const CollisionHandler& other) {
+        return std::set<MidPoint>(other.m_pathExplosions.begin(),
+                                  other.m_pathExplosions.end());
+    }
+
+    static std::set<Point> handlerPositionExplosions(const CollisionHandler& other) {
+        return std::set<Point>(other.m_positionExplosions.begin(),
+                               other.m_positionExplosions.end());
     }
 
     void markPathExplosion(const Point& from, const Point& to) {
@@ -706,4 +734,214 @@ TEST_F(CollisionHandlerTest, DetectPathCrossings_NonAdjacentPaths_NoExplosion) {
   EXPECT_FALSE(tanks[1].isDestroyed());
 }
 
+// Differential tests against the reference resolver
+
+namespace {
+
+// Random but reproducible game: tanks wander, shoot and swap places on a
+// small crowded board, so every collision kind happens frequently
+class RandomGameRecorder {
+public:
+    RandomGameRecorder(unsigned int seed, int width, int height)
+        : m_rng(seed), m_board(width, height), m_width(width), m_height(height) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int roll = randomInt(0, 99);
+                if (roll < 15) {
+                    m_board.setCellType(x, y, GameBoard::CellType::Wall);
+                } else if (roll < 22) {
+                    m_board.setCellType(x, y, GameBoard::CellType::Mine);
+                }
+            }
+        }
+        int tankCount = randomInt(2, 9);
+        for (int i = 0; i < tankCount; ++i) {
+            m_tanks.emplace_back(i % 2 + 1, randomPoint(), randomDirection());
+        }
+    }
+
+    GameBoard& board() { return m_board; }
+    std::vector<Tank>& tanks() { return m_tanks; }
+    std::vector<Shell>& shells() { return m_shells; }
+
+    // Advances shells one cell, as the game manager does every half step
+    void moveShells() {
+        for (Shell& shell : m_shells) {
+            if (!shell.isDestroyed()) {
+                shell.setPosition(offBoardOrWrapped(
+                    shell.getPosition() + getDirectionDelta(shell.getDirection())));
+            }
+        }
+    }
+
+    // Applies a random action to every live tank
+    void moveTanks() {
+        for (size_t i = 0; i < m_tanks.size(); ++i) {
+            Tank& tank = m_tanks[i];
+            if (tank.isDestroyed()) {
+                continue;
+            }
+            int roll = randomInt(0, 9);
+            if (roll < 4) {
+                Point delta = getDirectionDelta(randomDirection());
+                tank.setPosition(offBoardOrWrapped(tank.getPosition() + delta));
+            } else if (roll < 6) {
+                m_shells.emplace_back(tank.getPlayerId(), tank.getPosition(),
+                                      tank.getDirection());
+                tank.updatePreviousPosition();
+            } else if (roll < 7 && i + 1 < m_tanks.size() &&
+                       !m_tanks[i + 1].isDestroyed()) {
+                // Swap places with the next tank
+                Point other = m_tanks[i + 1].getPosition();
+                m_tanks[i + 1].setPosition(tank.getPosition());
+                tank.setPosition(other);
+            } else {
+                tank.updatePreviousPosition();
+            }
+        }
+    }
+
+    void removeDestroyedShells() {
+        m_shells.erase(std::remove_if(m_shells.begin(), m_shells.end(),
+                                      [](const Shell& shell) { return shell.isDestroyed(); }),
+                       m_shells.end());
+    }
+
+private:
+    int randomInt(int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(m_rng);
+    }
+
+    Point randomPoint() {
+        return Point(randomInt(0, m_width - 1), randomInt(0, m_height - 1));
+    }
+
+    Direction randomDirection() {
+        return ALL_DIRECTIONS[randomInt(0, 7)];
+    }
+
+    // Mostly wrapped positions, with a few left just off the board to
+    // cover coordinates outside the collision grids
+    Point offBoardOrWrapped(const Point& pos) {
+        if (randomInt(0, 49) == 0) {
+            return pos;
+        }
+        return m_board.wrapPosition(pos);
+    }
+
+    std::mt19937 m_rng;
+    GameBoard m_board;
+    std::vector<Tank> m_tanks;
+    std::vector<Shell> m_shells;
+    int m_width;
+    int m_height;
+};
+
+} // namespace
+
+TEST_F(CollisionHandlerTest, ResolveAll_MatchesReferenceOnRandomGames) {
+    const int games = 200;
+    const int steps = 60;
+    int pathExplosions = 0;
+    int positionExplosions = 0;
+
+    for (int game = 0; game < games; ++game) {
+        SCOPED_TRACE("game seed " + std::to_string(game));
+        RandomGameRecorder recorder(game, 4 + game % 9, 3 + game % 7);
+        CollisionHandler fastHandler;
+        ReferenceCollisionHandler referenceHandler;
+
+        for (int halfStep = 0; halfStep < steps * 2; ++halfStep) {
+            if (halfStep % 2 == 1) {
+                recorder.moveTanks();
+            }
+            recorder.moveShells();
+
+            std::vector<Tank> referenceTanks = recorder.tanks();
+            std::vector<Shell> referenceShells = recorder.shells();
+            GameBoard referenceBoard = recorder.board();
+            referenceHandler.resolveAllCollisions(referenceTanks, referenceShells,
+                                                  referenceBoard);
+            fastHandler.resolveAllCollisions(recorder.tanks(), recorder.shells(),
+                                             recorder.board());
+
+            SCOPED_TRACE("half step " + std::to_string(halfStep));
+            ASSERT_EQ(handlerPathExplosions(fastHandler),
+                      referenceHandler.getPathExplosions());
+            ASSERT_EQ(handlerPositionExplosions(fastHandler),
+                      referenceHandler.getPositionExplosions());
+            ASSERT_EQ(recorder.board().toString(), referenceBoard.toString());
+            for (size_t i = 0; i < referenceTanks.size(); ++i) {
+                ASSERT_EQ(recorder.tanks()[i].isDestroyed(),
+                          referenceTanks[i].isDestroyed()) << "tank " << i;
+            }
+            for (size_t i = 0; i < referenceShells.size(); ++i) {
+                ASSERT_EQ(recorder.shells()[i].isDestroyed(),
+                          referenceShells[i].isDestroyed()) << "shell " << i;
+            }
+            for (int y = 0; y < static_cast<int>(referenceBoard.getHeight()); ++y) {
+                for (int x = 0; x < static_cast<int>(referenceBoard.getWidth()); ++x) {
+                    ASSERT_EQ(recorder.board().getWallHealth(Point(x, y)),
+                              referenceBoard.getWallHealth(Point(x, y)));
+                }
+            }
+
+            pathExplosions += referenceHandler.getPathExplosions().size();
+            positionExplosions += referenceHandler.getPositionExplosions().size();
+            recorder.removeDestroyedShells();
+        }
+    }
+
+    // Make sure the random games actually exercised both detectors
+    EXPECT_GT(pathExplosions, 0);
+    EXPECT_GT(positionExplosions, 0);
+}
+
+// Performance
+
+TEST_F(CollisionHandlerTest, DISABLED_Benchmark_ResolveAll_ManyShells) {
+    const int width = 200;
+    const int height = 200;
+    const int shellCount = 800;
+    const int halfSteps = 100;
+
+    std::vector<Tank> tanks;
+    std::vector<Shell> shells;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, width - 1);
+    for (int i = 0; i < 20; ++i) {
+        tanks.emplace_back(i % 2 + 1, Point(coord(rng), coord(rng)), Direction::Up);
+    }
+    for (int i = 0; i < shellCount; ++i) {
+        shells.emplace_back(i % 2 + 1, Point(coord(rng), coord(rng)),
+                            ALL_DIRECTIONS[i % 8]);
+    }
+    const GameBoard emptyBoard(width, height);
+
+    // Destroyed objects are revived every half step so the load stays constant
+    auto run = [&](auto& resolver) {
+        GameBoard runBoard = emptyBoard;
+        std::vector<Tank> runTanks = tanks;
+        std::vector<Shell> runShells = shells;
+        auto start = std::chrono::steady_clock::now();
+        for (int step = 0; step < halfSteps; ++step) {
+            for (Shell& shell : runShells) {
+                shell = Shell(shell.getPlayerId(), shell.getPosition(), shell.getDirection());
+                shell.setPosition(runBoard.wrapPosition(
+                    shell.getPosition() + getDirectionDelta(shell.getDirection())));
+            }
+            resolver.resolveAllCollisions(runTanks, runShells, runBoard);
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    CollisionHandler fastHandler;
+    ReferenceCollisionHandler referenceHandler;
+    double fastSeconds = run(fastHandler);
+    double referenceSeconds = run(referenceHandler);
+
+    RecordProperty("half_steps_per_s", static_cast<int>(halfSteps / fastSeconds));
+    RecordProperty("reference_half_steps_per_s", static_cast<int>(halfSteps / referenceSeconds));
+}
+
 } // namespace GameManager_318835816_211314471
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <filesystem>
@@ -6,11 +7,11 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
-#include <set>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "collision_handler.h"
+#include "compiled_map.h"
 #include "game_manager.h"
 #include "satellite_view_impl.h"
 #include "common/GameManagerRegistration.h"
@@ -41,28 +42,49 @@ MyGameManager_318835816_211314471::~MyGameManager_318835816_211314471() {
     #endif
 }
 
+void MyGameManager_318835816_211314471::reset() {
+    // Algorithms and players belong to the last game
+    m_tankControllers.clear();
+    m_players.clear();
+    m_tanks.clear();
+    m_shells.clear();
+    m_stepSnapshot.reset();
+    m_gameLog.clear();
+
+    m_currentStep = 0;
+    m_gameOver = false;
+    m_remaining_steps = DEFAULT_NO_SHELLS_STEPS;
+    m_maximum_steps = 100;
+    m_initialShells = Tank::DEFAULT_INITIAL_SHELLS;
+    m_gameResult.clear();
+    m_finalGameResult = GameResult();
+    m_mapName.clear();
+    m_player1Name.clear();
+    m_player2Name.clear();
+}
+
 bool MyGameManager_318835816_211314471::readBoard(const SatelliteView& satellite_view, size_t map_width, size_t map_height, 
                            size_t max_steps, size_t num_shells,
                            TankAlgorithmFactory player1_factory, TankAlgorithmFactory player2_factory) {
-    std::vector<std::string> boardLines = 
-      readSatelliteView(satellite_view, map_width, map_height);
-    if (boardLines.empty()) {
+    if (map_width == 0 || map_height == 0) {
         // Should not happen
         return false;
     }
 
-    m_maximum_steps = max_steps;
-    Tank::setInitialShells(num_shells);
-
-    m_board = GameBoard(map_width, map_height);
-
-    std::vector<std::pair<int, Point>> tankPositions;
-    if (!m_board.initialize(boardLines, tankPositions)) {
+    // Shared with every other match on this map when the view compiled it
+    std::shared_ptr<const CompiledMap> compiledMap =
+      CompiledMapSatelliteView::compiledMapOf(satellite_view, map_width, map_height);
+    if (compiledMap->getTankPositions().empty()) {
         // Should not happen
         return false;
     }
+
+    m_maximum_steps = max_steps;
+    m_initialShells = static_cast<int>(num_shells);
+
+    m_board = compiledMap->getBoard();
     
-    createTanks(tankPositions);
+    createTanks(compiledMap->getTankPositions());
     createTankAlgorithms(player1_factory, player2_factory);
 
     return true;
@@ -102,6 +124,18 @@ GameResult MyGameManager_318835816_211314471::run(
     m_gameOver = false;
     m_gameLog.clear();
 
+    if (m_verbose) {
+        ReplayHeader header;
+        header.width = map_width;
+        header.height = map_height;
+        header.maxSteps = max_steps;
+        header.numShells = num_shells;
+        header.mapName = m_mapName;
+        header.player1Name = m_player1Name;
+        header.player2Name = m_player2Name;
+        m_replayWriter.begin(header, m_board, m_tanks, m_shells);
+    }
+
     #ifdef ENABLE_VISUALIZATION
     if (m_visualizationManager) {
         std::string stepMessage = "Game started";
@@ -119,27 +153,21 @@ GameResult MyGameManager_318835816_211314471::run(
     #endif
     
     while (!m_gameOver) {
-        processStep();
-        
-        bool tanksOutOfShells = true;
-        for (const auto& tank : m_tanks) {
-            if (!tank.isDestroyed() && tank.getRemainingShells() > 0) {
-                tanksOutOfShells = false;
-                break;
-            }
-        }
-        
-        if (tanksOutOfShells) {
-            m_remaining_steps--;
-        }
-        m_gameOver = checkGameOver();
-        m_currentStep++;
+        playStep();
     }
     
-    m_gameLog.push_back(
-        "Game ended after " + std::to_string(m_currentStep-1) + " steps"
-    );
-    m_gameLog.push_back("Result: " + m_gameResult);
+    if (m_verbose) {
+        m_gameLog.push_back(
+            "Game ended after " + std::to_string(m_currentStep-1) + " steps"
+        );
+        m_gameLog.push_back("Result: " + m_gameResult);
+
+        ReplayResult replayResult;
+        replayResult.winner = m_finalGameResult.winner;
+        replayResult.reason = m_finalGameResult.reason;
+        replayResult.rounds = m_finalGameResult.rounds;
+        m_replayWriter.finish(replayResult);
+    }
 
     #ifdef ENABLE_VISUALIZATION
     if (m_visualizationManager) {
@@ -181,6 +209,17 @@ bool MyGameManager_318835816_211314471::saveResults() {
     
     outputFile.close();
 
+    std::string replayPath = outputFilePath;
+    size_t extensionPos = replayPath.find_last_of('.');
+    if (extensionPos != std::string::npos) {
+        replayPath = replayPath.substr(0, extensionPos);
+    }
+    replayPath += ".replay";
+    if (!m_replayWriter.saveToFile(replayPath)) {
+        std::cerr << "Warning: Could not write replay file " << replayPath
+                  << ", continuing without it" << std::endl;
+    }
+
     #ifdef ENABLE_VISUALIZATION
     if (m_visualizationManager) {
         std::string visualizationPath = outputFilePath;
@@ -197,10 +236,26 @@ bool MyGameManager_318835816_211314471::saveResults() {
     return true;
 }
 
+void MyGameManager_318835816_211314471::playStep() {
+    processStep();
+    
+    bool tanksOutOfShells = true;
+    for (const auto& tank : m_tanks) {
+        if (!tank.isDestroyed() && tank.getRemainingShells() > 0) {
+            tanksOutOfShells = false;
+            break;
+        }
+    }
+    
+    if (tanksOutOfShells) {
+        m_remaining_steps--;
+    }
+    m_gameOver = checkGameOver();
+    m_currentStep++;
+}
+
 void MyGameManager_318835816_211314471::processStep() {
-  m_currentBoard = m_board;
-  m_currentTanks = m_tanks;
-  m_currentShells = m_shells;
+  m_stepSnapshot.reset();
 
   for (auto& controller : m_tankControllers) {
     if (!controller.tank.isDestroyed() && controller.algorithm) {
@@ -210,6 +265,12 @@ void MyGameManager_318835816_211314471::processStep() {
     }
   }
 
+  // Battle info must reflect the state before anything moved, so the
+  // snapshot is taken here - but only when some tank will actually use it
+  if (isBattleInfoRequested()) {
+    captureStepSnapshot();
+  }
+
   moveShellsOnce();
 
   m_collisionHandler.resolveAllCollisions(
@@ -249,21 +310,25 @@ void MyGameManager_318835816_211314471::processStep() {
     tank.updateCooldowns();
   }
 
-  std::string turnLog = logAction();
-  #ifdef ENABLE_VISUALIZATION
-  if (m_visualizationManager) {
-      std::string stepMessage = "Step " + std::to_string(m_currentStep) + ": " + turnLog;
-      
-      m_visualizationManager->captureGameState(
-          m_currentStep,
-          m_board,
-          m_tanks,
-          m_shells,
-          m_remaining_steps,
-          stepMessage
-      );
+  // The text log is only needed for verbose output, headless games skip it
+  if (m_verbose) {
+    recordReplayStep();
+    std::string turnLog = logAction();
+    #ifdef ENABLE_VISUALIZATION
+    if (m_visualizationManager) {
+        std::string stepMessage = "Step " + std::to_string(m_currentStep) + ": " + turnLog;
+        
+        m_visualizationManager->captureGameState(
+            m_currentStep,
+            m_board,
+            m_tanks,
+            m_shells,
+            m_remaining_steps,
+            stepMessage
+        );
+    }
+    #endif
   }
-  #endif
 }
 
 void MyGameManager_318835816_211314471::applyAction(TankWithAlgorithm& controller) {
@@ -335,7 +400,12 @@ void MyGameManager_318835816_211314471::applyAction(TankWithAlgorithm& controlle
               break;
            }
 
-           SatelliteViewImpl satteliteView(m_currentBoard, m_currentTanks, m_currentShells, playerTank.getPosition());
+           if (!m_stepSnapshot) {
+              // Action applied outside of processStep, current state is the
+              // start-of-step state
+              captureStepSnapshot();
+           }
+           SatelliteViewImpl satteliteView(m_stepSnapshot, playerTank.getPosition());
             
             // Find the corresponding player
             for (auto& playerWithId : m_players) {
@@ -358,6 +428,22 @@ void MyGameManager_318835816_211314471::applyAction(TankWithAlgorithm& controlle
   controller.actionSuccess = actionResult;
 }
 
+bool MyGameManager_318835816_211314471::isBattleInfoRequested() const {
+  for (const auto& controller : m_tankControllers) {
+    // Tanks in backward movement have their request ignored (see applyAction)
+    if (controller.nextAction == ActionRequest::GetBattleInfo &&
+        !controller.tank.isDestroyed() &&
+        !controller.tank.isMovingBackward()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void MyGameManager_318835816_211314471::captureStepSnapshot() {
+  m_stepSnapshot = SatelliteViewImpl::render(m_board, m_tanks, m_shells);
+}
+
 void MyGameManager_318835816_211314471::moveShellsOnce() {
   for (auto& shell : m_shells) {
       if (shell.isDestroyed()) {
@@ -373,33 +459,45 @@ void MyGameManager_318835816_211314471::moveShellsOnce() {
 }
 
 bool MyGameManager_318835816_211314471::checkGameOver() {
-    std::set<int> playerIds;
-    // Count alive tanks per player
-    std::unordered_map<int, int> playersAlive;
+    // Count tanks per player on the stack, this runs every step
+    std::array<int, MAX_PLAYER_ID + 1> playerTanks{};
+    std::array<int, MAX_PLAYER_ID + 1> playersAlive{};
     for (const auto& tank : m_tanks) {
-        playerIds.insert(tank.getPlayerId());
+        int playerId = tank.getPlayerId();
+        if (playerId < 0 || playerId > MAX_PLAYER_ID) {
+            continue;
+        }
+        playerTanks[playerId]++;
         if (!tank.isDestroyed()) {
-            playersAlive[tank.getPlayerId()]++;
+            playersAlive[playerId]++;
         }
     }
 
+    int playerCount = 0;
     int playersWithTanks = 0;
     int winningPlayer = -1;
     int winningPlayerTanks = 0;
     
-    for (const auto& [playerId, tankCount] : playersAlive) {
-        if (tankCount > 0) {
+    for (int playerId = 0; playerId <= MAX_PLAYER_ID; ++playerId) {
+        if (playerTanks[playerId] > 0) {
+            playerCount++;
+        }
+        if (playersAlive[playerId] > 0) {
             playersWithTanks++;
             winningPlayer = playerId;
-            winningPlayerTanks = tankCount;
+            winningPlayerTanks = playersAlive[playerId];
         }
     }
-    
-    std::vector<size_t> remainingTanks(playerIds.size(), 0);
-    for (const auto& [playerId, tankCount] : playersAlive) {
-        if (playerId > 0) {
-            remainingTanks[playerId - 1] = tankCount; // Convert to 0-based index
-        }
+
+    bool gameOver = playersWithTanks <= 1 || m_remaining_steps <= 0 ||
+                    m_currentStep >= m_maximum_steps;
+    if (!gameOver) {
+        return false;
+    }
+
+    std::vector<size_t> remainingTanks(playerCount, 0);
+    for (int playerId = 1; playerId <= playerCount; ++playerId) {
+        remainingTanks[playerId - 1] = playersAlive[playerId]; // Convert to 0-based index
     }
 
     // Check win conditions
@@ -418,21 +516,12 @@ bool MyGameManager_318835816_211314471::checkGameOver() {
         populateGameResult(0, GameResult::ZERO_SHELLS, remainingTanks);
         return true;
     }
-    if (m_currentStep >= m_maximum_steps) {
-        // 2-player format
-        int player1Tanks = 0, player2Tanks = 0;
-        for (const auto& [playerId, tankCount] : playersAlive) {
-            if (playerId == 1) player1Tanks = tankCount;
-            else if (playerId == 2) player2Tanks = tankCount;
-        }
-        m_gameResult = "Tie, reached max steps = " + std::to_string(m_maximum_steps) + 
-                      ", player 1 has " + std::to_string(player1Tanks) + 
-                      " tanks, player 2 has " + std::to_string(player2Tanks) + " tanks";
-        populateGameResult(0, GameResult::MAX_STEPS, remainingTanks);
-        return true;
-    }
-    // Game continues
-    return false;
+    // Reached max steps, 2-player format
+    m_gameResult = "Tie, reached max steps = " + std::to_string(m_maximum_steps) + 
+                  ", player 1 has " + std::to_string(playersAlive[1]) + 
+                  " tanks, player 2 has " + std::to_string(playersAlive[2]) + " tanks";
+    populateGameResult(0, GameResult::MAX_STEPS, remainingTanks);
+    return true;
 }
 
 void MyGameManager_318835816_211314471::populateGameResult(int winner, GameResult::Reason reason, const std::vector<size_t>& remainingTanks) {
@@ -444,43 +533,32 @@ void MyGameManager_318835816_211314471::populateGameResult(int winner, GameResul
 }
 
 std::string MyGameManager_318835816_211314471::logAction() {
-    std::vector<std::string> stepActions;
-    for (auto& controller : m_tankControllers) {
-        std::string actionStr;
+    std::string turnLog;
+    for (size_t i = 0; i < m_tankControllers.size(); ++i) {
+        auto& controller = m_tankControllers[i];
+        if (i > 0) turnLog += ", ";
         if (controller.tank.isDestroyed() && !controller.wasKilledInPreviousStep) {
-            actionStr = actionToString(controller.nextAction) + " (killed)";
+            turnLog += actionToString(controller.nextAction) + " (killed)";
             controller.wasKilledInPreviousStep = true;
         } else if (controller.tank.isDestroyed()) {
-            actionStr = "Killed";
+            turnLog += "Killed";
         } else {
-            actionStr = actionToString(controller.nextAction);
-            if (!controller.actionSuccess) actionStr += " (ignored)";
+            turnLog += actionToString(controller.nextAction);
+            if (!controller.actionSuccess) turnLog += " (ignored)";
         }
-        stepActions.push_back(actionStr);
-    }
-    std::string turnLog;
-    for (size_t i = 0; i < stepActions.size(); ++i) {
-        if (i > 0) turnLog += ", ";
-        turnLog += stepActions[i];
     }
     m_gameLog.push_back(turnLog);
+    return turnLog;
+}
 
-    // Debug log for all tanks actions with their ids
-    std::string debugInfo = "Step " + std::to_string(m_currentStep) + " actions: ";
+void MyGameManager_318835816_211314471::recordReplayStep() {
+    // Killed and dead flags are derived by the writer from the tank states
+    std::vector<ReplayTankAction> actions(m_tankControllers.size());
     for (size_t i = 0; i < m_tankControllers.size(); ++i) {
-        auto& controller = m_tankControllers[i];
-        int playerId = controller.tank.getPlayerId();
-        
-        if (i > 0) debugInfo += ", ";
-        debugInfo += "P" + std::to_string(playerId) + 
-                     "-T" + std::to_string(i) + 
-                     " @(" + std::to_string(controller.tank.getPosition().getX()) + "," + std::to_string(controller.tank.getPosition().getY()) + ")" +
-                     "-" + directionToString(controller.tank.getDirection()) + 
-                     ": " + actionToString(controller.nextAction) +
-                     (controller.actionSuccess ? "" : " (ignored)") +
-                     (controller.tank.isDestroyed() ? " (killed)" : "");
+        actions[i].action = m_tankControllers[i].nextAction;
+        actions[i].success = m_tankControllers[i].actionSuccess;
     }
-    return turnLog;
+    m_replayWriter.recordStep(actions, m_tanks, m_shells, m_board);
 }
 
 std::string MyGameManager_318835816_211314471::actionToString(ActionRequest action) {
@@ -512,7 +590,7 @@ void MyGameManager_318835816_211314471::createTanks(const std::vector<std::pair<
     m_tanks.clear();
     for (const auto& [playerId, position] : tankPositions) {
         Direction dir = getInitialDirection(playerId);
-        m_tanks.emplace_back(playerId, position, dir);
+        m_tanks.emplace_back(playerId, position, dir, m_initialShells);
     }
 }
 
@@ -578,27 +656,6 @@ std::string MyGameManager_318835816_211314471::extractBaseName(const std::string
     return cleanFilename(fileName);
 }
 
-std::vector<std::string> MyGameManager_318835816_211314471::readSatelliteView(const SatelliteView& satellite_view, 
-                                                       size_t map_width, 
-                                                       size_t map_height) const {
-    std::vector<std::string> boardLines;
-    boardLines.reserve(map_height);
-    
-    for (size_t y = 0; y < map_height; ++y) {
-        std::string row;
-        row.reserve(map_width);
-        
-        for (size_t x = 0; x < map_width; ++x) {
-            char ch = satellite_view.getObjectAt(x, y);
-            row.push_back(ch);
-        }
-        
-        boardLines.push_back(row);
-    }
-    
-    return boardLines;
-}
-
 } // namespace GameManager_318835816_211314471
 
 #ifndef DISABLE_STATIC_REGISTRATION
@@ -8,6 +8,9 @@
 #include "game_board.h"
 #include "objects/shell.h"
 #include "objects/tank.h"
+#include "replay/replay_writer.h"
+#include "reusable_game_manager.h"
+#include "satellite_view_impl.h"
 #include "common/AbstractGameManager.h"
 #include "common/GameResult.h"
 #include "common/SatelliteView.h"
@@ -33,14 +36,18 @@ using namespace UserCommon_318835816_211314471;
  * - Handling movement, collisions, and game rules
  * - Tracking game history and saving results
  */
-class MyGameManager_318835816_211314471 : public AbstractGameManager {
+class MyGameManager_318835816_211314471 : public ReusableGameManager {
 public:
     /** Default number of steps allowed when tanks run out of shells */
     static constexpr int DEFAULT_NO_SHELLS_STEPS = 40;
 
+    /** Highest player id a board can contain (tanks are marked '1'-'9') */
+    static constexpr int MAX_PLAYER_ID = 9;
+
     /**
      * @brief Construct a new MyGameManager_318835816_211314471 object with default state
-     * @param verbose Whether to generate output files (default: false)
+     * @param verbose Whether to generate output files (default: false).
+     *  A non-verbose manager runs headless and keeps no text log.
      */
     MyGameManager_318835816_211314471(bool verbose = false);
     
@@ -87,6 +94,13 @@ public:
         TankAlgorithmFactory player1_tank_algo_factory,
         TankAlgorithmFactory player2_tank_algo_factory) override;
 
+    /**
+     * @brief Forget the last game so the manager can run another one
+     * 
+     * Keeps the board, collision and replay buffers for the next game.
+     */
+    void reset() override;
+
     struct TankWithAlgorithm {
         Tank& tank;
         std::unique_ptr<TankAlgorithm> algorithm;
@@ -112,9 +126,11 @@ private:
     bool m_gameOver;
     int m_remaining_steps;
     int m_maximum_steps;
+    int m_initialShells = Tank::DEFAULT_INITIAL_SHELLS; // NumShells of this game
     std::string m_gameResult;
     GameResult m_finalGameResult;
-    std::vector<std::string> m_gameLog;
+    std::vector<std::string> m_gameLog; // Only filled in verbose mode
+    ReplayWriter m_replayWriter; // Only records in verbose mode
     CollisionHandler m_collisionHandler;
 
     // Core game state
@@ -131,12 +147,16 @@ private:
     std::string m_player1Name;
     std::string m_player2Name;
 
-    // Current game state
-    GameBoard m_currentBoard;
-    std::vector<Tank> m_currentTanks;
-    std::vector<Shell> m_currentShells;
+    // Start-of-step game state served to GetBattleInfo requests, rendered
+    // once and shared by every tank asking in the step. Only captured when
+    // at least one tank asks for battle info in the step.
+    std::shared_ptr<const SatelliteViewImpl::RenderedBoard> m_stepSnapshot;
 
     // Game step methods
+    // Play a single step of the game loop: process it, count down once all
+    // tanks are out of shells and check for game over
+    void playStep();
+
     // Process a single step of the game
     void processStep();
     
@@ -144,6 +164,12 @@ private:
     // Validates and executes the action, updating the game state
     void applyAction(TankWithAlgorithm& controller);
     
+    // Check whether any live tank will be served battle info this step
+    bool isBattleInfoRequested() const;
+
+    // Capture the current state as the start-of-step snapshot
+    void captureStepSnapshot();
+
     // Move all active shells one cell in their direction
     void moveShellsOnce();
     
@@ -154,8 +180,13 @@ private:
     // Helper method to populate GameResult with common fields
     void populateGameResult(int winner, GameResult::Reason reason, const std::vector<size_t>& remainingTanks);
     
-    // Log an action taken by a player
+    // Log the actions taken by all tanks in the current step
+    // Only called in verbose mode
     std::string logAction();
+
+    // Record the current step in the binary replay
+    // Only called in verbose mode
+    void recordReplayStep();
     
     // Create algorithm instances for all tanks using provided factories
     void createTankAlgorithms(TankAlgorithmFactory player1_factory, TankAlgorithmFactory player2_factory);
@@ -169,7 +200,8 @@ private:
     // Remove any destroyed shells from the game
     void removeDestroyedShells();
 
-    // Save the game results to an output file (only when verbose=true)
+    // Save the game results to an output file and a binary replay next to
+    // it (only when verbose=true)
     bool saveResults();
 
     // Convert ActionRequest to string
@@ -184,14 +216,12 @@ private:
     // Extract base name from full file path (remove directory path only)
     std::string extractBaseName(const std::string& fullPath);
 
-    // Read character grid from SatelliteView and convert to vector<string> format
-    std::vector<std::string> readSatelliteView(const SatelliteView& satellite_view, 
-                                               size_t map_width, 
-                                               size_t map_height) const;
-
     // For testing purposes
     friend class GameManagerTest;
 
+    // Re-simulates recorded games through the step pipeline
+    friend class GameReplayer;
+
     #ifdef ENABLE_VISUALIZATION
     std::unique_ptr<VisualizationManager> m_visualizationManager;
     #endif
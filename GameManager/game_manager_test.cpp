@@ -6,6 +6,7 @@
 #include "test/mocks/scenario_mock_satellite_view.h"
 #include "test/mocks/mock_factories.h"
 #include "objects/shell.h"
+#include "replay/replay_reader.h"
 #include "utils/point.h"
 #include "utils/direction.h"
 #include "common/SatelliteView.h"
@@ -15,6 +16,8 @@
 #include <cstdio> // for std::remove
 #include <iostream>
 #include <typeinfo>
+#include <chrono>
+#include <string>
 
 namespace GameManager_318835816_211314471 { 
 
@@ -46,6 +49,9 @@ protected:
     bool GetVerbose() {
         return manager->m_verbose;
     }
+    void SetVerbose(bool verbose) {
+        manager->m_verbose = verbose;
+    }
     std::string& GetGameResult() {
         return manager->m_gameResult;
     }
@@ -97,10 +103,6 @@ protected:
     std::string CallCleanFilename(const std::string& name) {
         return manager->cleanFilename(name);
     }
-    std::vector<std::string> CallReadSatelliteView(const SatelliteView& view,
-                                                  size_t width, size_t height) {
-        return manager->readSatelliteView(view, width, height);
-    }
     bool CallCheckGameOver() {
         return manager->checkGameOver();
     }
@@ -139,67 +141,9 @@ protected:
 // ===================================================================== //
 // 1. actionToString(ActionRequest action)
 // 2. getInitialDirection(int playerId)
-// 3. readSatelliteView(const SatelliteView& satellite_view, size_t map_width, size_t map_height
-// 4. isClassic2PlayerGame(const GameBoard& board)
+// 3. isClassic2PlayerGame(const GameBoard& board)
 // ===================================================================== //
 
-TEST_F(GameManagerTest, ReadSatelliteViewBasic) {
-    std::vector<std::string> expectedGrid = {
-        "# 1",
-        " @ ",
-        "2  "
-    };
-    MockSatelliteView mockView(expectedGrid, 3, 3);
-    
-    std::vector<std::string> result = CallReadSatelliteView(mockView, 3, 3);
-    
-    // Verify the result matches the expected grid
-    ASSERT_EQ(result.size(), 3);
-    EXPECT_EQ(result[0], "# 1");
-    EXPECT_EQ(result[1], " @ ");
-    EXPECT_EQ(result[2], "2  ");
-}
-
-TEST_F(GameManagerTest, ReadSatelliteViewEmptyBoard) {
-    // Create a 2x2 empty board
-    std::vector<std::string> expectedGrid = {
-        "  ",
-        "  "
-    };
-    
-    MockSatelliteView mockView(expectedGrid, 2, 2);
-    
-    std::vector<std::string> result = CallReadSatelliteView(mockView, 2, 2);
-    
-    ASSERT_EQ(result.size(), 2);
-    EXPECT_EQ(result[0], "  ");
-    EXPECT_EQ(result[1], "  ");
-}
-
-TEST_F(GameManagerTest, ReadSatelliteViewSingleCell) {
-    // Create a 1x1 board with a wall
-    std::vector<std::string> expectedGrid = {"#"};
-    
-    MockSatelliteView mockView(expectedGrid, 1, 1);
-    
-    std::vector<std::string> result = CallReadSatelliteView(mockView, 1, 1);
-    
-    ASSERT_EQ(result.size(), 1);
-    EXPECT_EQ(result[0], "#");
-}
-
-TEST_F(GameManagerTest, ReadSatelliteViewZeroDimensions) {
-    // Test edge case with zero dimensions
-    std::vector<std::string> expectedGrid = {};
-    
-    MockSatelliteView mockView(expectedGrid, 0, 0);
-    
-    std::vector<std::string> result = CallReadSatelliteView(mockView, 0, 0);
-    
-    EXPECT_EQ(result.size(), 0);
-}
-
-
 // ===================================================================== //
 // Constructor and Basic Setup
 // ===================================================================== //
@@ -851,7 +795,7 @@ TEST_F(GameManagerTest, CheckGameOver_TieZeroShellsForExactly40Steps) {
     // Drain all shells from tanks using utilities
     auto& tanks = GetTanks();
     for (auto& tank : tanks) {
-        for (int i = 0; i < Tank::INITIAL_SHELLS; i++) {
+        for (int i = 0; i < Tank::DEFAULT_INITIAL_SHELLS; i++) {
             tank.decrementShells();
         }
         EXPECT_EQ(tank.getRemainingShells(), 0);
@@ -879,7 +823,7 @@ TEST_F(GameManagerTest, CheckGameOver_ZeroShellsButStillRemaining39Steps) {
     // Drain all shells from tanks using utilities
     auto& tanks = GetTanks();
     for (auto& tank : tanks) {
-        for (int i = 0; i < Tank::INITIAL_SHELLS; i++) {
+        for (int i = 0; i < Tank::DEFAULT_INITIAL_SHELLS; i++) {
             tank.decrementShells();
         }
         EXPECT_EQ(tank.getRemainingShells(), 0);
@@ -898,6 +842,7 @@ TEST_F(GameManagerTest, CheckGameOver_ZeroShellsButStillRemaining39Steps) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_OneTankMoves_UpdatesPositionAndLogs) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank with mock algorithm
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
     CreateTanks(positions);
@@ -917,7 +862,28 @@ TEST_F(GameManagerTest, ProcessStep_OneTankMoves_UpdatesPositionAndLogs) {
     EXPECT_EQ(GetGameLog().back(), "MoveForward");
 }
 
+TEST_F(GameManagerTest, ProcessStep_NotVerbose_DoesNotLog) {
+    // Arrange: Create tank with mock algorithm, manager is not verbose
+    std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
+    CreateTanks(positions);
+    CreateTankAlgorithms();
+    
+    auto& controller = GetTankControllers()[0];
+    controller.tank.setDirection(Direction::Right);
+    auto* mockAlgo = dynamic_cast<EnhancedMockAlgorithm*>(controller.algorithm.get());
+    ASSERT_NE(mockAlgo, nullptr);
+    mockAlgo->setConstantAction(ActionRequest::MoveForward);
+    
+    // Act
+    CallProcessStep();
+    
+    // Assert: Tank still moves, but no log entry is built
+    EXPECT_EQ(controller.tank.getPosition(), Point(2, 1));
+    EXPECT_TRUE(GetGameLog().empty());
+}
+
 TEST_F(GameManagerTest, ProcessStep_OneTankShoots_AddsShellAndLogs) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank with mock algorithm for shooting
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
     CreateTanks(positions);
@@ -942,6 +908,7 @@ TEST_F(GameManagerTest, ProcessStep_OneTankShoots_AddsShellAndLogs) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create two tanks where one shoots the other
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)}, {2, Point(3, 1)} };
     CreateTanks(positions);
@@ -970,6 +937,7 @@ TEST_F(GameManagerTest, ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_TankOnCooldown_ShootIgnoredAndLogs) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank on cooldown trying to shoot
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
     CreateTanks(positions);
@@ -991,6 +959,7 @@ TEST_F(GameManagerTest, ProcessStep_TankOnCooldown_ShootIgnoredAndLogs) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_TankKilledThisStep_LogsKilledThisStep) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create two tanks where one shoots and kills the other immediately
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)}, {2, Point(2, 1)} };
     CreateTanks(positions);
@@ -1013,6 +982,7 @@ TEST_F(GameManagerTest, ProcessStep_TankKilledThisStep_LogsKilledThisStep) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_AlreadyDeadTank_LogsKilled) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create already dead tank from previous step
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
     CreateTanks(positions);
@@ -1033,6 +1003,7 @@ TEST_F(GameManagerTest, ProcessStep_AlreadyDeadTank_LogsKilled) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_MixedActions_LogsAllScenarios) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create three tanks with mixed scenarios (killed, normal, killed)
     std::vector<std::pair<int, Point>> positions = {
         {2, Point(0, 0)}, {2, Point(1, 0)}, {2, Point(2, 0)}
@@ -1088,6 +1059,7 @@ TEST_F(GameManagerTest, ProcessStep_AllShellsDestroyed_RemovesShells) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_MoveBackward_OnlyMovesOnThirdStep) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank that will move backward (3-step delay mechanic)
     std::vector<std::pair<int, Point>> positions = { {1, Point(2, 2)} };
     CreateTanks(positions);
@@ -1121,6 +1093,7 @@ TEST_F(GameManagerTest, ProcessStep_MoveBackward_OnlyMovesOnThirdStep) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_MoveForward_cancelMoveBackward) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank that will request backward then forward (cancellation test)
     Point initialPosition = Point(2, 2);
     std::vector<std::pair<int, Point>> positions = { {1, initialPosition} };
@@ -1150,6 +1123,7 @@ TEST_F(GameManagerTest, ProcessStep_MoveForward_cancelMoveBackward) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_Shoot_CooldownResetsAfter4Steps) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank on large board to test cooldown mechanics
     std::vector<std::pair<int, Point>> positions = { {1, Point(0, 0)} };
     GetBoard() = GameBoard(20, 20);
@@ -1179,9 +1153,10 @@ TEST_F(GameManagerTest, ProcessStep_Shoot_CooldownResetsAfter4Steps) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_Shoot_CannotShootMoreThanMaxShells) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank and test shell exhaustion
     std::vector<std::pair<int, Point>> positions = { {1, Point(1, 1)} };
-    int maxShells = Tank::INITIAL_SHELLS;
+    int maxShells = Tank::DEFAULT_INITIAL_SHELLS;
     int shootCooldown = Tank::SHOOT_COOLDOWN;
     GetBoard() = GameBoard(2 * maxShells * (shootCooldown + 1), 1);
 
@@ -1210,6 +1185,7 @@ TEST_F(GameManagerTest, ProcessStep_Shoot_CannotShootMoreThanMaxShells) {
 }
 
 TEST_F(GameManagerTest, ProcessStep_GetBattleInfoIgnoredDuringBackwardMovement) {
+    SetVerbose(true); // Step log is only kept in verbose mode
     // Arrange: Create tank that will test GetBattleInfo during backward movement
     std::vector<std::pair<int, Point>> positions = { {1, Point(2, 2)} };
     CreateTanks(positions);
@@ -1339,6 +1315,69 @@ TEST_F(GameManagerTest, Run_DoesNotExceedMaximumSteps_Integration) {
     EXPECT_EQ(result.remaining_tanks[1], 1u); // Player 2 has 1 tank remaining
 }
 
+TEST_F(GameManagerTest, Run_AfterResetMatchesFreshManager) {
+    auto runShooters = [](MyGameManager_318835816_211314471& gameManager) {
+        auto [satelliteView, player1, player2, width, height, maxSteps, numShells] =
+            GameScenarioBuilder()
+                .withBoardSize(6, 4)
+                .withTwoPlayerSetup(Point(0, 1), Point(5, 2))
+                .withWalls({Point(2, 1), Point(3, 2)})
+                .withMaxSteps(60)
+                .withNumShells(3)
+                .build();
+        return gameManager.run(width, height, satelliteView, "test_map", maxSteps, numShells,
+                               *player1, "TestPlayer1", *player2, "TestPlayer2",
+                               mockFactoryShooter, mockFactoryShooter);
+    };
+
+    GameResult first = runShooters(*manager);
+    manager->reset();
+    GameResult second = runShooters(*manager);
+    MyGameManager_318835816_211314471 fresh(false);
+    GameResult expected = runShooters(fresh);
+
+    EXPECT_EQ(first.winner, expected.winner);
+    EXPECT_EQ(second.winner, expected.winner);
+    EXPECT_EQ(second.reason, expected.reason);
+    EXPECT_EQ(second.rounds, expected.rounds);
+    EXPECT_EQ(second.remaining_tanks, expected.remaining_tanks);
+}
+
+TEST_F(GameManagerTest, DISABLED_Benchmark_ResetComparedToNewManager) {
+    const int games = 2000;
+    auto runTinyGame = [](MyGameManager_318835816_211314471& gameManager) {
+        auto [satelliteView, player1, player2, width, height, maxSteps, numShells] =
+            GameScenarioBuilder()
+                .withBoardSize(5, 5)
+                .withTwoPlayerSetup(Point(0, 0), Point(4, 4))
+                .withMaxSteps(3)
+                .withNumShells(1)
+                .build();
+        return gameManager.run(width, height, satelliteView, "tiny_map", maxSteps, numShells,
+                               *player1, "TestPlayer1", *player2, "TestPlayer2",
+                               mockFactoryDoNothing, mockFactoryDoNothing);
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < games; ++i) {
+        auto gameManager = std::make_unique<MyGameManager_318835816_211314471>(false);
+        EXPECT_EQ(runTinyGame(*gameManager).reason, GameResult::Reason::MAX_STEPS);
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    MyGameManager_318835816_211314471 reused(false);
+    for (int i = 0; i < games; ++i) {
+        EXPECT_EQ(runTinyGame(reused).reason, GameResult::Reason::MAX_STEPS);
+        reused.reset();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double newTime = std::chrono::duration<double>(middle - start).count();
+    double reusedTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("new_manager_ms", std::to_string(newTime * 1000));
+    RecordProperty("reset_manager_ms", std::to_string(reusedTime * 1000));
+
+}
+
 TEST_F(GameManagerTest, Run_TieAfter40StepsWithZeroShells_Integration) {
     // Arrange: Create scenario with tanks that will shoot at walls until out of shells
     size_t numShells = 5; // Use fewer shells for faster test
@@ -1426,6 +1465,9 @@ TEST_F(GameManagerTest, Run_VerboseFalse_NoFileOutput) {
     std::vector<std::string> newFiles = fileHelper->getNewGameFiles();
     EXPECT_TRUE(newFiles.empty()) << "Expected no files, but found: " << 
         (newFiles.empty() ? "none" : newFiles[0]);
+
+    // Headless games do not build the text log at all
+    EXPECT_TRUE(GetGameLog().empty());
 }
 
 TEST_F(GameManagerTest, Run_VerboseTrue_CreatesFileOutput) {
@@ -1456,12 +1498,22 @@ TEST_F(GameManagerTest, Run_VerboseTrue_CreatesFileOutput) {
     EXPECT_EQ(result.winner, 0); // Tie due to max steps
     EXPECT_EQ(result.reason, GameResult::Reason::MAX_STEPS);
     
-    // Verify exactly one new game_*.txt file was created
+    // Verify exactly one new game_*.txt log and one game_*.replay were created
     std::vector<std::string> newFiles = fileHelper->getNewGameFiles();
-    ASSERT_EQ(newFiles.size(), 1u) << "Expected exactly 1 file, but found " << newFiles.size();
+    std::vector<std::string> logFiles;
+    std::vector<std::string> replayFiles;
+    for (const auto& newFile : newFiles) {
+        if (FileTestHelper::endsWith(newFile, ".replay")) {
+            replayFiles.push_back(newFile);
+        } else {
+            logFiles.push_back(newFile);
+        }
+    }
+    ASSERT_EQ(logFiles.size(), 1u) << "Expected exactly 1 log file, but found " << logFiles.size();
+    ASSERT_EQ(replayFiles.size(), 1u) << "Expected exactly 1 replay file, but found " << replayFiles.size();
     
     // Verify the filename format includes player class names and timestamp
-    std::string filename = newFiles[0];
+    std::string filename = logFiles[0];
     
     // Use the same player names that are passed to GameManager::run()
     std::string player1Name = "TestPlayer1";
@@ -1491,6 +1543,136 @@ TEST_F(GameManagerTest, Run_VerboseTrue_CreatesFileOutput) {
         }
     }
     EXPECT_TRUE(hasContent) << "Expected file to have game log content";
+
+    // The replay sits next to the log and holds the whole game
+    std::string replayName = filename.substr(0, filename.size() - 4) + ".replay";
+    EXPECT_EQ(replayFiles[0], replayName);
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromFile(replayName)) << reader.getError();
+    EXPECT_EQ(reader.getHeader().mapName, "test_map");
+    EXPECT_EQ(reader.getHeader().player1Name, "TestPlayer1");
+    EXPECT_EQ(reader.getStepCount(), maxSteps);
+    ASSERT_TRUE(reader.hasResult());
+    EXPECT_EQ(reader.getResult().reason, GameResult::Reason::MAX_STEPS);
+}
+
+TEST_F(GameManagerTest, Run_VerboseTrue_ReplayMatchesGameLog) {
+    manager = std::make_unique<MyGameManager_318835816_211314471>(true);
+
+    auto [satelliteView, player1, player2, width, height, maxSteps, numShells] = 
+        GameScenarioBuilder()
+            .withBoardSize(5, 3)
+            .withTwoPlayerSetup(Point(0, 1), Point(4, 1))
+            .withWall(Point(2, 0))
+            .withMaxSteps(12)
+            .withNumShells(3)
+            .build();
+
+    auto player1Factory = createMockFactoryWithSequence("replayPlayer1", {
+        ActionRequest::Shoot, ActionRequest::RotateLeft90, ActionRequest::MoveForward
+    });
+    manager->run(
+        width, height,
+        satelliteView,
+        "test_map",
+        maxSteps, numShells,
+        *player1, "TestPlayer1",
+        *player2, "TestPlayer2",
+        player1Factory, mockFactoryDoNothing
+    );
+
+    std::string replayName;
+    for (const auto& newFile : fileHelper->getNewGameFiles()) {
+        if (FileTestHelper::endsWith(newFile, ".replay")) {
+            replayName = newFile;
+        }
+    }
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromFile(replayName)) << reader.getError();
+
+    // The step lines of the text log can be regenerated from the replay
+    const std::vector<std::string>& gameLog = GetGameLog();
+    ASSERT_EQ(gameLog.size(), reader.getStepCount() + 2);
+    for (size_t step = 1; step <= reader.getStepCount(); ++step) {
+        ASSERT_TRUE(reader.seekStep(step));
+        EXPECT_EQ(ReplayReader::formatActionLog(reader.getActions()), gameLog[step - 1])
+            << "Step " << step;
+    }
+
+    // The final replay state matches the game
+    const std::vector<Tank>& tanks = GetTanks();
+    ASSERT_EQ(reader.getTanks().size(), tanks.size());
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        EXPECT_EQ(reader.getTanks()[i].position, tanks[i].getPosition());
+        EXPECT_EQ(reader.getTanks()[i].direction, tanks[i].getDirection());
+        EXPECT_EQ(reader.getTanks()[i].remainingShells, tanks[i].getRemainingShells());
+        EXPECT_EQ(reader.getTanks()[i].destroyed, tanks[i].isDestroyed());
+    }
+    EXPECT_EQ(reader.getShells().size(), GetShells().size());
+    EXPECT_EQ(reader.getBoard().getWallHealth(Point(2, 0)),
+              GetBoard().getWallHealth(Point(2, 0)));
+}
+
+// ===================================================================== //
+// Performance
+// ===================================================================== //
+// Step throughput on large maps. The numbers are printed for comparison
+// between builds; the time bound only guards against gross regressions.
+// ===================================================================== //
+
+namespace {
+
+// Builds a width x height board with a sparse wall lattice and one tank per
+// player in opposite corners.
+std::vector<std::string> createLargeBoardLines(size_t width, size_t height) {
+    std::vector<std::string> lines(height, std::string(width, ' '));
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            if ((x % 7 == 3) && (y % 5 != 0)) {
+                lines[y][x] = '#';
+            }
+        }
+    }
+    lines[1][1] = '1';
+    lines[height - 2][width - 2] = '2';
+    return lines;
+}
+
+} // namespace
+
+TEST_F(GameManagerTest, DISABLED_Benchmark_ProcessStepThroughput_LargeMap) {
+    const size_t width = 250;
+    const size_t height = 250;
+    const int steps = 400;
+
+    struct Scenario {
+        std::string property;
+        std::vector<ActionRequest> sequence;
+    };
+    const std::vector<Scenario> scenarios = {
+        {"steps_per_s_no_battle_info", {ActionRequest::RotateLeft45, ActionRequest::DoNothing,
+                            ActionRequest::RotateRight45, ActionRequest::DoNothing}},
+        {"steps_per_s_battle_info_every_4th_step", {ActionRequest::RotateLeft45, ActionRequest::DoNothing,
+                                        ActionRequest::RotateRight45, ActionRequest::GetBattleInfo}},
+    };
+
+    for (const auto& scenario : scenarios) {
+        manager = std::make_unique<MyGameManager_318835816_211314471>(/*verbose=*/false);
+        GetBoard() = GameBoard(width, height);
+        std::vector<std::pair<int, Point>> positions;
+        ASSERT_TRUE(GetBoard().initialize(createLargeBoardLines(width, height), positions));
+        CreateTanks(positions);
+        auto factory = createMockFactoryWithSequence("benchmark", scenario.sequence);
+        CreateTankAlgorithms(factory, factory);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < steps; ++i) {
+            CallProcessStep();
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+        RecordProperty(scenario.property, static_cast<int>(steps / elapsed.count()));
+    }
 }
 
-} // namespace GameManager_318835816_211314471
\ No newline at end of file
+} // namespace GameManager_318835816_211314471
@@ -0,0 +1,216 @@
+#include "game_replayer.h"
+#include "satellite_view_impl.h"
+
+namespace GameManager_318835816_211314471 {
+
+using namespace UserCommon_318835816_211314471;
+
+namespace {
+
+/**
+ * Plays back the recorded actions of one tank. Battle info is never
+ * requested from a player here, so updateBattleInfo is not reached.
+ */
+class RecordedTankAlgorithm : public TankAlgorithm {
+public:
+    RecordedTankAlgorithm(const std::vector<ActionRequest>& actions,
+                          const size_t& tankCount, const size_t& step,
+                          size_t tankIndex)
+        : m_actions(actions), m_tankCount(tankCount), m_step(step),
+          m_tankIndex(tankIndex) {}
+
+    ActionRequest getAction() override {
+        size_t index = (m_step - 1) * m_tankCount + m_tankIndex;
+        return index < m_actions.size() ? m_actions[index] : ActionRequest::DoNothing;
+    }
+
+    void updateBattleInfo(BattleInfo& /*info*/) override {}
+
+private:
+    const std::vector<ActionRequest>& m_actions;
+    const size_t& m_tankCount;
+    const size_t& m_step;
+    size_t m_tankIndex;
+};
+
+} // namespace
+
+GameReplayer::GameReplayer(size_t keyframeInterval)
+    : m_keyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1) {}
+
+GameReplayer::~GameReplayer() = default;
+
+bool GameReplayer::loadFromFile(const std::string& filePath) {
+    ReplayReader reader;
+    if (!reader.loadFromFile(filePath)) {
+        m_error = reader.getError();
+        m_manager.reset();
+        return false;
+    }
+    return load(reader);
+}
+
+bool GameReplayer::load(ReplayReader& reader) {
+    m_error.clear();
+    m_manager.reset();
+    m_keyframes.clear();
+    m_currentStep = 0;
+    m_stepCount = reader.getStepCount();
+
+    if (!reader.seekStep(0)) {
+        m_error = "Replay is not loaded";
+        return false;
+    }
+    size_t tankCount = reader.getTanks().size();
+
+    // Collect the action trace, tanks that are already dead do nothing
+    m_feed.tankCount = tankCount;
+    m_feed.step = 0;
+    m_feed.actions.assign(m_stepCount * tankCount, ActionRequest::DoNothing);
+    for (size_t step = 1; step <= m_stepCount; ++step) {
+        reader.seekStep(step);
+        const std::vector<ReplayTankAction>& actions = reader.getActions();
+        for (size_t i = 0; i < tankCount && i < actions.size(); ++i) {
+            if (!actions[i].dead) {
+                m_feed.actions[(step - 1) * tankCount + i] = actions[i].action;
+            }
+        }
+    }
+
+    reader.seekStep(0);
+    if (!createManager(reader)) {
+        m_manager.reset();
+        return false;
+    }
+    saveKeyframe();
+    return true;
+}
+
+bool GameReplayer::createManager(ReplayReader& reader) {
+    const ReplayHeader& header = reader.getHeader();
+    std::vector<Tank> tanks;
+    for (const ReplayTankState& tank : reader.getTanks()) {
+        tanks.emplace_back(tank.playerId, tank.position, tank.direction, static_cast<int>(header.numShells));
+    }
+    SatelliteViewImpl satelliteView(reader.getBoard(), tanks, {});
+
+    // The factories are called in tank order with per-player tank indices
+    size_t nextTank = 0;
+    TankAlgorithmFactory factory = [this, &nextTank](int, int) {
+        return std::make_unique<RecordedTankAlgorithm>(
+            m_feed.actions, m_feed.tankCount, m_feed.step, nextTank++);
+    };
+
+    m_manager = std::make_unique<MyGameManager_318835816_211314471>(false);
+    if (!m_manager->readBoard(satelliteView, header.width, header.height,
+                              header.maxSteps, header.numShells, factory, factory)) {
+        m_error = "Cannot set up the replay board";
+        return false;
+    }
+
+    // The game manager must have rebuilt the recorded tanks
+    const std::vector<Tank>& managerTanks = m_manager->m_tanks;
+    if (managerTanks.size() != tanks.size()) {
+        m_error = "Replay tanks do not match its board";
+        return false;
+    }
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        if (managerTanks[i].getPlayerId() != tanks[i].getPlayerId() ||
+            managerTanks[i].getPosition() != tanks[i].getPosition() ||
+            managerTanks[i].getDirection() != tanks[i].getDirection()) {
+            m_error = "Replay tanks do not match its board";
+            return false;
+        }
+    }
+
+    m_manager->m_currentStep = 1;
+    m_manager->m_gameOver = false;
+    return true;
+}
+
+void GameReplayer::saveKeyframe() {
+    m_keyframes.push_back(Keyframe{
+        m_currentStep,
+        m_manager->m_board,
+        m_manager->m_tanks,
+        m_manager->m_shells,
+        m_manager->m_remaining_steps
+    });
+}
+
+void GameReplayer::restoreKeyframe(const Keyframe& keyframe) {
+    // Element-wise assignment keeps the tanks the controllers refer to
+    m_manager->m_board = keyframe.board;
+    m_manager->m_tanks = keyframe.tanks;
+    m_manager->m_shells = keyframe.shells;
+    m_manager->m_remaining_steps = keyframe.remainingSteps;
+    m_manager->m_currentStep = static_cast<int>(keyframe.step) + 1;
+    m_manager->m_gameOver = false;
+    m_currentStep = keyframe.step;
+}
+
+void GameReplayer::playNextStep() {
+    m_feed.step = m_currentStep + 1;
+    m_manager->playStep();
+    m_currentStep++;
+
+    if (m_currentStep % m_keyframeInterval == 0 &&
+        m_currentStep > m_keyframes.back().step) {
+        saveKeyframe();
+    }
+}
+
+bool GameReplayer::seekStep(size_t step) {
+    if (!m_manager || step > m_stepCount) {
+        return false;
+    }
+
+    // Start from the latest keyframe at or before the step, unless the
+    // current state is already closer
+    auto keyframe = m_keyframes.end();
+    for (auto it = m_keyframes.begin(); it != m_keyframes.end() && it->step <= step; ++it) {
+        keyframe = it;
+    }
+    if (step < m_currentStep || keyframe->step > m_currentStep) {
+        restoreKeyframe(*keyframe);
+    }
+
+    while (m_currentStep < step) {
+        playNextStep();
+    }
+    return true;
+}
+
+const std::string& GameReplayer::getError() const {
+    return m_error;
+}
+
+size_t GameReplayer::getStepCount() const {
+    return m_stepCount;
+}
+
+size_t GameReplayer::getCurrentStep() const {
+    return m_currentStep;
+}
+
+size_t GameReplayer::getKeyframeCount() const {
+    return m_keyframes.size();
+}
+
+const GameBoard& GameReplayer::getBoard() const {
+    return m_manager->m_board;
+}
+
+const std::vector<Tank>& GameReplayer::getTanks() const {
+    return m_manager->m_tanks;
+}
+
+const std::vector<Shell>& GameReplayer::getShells() const {
+    return m_manager->m_shells;
+}
+
+int GameReplayer::getRemainingSteps() const {
+    return m_manager->m_remaining_steps;
+}
+
+} // namespace GameManager_318835816_211314471
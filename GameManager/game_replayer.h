@@ -0,0 +1,138 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "game_manager.h"
+#include "game_board.h"
+#include "objects/shell.h"
+#include "objects/tank.h"
+#include "replay/replay_reader.h"
+#include "common/ActionRequest.h"
+
+namespace GameManager_318835816_211314471 {
+
+using namespace UserCommon_318835816_211314471;
+
+/**
+ * @brief Re-simulates a recorded game to any step without its algorithms
+ *
+ * The recorded actions are fed through the game manager's own step
+ * pipeline (actions, shell movement and collisions), so the rebuilt state
+ * is exactly the one the original game had. Keyframes of the full game
+ * state are kept every few steps while simulating, so seeking only
+ * re-simulates from the nearest keyframe at or before the target step.
+ */
+class GameReplayer {
+public:
+    /** Default number of steps between keyframes */
+    static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 256;
+
+    /**
+     * @brief Construct a replayer
+     * @param keyframeInterval Steps between keyframes, 0 is treated as 1
+     */
+    explicit GameReplayer(size_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+    ~GameReplayer();
+
+    // The simulated algorithms point back into the replayer
+    GameReplayer(const GameReplayer&) = delete;
+    GameReplayer& operator=(const GameReplayer&) = delete;
+
+    /**
+     * @brief Load a game from a loaded replay
+     *
+     * Reads the initial state and the action trace, the replay can be
+     * discarded afterwards.
+     *
+     * @param reader A reader with a successfully loaded replay
+     * @return true if the game was loaded, false otherwise (see getError)
+     */
+    bool load(ReplayReader& reader);
+
+    /**
+     * @brief Load a game from a replay file
+     *
+     * @param filePath Path of the replay file
+     * @return true if the game was loaded, false otherwise (see getError)
+     */
+    bool loadFromFile(const std::string& filePath);
+
+    /**
+     * @brief Gets the reason the last load failed
+     */
+    const std::string& getError() const;
+
+    /**
+     * @brief Gets the number of recorded steps
+     */
+    size_t getStepCount() const;
+
+    /**
+     * @brief Moves to the state after the given step
+     *
+     * @param step The step to move to, 0 is the initial state
+     * @return true if the step exists, false otherwise
+     */
+    bool seekStep(size_t step);
+
+    /**
+     * @brief Gets the step of the current state
+     */
+    size_t getCurrentStep() const;
+
+    /**
+     * @brief Gets the number of keyframes taken so far
+     */
+    size_t getKeyframeCount() const;
+
+    // Current game state, valid once a game is loaded
+    const GameBoard& getBoard() const;
+    const std::vector<Tank>& getTanks() const;
+    const std::vector<Shell>& getShells() const;
+
+    /**
+     * @brief Gets the number of steps left once all tanks are out of shells
+     */
+    int getRemainingSteps() const;
+
+private:
+    // Full game manager state at a step
+    struct Keyframe {
+        size_t step;
+        GameBoard board;
+        std::vector<Tank> tanks;
+        std::vector<Shell> shells;
+        int remainingSteps;
+    };
+
+    // Recorded actions, read by the simulated tank algorithms
+    struct ActionFeed {
+        std::vector<ActionRequest> actions; // step-major, one per tank
+        size_t tankCount = 0;
+        size_t step = 0;                    // Step being simulated, 1-based
+    };
+
+    // Set up a game manager with the initial state of the replay
+    bool createManager(ReplayReader& reader);
+    void saveKeyframe();
+    void restoreKeyframe(const Keyframe& keyframe);
+
+    // Simulate the step after the current one
+    void playNextStep();
+
+    size_t m_keyframeInterval;
+    std::string m_error;
+    size_t m_stepCount = 0;
+
+    ActionFeed m_feed;
+    std::unique_ptr<MyGameManager_318835816_211314471> m_manager;
+    size_t m_currentStep = 0;
+
+    // Keyframes sorted by step, the first is the initial state
+    std::vector<Keyframe> m_keyframes;
+};
+
+} // namespace GameManager_318835816_211314471
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include "game_replayer.h"
+#include "test/helpers/file_test_helper.h"
+#include "test/helpers/game_scenario_builder.h"
+#include "replay/replay_reader.h"
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace GameManager_318835816_211314471 {
+
+using namespace UserCommon_318835816_211314471;
+
+namespace {
+
+// Picks actions at random, seeded per tank so games are repeatable
+class RandomTankAlgorithm : public TankAlgorithm {
+public:
+    RandomTankAlgorithm(unsigned seed, bool peaceful) : m_rng(seed), m_peaceful(peaceful) {}
+
+    ActionRequest getAction() override {
+        auto action = static_cast<ActionRequest>(m_rng() % 9);
+        if (m_peaceful && (action == ActionRequest::Shoot ||
+                           action == ActionRequest::GetBattleInfo)) {
+            return ActionRequest::DoNothing;
+        }
+        // Shoot less often so games last a while
+        if (action == ActionRequest::Shoot && m_rng() % 4 != 0) {
+            return ActionRequest::MoveForward;
+        }
+        return action;
+    }
+    void updateBattleInfo(BattleInfo& /*info*/) override {}
+
+private:
+    std::mt19937 m_rng;
+    bool m_peaceful;
+};
+
+TankAlgorithmFactory randomFactory(unsigned seed, bool peaceful) {
+    return [seed, peaceful](int playerIndex, int tankIndex) {
+        return std::make_unique<RandomTankAlgorithm>(
+            seed * 100 + playerIndex * 10 + tankIndex, peaceful);
+    };
+}
+
+} // namespace
+
+class GameReplayerTest : public ::testing::Test {
+protected:
+    std::unique_ptr<FileTestHelper> fileHelper;
+
+    void SetUp() override {
+        fileHelper = std::make_unique<FileTestHelper>();
+    }
+
+    // Plays a verbose game with random actions and loads its replay.
+    // A peaceful game keeps every tank walled in its own quarter and never
+    // shoots or asks for battle info, so it runs to the step limit.
+    void recordRandomGame(unsigned seed, size_t maxSteps, ReplayReader& reader,
+                          bool peaceful = false) {
+        GameScenarioBuilder builder;
+        builder.withBoardSize(12, 8)
+            .withTanks({Point(2, 2), Point(9, 6), Point(2, 6), Point(9, 2)})
+            .withMaxSteps(maxSteps)
+            .withNumShells(20);
+        if (peaceful) {
+            builder.withVerticalWall(0, 0, 7)
+                .withVerticalWall(6, 0, 7)
+                .withHorizontalWall(0, 0, 11)
+                .withHorizontalWall(4, 0, 11);
+        } else {
+            builder.withHorizontalWall(4, 3, 8)
+                .withVerticalWall(6, 5, 7)
+                .withMines({Point(4, 5), Point(8, 1)});
+        }
+        auto [satelliteView, player1, player2, width, height, steps, numShells] = builder.build();
+
+        MyGameManager_318835816_211314471 manager(true);
+        manager.run(width, height, satelliteView, "replay_map", steps, numShells,
+                    *player1, "Player1", *player2, "Player2",
+                    randomFactory(seed, peaceful), randomFactory(seed + 1000, peaceful));
+
+        std::string replayName;
+        for (const auto& newFile : fileHelper->getNewGameFiles()) {
+            if (FileTestHelper::endsWith(newFile, ".replay")) {
+                replayName = newFile;
+            }
+        }
+        ASSERT_TRUE(reader.loadFromFile(replayName)) << reader.getError();
+        fileHelper->cleanupTestFiles();
+    }
+
+    static void expectSameState(const GameReplayer& replayer, const ReplayReader& reader) {
+        const GameBoard& board = replayer.getBoard();
+        for (size_t y = 0; y < board.getHeight(); ++y) {
+            for (size_t x = 0; x < board.getWidth(); ++x) {
+                Point cell(x, y);
+                ASSERT_EQ(board.getCellType(cell), reader.getBoard().getCellType(cell)) << cell;
+                ASSERT_EQ(board.getWallHealth(cell), reader.getBoard().getWallHealth(cell)) << cell;
+            }
+        }
+
+        ASSERT_EQ(replayer.getTanks().size(), reader.getTanks().size());
+        for (size_t i = 0; i < reader.getTanks().size(); ++i) {
+            const Tank& tank = replayer.getTanks()[i];
+            const ReplayTankState& expected = reader.getTanks()[i];
+            EXPECT_EQ(tank.getPosition(), expected.position);
+            EXPECT_EQ(tank.getDirection(), expected.direction);
+            EXPECT_EQ(tank.getRemainingShells(), expected.remainingShells);
+            EXPECT_EQ(tank.isDestroyed(), expected.destroyed);
+        }
+
+        ASSERT_EQ(replayer.getShells().size(), reader.getShells().size());
+        for (size_t i = 0; i < reader.getShells().size(); ++i) {
+            EXPECT_EQ(replayer.getShells()[i].getPosition(), reader.getShells()[i].position);
+            EXPECT_EQ(replayer.getShells()[i].getDirection(), reader.getShells()[i].direction);
+        }
+    }
+};
+
+TEST_F(GameReplayerTest, SeekStep_MatchesRecordedGameAtEveryStep) {
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        ReplayReader reader;
+        recordRandomGame(seed, 200, reader);
+        if (HasFatalFailure()) return;
+
+        GameReplayer replayer(16);
+        ASSERT_TRUE(replayer.load(reader)) << replayer.getError();
+        ASSERT_EQ(replayer.getStepCount(), reader.getStepCount());
+
+        for (size_t step = 0; step <= reader.getStepCount(); ++step) {
+            ASSERT_TRUE(replayer.seekStep(step));
+            ASSERT_TRUE(reader.seekStep(step));
+            SCOPED_TRACE("seed " + std::to_string(seed) + " step " + std::to_string(step));
+            expectSameState(replayer, reader);
+            if (HasFatalFailure()) return;
+        }
+    }
+}
+
+TEST_F(GameReplayerTest, SeekStep_BackwardUsesKeyframes) {
+    ReplayReader reader;
+    recordRandomGame(7, 300, reader, true);
+    if (HasFatalFailure()) return;
+
+    GameReplayer replayer(10);
+    ASSERT_TRUE(replayer.load(reader)) << replayer.getError();
+    EXPECT_EQ(replayer.getKeyframeCount(), 1u);
+
+    size_t last = replayer.getStepCount();
+    ASSERT_TRUE(replayer.seekStep(last));
+    EXPECT_EQ(replayer.getKeyframeCount(), 1u + last / 10);
+
+    // Seeking back and forth does not take more keyframes
+    for (size_t step : {last / 2, size_t(3), last, size_t(0), last - 1}) {
+        ASSERT_TRUE(replayer.seekStep(step));
+        EXPECT_EQ(replayer.getCurrentStep(), step);
+        ASSERT_TRUE(reader.seekStep(step));
+        expectSameState(replayer, reader);
+    }
+    EXPECT_EQ(replayer.getKeyframeCount(), 1u + last / 10);
+
+    EXPECT_FALSE(replayer.seekStep(last + 1));
+    EXPECT_EQ(replayer.getCurrentStep(), last - 1);
+}
+
+TEST_F(GameReplayerTest, Load_FailsWithoutReplay) {
+    GameReplayer replayer;
+    EXPECT_FALSE(replayer.loadFromFile("missing_game.replay"));
+    EXPECT_FALSE(replayer.getError().empty());
+    EXPECT_FALSE(replayer.seekStep(0));
+}
+
+TEST_F(GameReplayerTest, DISABLED_Benchmark_SeekLateStep) {
+    ReplayReader reader;
+    recordRandomGame(11, 10000, reader, true);
+    if (HasFatalFailure()) return;
+
+    GameReplayer replayer;
+    ASSERT_TRUE(replayer.load(reader)) << replayer.getError();
+    size_t target = replayer.getStepCount() * 9 / 10;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(replayer.seekStep(target));
+    auto firstSeek = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(replayer.seekStep(0));
+    ASSERT_TRUE(replayer.seekStep(target));
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double coldTime = std::chrono::duration<double>(firstSeek - start).count();
+    double warmTime = std::chrono::duration<double>(end - firstSeek).count();
+    RecordProperty("first_seek_ms", std::to_string(coldTime * 1000));
+    RecordProperty("keyframe_seek_ms", std::to_string(warmTime * 1000));
+
+    ASSERT_TRUE(reader.seekStep(target));
+    expectSameState(replayer, reader);
+}
+
+} // namespace GameManager_318835816_211314471
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "UserCommon/game_board.h"
+#include "UserCommon/objects/shell.h"
+#include "UserCommon/objects/tank.h"
+#include "UserCommon/utils/midpoint.h"
+
+namespace GameManager_318835816_211314471 {
+
+using namespace UserCommon_318835816_211314471;
+
+/**
+ * @brief Straightforward collision resolver used as a test oracle
+ *
+ * Pairwise path checks and ordered containers, exactly as CollisionHandler
+ * resolved collisions before it moved to flat grids. Differential tests
+ * compare the two on the same inputs.
+ */
+class ReferenceCollisionHandler {
+public:
+    void resolveAllCollisions(std::vector<Tank>& tanks,
+                              std::vector<Shell>& shells,
+                              GameBoard& board) {
+        m_positionExplosions.clear();
+        m_pathExplosions.clear();
+        m_boardWidth = board.getWidth();
+        m_boardHeight = board.getHeight();
+
+        detectPathCollisions(tanks, shells);
+        applyPathExplosions(tanks, shells);
+
+        for (Shell& shell : shells) {
+            if (!shell.isDestroyed() && board.isWall(shell.getPosition())) {
+                board.damageWall(shell.getPosition());
+                m_positionExplosions.insert(shell.getPosition());
+            }
+        }
+
+        detectPositionCollisions(tanks, shells);
+        applyPositionExplosions(tanks, shells, board);
+
+        for (Tank& tank : tanks) {
+            if (!tank.isDestroyed() &&
+                board.getCellType(tank.getPosition()) == GameBoard::CellType::Mine) {
+                tank.destroy();
+                board.setCellType(tank.getPosition(), GameBoard::CellType::Empty);
+                m_positionExplosions.insert(tank.getPosition());
+            }
+        }
+    }
+
+    const std::set<MidPoint>& getPathExplosions() const { return m_pathExplosions; }
+    const std::set<Point>& getPositionExplosions() const { return m_positionExplosions; }
+
+private:
+    struct MovingObject {
+        Point prev;
+        Point curr;
+    };
+
+    void detectPathCollisions(const std::vector<Tank>& tanks,
+                              const std::vector<Shell>& shells) {
+        std::vector<MovingObject> objects;
+        for (const Tank& tank : tanks) {
+            if (!tank.isDestroyed()) {
+                objects.push_back({tank.getPreviousPosition(), tank.getPosition()});
+            }
+        }
+        for (const Shell& shell : shells) {
+            if (!shell.isDestroyed()) {
+                objects.push_back({shell.getPreviousPosition(), shell.getPosition()});
+            }
+        }
+
+        for (size_t i = 0; i < objects.size(); ++i) {
+            for (size_t j = i + 1; j < objects.size(); ++j) {
+                if (MidPoint::midpointsMatch(objects[i].prev, objects[i].curr,
+                                             objects[j].prev, objects[j].curr,
+                                             m_boardWidth, m_boardHeight)) {
+                    MidPoint mp = MidPoint::calculateMidpoint(
+                        objects[i].prev, objects[i].curr, m_boardWidth, m_boardHeight);
+                    if (mp.getX() != -1) {
+                        m_pathExplosions.insert(mp);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename Object>
+    bool crossesPathExplosion(const Object& object) const {
+        MidPoint mp = MidPoint::calculateMidpoint(
+            object.getPreviousPosition(), object.getPosition(),
+            m_boardWidth, m_boardHeight);
+        return mp.getX() != -1 && m_pathExplosions.count(mp) > 0;
+    }
+
+    void applyPathExplosions(std::vector<Tank>& tanks, std::vector<Shell>& shells) {
+        for (Tank& tank : tanks) {
+            if (!tank.isDestroyed() && crossesPathExplosion(tank)) {
+                tank.destroy();
+            }
+        }
+        for (Shell& shell : shells) {
+            if (!shell.isDestroyed() && crossesPathExplosion(shell)) {
+                shell.destroy();
+            }
+        }
+    }
+
+    void detectPositionCollisions(const std::vector<Tank>& tanks,
+                                  const std::vector<Shell>& shells) {
+        std::map<Point, int> positionCounts;
+        for (const Tank& tank : tanks) {
+            if (!tank.isDestroyed()) {
+                positionCounts[tank.getPosition()]++;
+            }
+        }
+        for (const Shell& shell : shells) {
+            if (!shell.isDestroyed()) {
+                positionCounts[shell.getPosition()]++;
+            }
+        }
+        for (const auto& [pos, count] : positionCounts) {
+            if (count >= 2) {
+                m_positionExplosions.insert(pos);
+            }
+        }
+    }
+
+    void applyPositionExplosions(std::vector<Tank>& tanks,
+                                 std::vector<Shell>& shells,
+                                 GameBoard& board) {
+        for (Tank& tank : tanks) {
+            if (!tank.isDestroyed() && m_positionExplosions.count(tank.getPosition())) {
+                tank.destroy();
+            }
+        }
+        for (Shell& shell : shells) {
+            if (!shell.isDestroyed() && m_positionExplosions.count(shell.getPosition())) {
+                shell.destroy();
+            }
+        }
+        for (const Point& pos : m_positionExplosions) {
+            if (board.getCellType(pos) == GameBoard::CellType::Mine) {
+                board.setCellType(pos, GameBoard::CellType::Empty);
+            }
+        }
+    }
+
+    std::set<MidPoint> m_pathExplosions;
+    std::set<Point> m_positionExplosions;
+    int m_boardWidth = 0;
+    int m_boardHeight = 0;
+};
+
+} // namespace GameManager_318835816_211314471
@@ -179,10 +179,10 @@ GameResult ComparativeRunner::executeGameLogic(const BaseParameters& params) {
         }
     }
     
-    // Create ThreadPool based on parameters
+    // Create the thread pool based on parameters
     size_t numThreads = comparativeParams->numThreads;
 
-    ThreadPool threadPool(numThreads);
+    WorkStealingThreadPool threadPool(numThreads);
     std::vector<std::future<ComparativeResult>> futures;
     
     // Submit tasks to thread pool for parallel execution using loaded GameManager info
@@ -9,7 +9,7 @@
 #include "base_game_mode.h"
 #include "game_runner.h"
 #include "utils/file_loader.h"
-#include "utils/thread_pool.h"
+#include "utils/work_stealing_thread_pool.h"
 #include "utils/error_collector.h"
 #include "common/GameResult.h"
 
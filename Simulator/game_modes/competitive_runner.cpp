@@ -6,7 +6,6 @@
 #include <algorithm>
 #include <set>
 #include <memory>
-#include <future>
 #include <dlfcn.h>
 #include "utils/library_manager.h"
 #include "registration/GameManagerRegistrar.h"
@@ -157,17 +156,43 @@ bool CompetitiveRunner::loadMapsImpl(const CompetitiveParameters& params) {
             return false;
         }
         
+        // Each map is read once, in parallel, into results of its own
+        struct MapLoad {
+            MapInfo info;
+            FileLoader::BoardInfo board{};
+            ErrorCollector errors;
+        };
+        std::vector<MapLoad> loads(mapFiles.size());
+        std::unique_ptr<MapCache> cache;
+        if (!params.mapCacheFolder.empty()) {
+            cache = std::make_unique<MapCache>(params.mapCacheFolder);
+        }
+        {
+            WorkStealingThreadPool threadPool(params.numThreads);
+            for (size_t i = 0; i < mapFiles.size(); ++i) {
+                threadPool.submit([this, &mapFiles, &loads, &cache, i]() {
+                    MapLoad& load = loads[i];
+                    try {
+                        load.info = loadMapFile(mapFiles[i], load.board, load.errors, cache.get());
+                    } catch (const std::exception& e) {
+                        load.info.path = mapFiles[i];
+                        load.info.name = extractFileName(mapFiles[i]);
+                        load.info.loaded = false;
+                        load.errors.addMapError(load.info.name, "Failed to load map: " + std::string(e.what()));
+                    }
+                });
+            }
+            threadPool.waitForAll();
+        }
+
+        // Merged in file order, so errors and map indices match a serial load
         m_discoveredMaps.clear();
         m_loadedMaps.clear();
-        for (const auto& file : mapFiles) {
-            auto info = loadMapFile(file);
-            if (info.loaded) {
-                m_discoveredMaps.push_back(std::move(info));
-                // Also load the actual map data for game execution
-                auto boardInfo = FileLoader::loadBoardWithSatelliteView(file, m_errorCollector);
-                if (boardInfo.satelliteView) {
-                    m_loadedMaps.push_back(std::move(boardInfo));
-                }
+        for (MapLoad& load : loads) {
+            m_errorCollector.addAll(load.errors);
+            if (load.info.loaded) {
+                m_discoveredMaps.push_back(std::move(load.info));
+                m_loadedMaps.push_back(std::move(load.board));
             }
         }
         
@@ -201,42 +226,24 @@ GameResult CompetitiveRunner::executeGameLogic(const BaseParameters& params) {
     
     m_finalScores.clear();
     
-    // Create ThreadPool based on parameters
-    size_t numThreads = competitiveParams->numThreads;
+    std::vector<ScoreCounters> scores(m_discoveredAlgorithms.size());
 
-    ThreadPool threadPool(numThreads);
-    std::vector<std::future<void>> futures;
-    std::unordered_map<int, AlgorithmScore> scores;
-    int numAlgorithms = static_cast<int>(m_discoveredAlgorithms.size());
-    
-    // For each map, generate pairings and submit parallel tasks
-    for (int mapIndex = 0; mapIndex < static_cast<int>(m_discoveredMaps.size()); ++mapIndex) {
-        auto pairings = generatePairings(numAlgorithms, mapIndex);
-        
-        for (const auto& pairing : pairings) {
-            // Submit each match as a parallel task
-            auto future = threadPool.enqueue([this, pairing, mapIndex, competitiveParams, &scores]() {
-                try {
-                    auto result = executeMatch(pairing.first, pairing.second, mapIndex, *competitiveParams);
-                    std::lock_guard<std::mutex> lock(m_scoresMutex);
-                    updateScores(pairing.first, pairing.second, result, scores);
-                } catch (const std::exception& e) {
-                    std::cout << "Error: Unexpected exception during match execution: " << e.what() << std::endl;
-                }
-            });
-            futures.push_back(std::move(future));
-        }
+    // Most expensive matches first, so no long match starts last
+    MatchScheduler scheduler;
+    std::vector<MatchScheduler::Match> matches = scheduleMatches(*competitiveParams, scheduler);
+
+    if (competitiveParams->sandbox) {
+        runSandboxedMatches(matches, *competitiveParams, scores);
+    } else {
+        runMatches(matches, *competitiveParams, scores);
     }
-    
-    // Wait for all matches to complete
-    for (auto& future : futures) {
-        try {
-            future.get();
-        } catch (const std::exception& e) {
-            std::cout << "Error: Unexpected exception during thread execution: " << e.what() << std::endl;
-        }
+    m_gameManagerPool.clear();
+
+    if (!competitiveParams->matchHistoryFile.empty() &&
+        !scheduler.saveReport(competitiveParams->matchHistoryFile, matches)) {
+        std::cerr << "Warning: Cannot write match history " << competitiveParams->matchHistoryFile << std::endl;
     }
-    
+
     // Sort scores and store them
     m_finalScores = sortByScore(scores);
     
@@ -258,14 +265,23 @@ void CompetitiveRunner::displayResults(const GameResult& /* result */) {
     }
 }
 
-CompetitiveRunner::MapInfo CompetitiveRunner::loadMapFile(const std::string& mapPath) {
+CompetitiveRunner::MapInfo CompetitiveRunner::loadMapFile(const std::string& mapPath, FileLoader::BoardInfo& boardInfo,
+                                                          ErrorCollector& errors, const MapCache* cache) const {
     MapInfo info;
     info.path = mapPath;
     info.name = extractFileName(mapPath);
     info.loaded = false;
     
-    // Load map using FileSatelliteView validation
-    auto boardInfo = FileLoader::loadBoardWithSatelliteView(mapPath, m_errorCollector);
+    // Stamped before parsing, so an edit during the parse is not cached
+    MapCache::FileStamp stamp;
+    bool stamped = cache && MapCache::stampFile(mapPath, stamp);
+
+    // A cached board was validated when it was stored
+    bool cached = stamped && cache->load(mapPath, boardInfo);
+    if (!cached) {
+        // Load map using FileSatelliteView validation
+        boardInfo = FileLoader::loadBoardWithSatelliteView(mapPath, errors);
+    }
     
     if (!boardInfo.satelliteView) {
         // File loading failed - detailed error already added to ErrorCollector by FileLoader
@@ -278,7 +294,7 @@ CompetitiveRunner::MapInfo CompetitiveRunner::loadMapFile(const std::string& map
         // Invalid map - exclude from tournament
         std::string error = boardInfo.getErrorReason();
         info.error = error;
-        m_errorCollector.addMapError(boardInfo.mapName, error);
+        errors.addMapError(boardInfo.mapName, error);
         return info;
     }
 
@@ -287,10 +303,15 @@ CompetitiveRunner::MapInfo CompetitiveRunner::loadMapFile(const std::string& map
     if (!warnings.empty()) {
         // Valid map with warnings - include in tournament but log warnings
         for (const auto& warning : warnings) {
-            m_errorCollector.addMapWarning(boardInfo.mapName, warning);
+            errors.addMapWarning(boardInfo.mapName, warning);
         }
     }
 
+    if (stamped && !cached) {
+        // Failing to cache only costs a parse on the next run
+        cache->store(stamp, boardInfo);
+    }
+
     // Map is valid and can be used in tournament
     info.loaded = true;
     return info;
@@ -310,6 +331,8 @@ void CompetitiveRunner::cleanup() {
     GameManagerRegistrar& gmRegistrar = GameManagerRegistrar::getGameManagerRegistrar();
     AlgorithmRegistrar& algoRegistrar = AlgorithmRegistrar::getAlgorithmRegistrar();
     
+    // Pooled managers run code from the libraries
+    m_gameManagerPool.clear();
     gmRegistrar.clear();
     algoRegistrar.clear();
     m_libraryManager.unloadAllLibraries();
@@ -416,7 +439,8 @@ GameResult CompetitiveRunner::executeMatch(int algorithm1Index, int algorithm2In
             gameManagerName,
             algorithm1Name,
             algorithm2Name,
-            params.verbose
+            params.verbose,
+            params.reuseGameManagers ? &m_gameManagerPool : nullptr
         );        
     } catch (const std::exception& e) {
         // Should not happen
@@ -427,34 +451,102 @@ GameResult CompetitiveRunner::executeMatch(int algorithm1Index, int algorithm2In
     return result;
 }
 
-void CompetitiveRunner::updateScores(int algorithm1Index, int algorithm2Index, const GameResult& result, std::unordered_map<int, AlgorithmScore>& scores) {
-    // Initialize scores for algorithms if not already present
-    if (scores.find(algorithm1Index) == scores.end()) {
-        scores[algorithm1Index] = AlgorithmScore{};
-        scores[algorithm1Index].algorithmName = m_discoveredAlgorithms[algorithm1Index].name;
+std::vector<MatchScheduler::Match> CompetitiveRunner::scheduleMatches(const CompetitiveParameters& params, MatchScheduler& scheduler) {
+    std::vector<MatchScheduler::Match> matches;
+    int numAlgorithms = static_cast<int>(m_discoveredAlgorithms.size());
+    int numMaps = static_cast<int>(std::min(m_discoveredMaps.size(), m_loadedMaps.size()));
+
+    // For each map, generate pairings with the map's estimated cost
+    for (int mapIndex = 0; mapIndex < numMaps; ++mapIndex) {
+        double cost = MatchScheduler::estimateCost(m_loadedMaps[mapIndex]);
+
+        for (const auto& pairing : generatePairings(numAlgorithms, mapIndex)) {
+            MatchScheduler::Match match;
+            match.algorithm1Index = pairing.first;
+            match.algorithm2Index = pairing.second;
+            match.mapIndex = mapIndex;
+            match.mapName = m_discoveredMaps[mapIndex].name;
+            match.algorithm1Name = m_discoveredAlgorithms[pairing.first].name;
+            match.algorithm2Name = m_discoveredAlgorithms[pairing.second].name;
+            match.cost = cost;
+            matches.push_back(std::move(match));
+        }
     }
-    if (scores.find(algorithm2Index) == scores.end()) {
-        scores[algorithm2Index] = AlgorithmScore{};
-        scores[algorithm2Index].algorithmName = m_discoveredAlgorithms[algorithm2Index].name;
+
+    // A missing history file is expected on the first run
+    if (!params.matchHistoryFile.empty()) {
+        scheduler.loadHistory(params.matchHistoryFile);
+    }
+    scheduler.schedule(matches);
+    return matches;
+}
+
+void CompetitiveRunner::runMatches(std::vector<MatchScheduler::Match>& matches, const CompetitiveParameters& params, std::vector<ScoreCounters>& scores) {
+    // Create the thread pool based on parameters
+    WorkStealingThreadPool threadPool(params.numThreads);
+
+    for (MatchScheduler::Match& match : matches) {
+        // Submit each match as a parallel task, scores are its only output
+        threadPool.submit([this, &match, &params, &scores]() {
+            try {
+                auto start = std::chrono::steady_clock::now();
+                auto result = executeMatch(match.algorithm1Index, match.algorithm2Index, match.mapIndex, params);
+                match.actualSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                updateScores(match.algorithm1Index, match.algorithm2Index, result, scores);
+            } catch (const std::exception& e) {
+                std::cout << "Error: Unexpected exception during match execution: " << e.what() << std::endl;
+            }
+        });
     }
     
+    // Wait for all matches to complete
+    threadPool.waitForAll();
+}
+
+void CompetitiveRunner::runSandboxedMatches(std::vector<MatchScheduler::Match>& matches, const CompetitiveParameters& params, std::vector<ScoreCounters>& scores) {
+    // Workers are forked with the libraries already loaded, one per thread
+    ProcessSandbox sandbox(params.numThreads, params.matchLimits, [this, &matches, &params](size_t index) {
+        const MatchScheduler::Match& match = matches[index];
+        return executeMatch(match.algorithm1Index, match.algorithm2Index, match.mapIndex, params);
+    });
+
+    std::vector<ProcessSandbox::MatchOutcome> outcomes = sandbox.runMatches(matches.size());
+    for (size_t i = 0; i < matches.size(); ++i) {
+        MatchScheduler::Match& match = matches[i];
+        match.actualSeconds = outcomes[i].seconds;
+        if (outcomes[i].completed) {
+            updateScores(match.algorithm1Index, match.algorithm2Index, outcomes[i].result, scores);
+        } else {
+            std::cerr << "Warning: Match " << match.algorithm1Name << " vs " << match.algorithm2Name
+                      << " on " << match.mapName << " was not scored: " << outcomes[i].error << std::endl;
+        }
+    }
+}
+
+void CompetitiveRunner::updateScores(int algorithm1Index, int algorithm2Index, const GameResult& result, std::vector<ScoreCounters>& scores) {
+    ScoreCounters& algorithm1 = scores[algorithm1Index];
+    ScoreCounters& algorithm2 = scores[algorithm2Index];
+
+    // Counters are only read after all matches finished, no ordering needed
+    constexpr auto order = std::memory_order_relaxed;
+
     // Apply 3-1-0 scoring system based on game result
     if (result.winner == 0) {
         // Tie - both algorithms get 1 point
-        scores[algorithm1Index].totalScore += 1;
-        scores[algorithm1Index].ties++;
-        scores[algorithm2Index].totalScore += 1;
-        scores[algorithm2Index].ties++;
+        algorithm1.totalScore.fetch_add(1, order);
+        algorithm1.ties.fetch_add(1, order);
+        algorithm2.totalScore.fetch_add(1, order);
+        algorithm2.ties.fetch_add(1, order);
     } else if (result.winner == 1) {
         // Algorithm 1 wins - gets 3 points, algorithm 2 gets 0
-        scores[algorithm1Index].totalScore += 3;
-        scores[algorithm1Index].wins++;
-        scores[algorithm2Index].losses++;
+        algorithm1.totalScore.fetch_add(3, order);
+        algorithm1.wins.fetch_add(1, order);
+        algorithm2.losses.fetch_add(1, order);
     } else if (result.winner == 2) {
         // Algorithm 2 wins - gets 3 points, algorithm 1 gets 0
-        scores[algorithm2Index].totalScore += 3;
-        scores[algorithm2Index].wins++;
-        scores[algorithm1Index].losses++;
+        algorithm2.totalScore.fetch_add(3, order);
+        algorithm2.wins.fetch_add(1, order);
+        algorithm1.losses.fetch_add(1, order);
     }
 }
 
@@ -484,12 +576,20 @@ void CompetitiveRunner::generateOutput(const std::vector<AlgorithmScore>& scores
     }
 }
 
-std::vector<CompetitiveRunner::AlgorithmScore> CompetitiveRunner::sortByScore(const std::unordered_map<int, AlgorithmScore>& scores) {
+std::vector<CompetitiveRunner::AlgorithmScore> CompetitiveRunner::sortByScore(const std::vector<ScoreCounters>& scores) {
     std::vector<AlgorithmScore> sortedScores;
     
-    // Extract all algorithm scores from the map
-    for (const auto& pair : scores) {
-        sortedScores.push_back(pair.second);
+    // Extract the scores of all algorithms that finished a match
+    for (size_t i = 0; i < scores.size(); ++i) {
+        AlgorithmScore score;
+        score.algorithmName = m_discoveredAlgorithms[i].name;
+        score.totalScore = scores[i].totalScore.load(std::memory_order_relaxed);
+        score.wins = scores[i].wins.load(std::memory_order_relaxed);
+        score.ties = scores[i].ties.load(std::memory_order_relaxed);
+        score.losses = scores[i].losses.load(std::memory_order_relaxed);
+        if (score.wins + score.ties + score.losses > 0) {
+            sortedScores.push_back(std::move(score));
+        }
     }
     
     // Sort by total score in descending order (highest scores first)
@@ -500,4 +600,4 @@ std::vector<CompetitiveRunner::AlgorithmScore> CompetitiveRunner::sortByScore(co
         });
     
     return sortedScores;
-}
+}
\ No newline at end of file
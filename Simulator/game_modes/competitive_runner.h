@@ -5,12 +5,15 @@
 #include <memory>
 #include <filesystem>
 #include <chrono>
-#include <unordered_map>
-#include <mutex>
+#include <atomic>
 #include "base_game_mode.h"
 #include "game_runner.h"
 #include "utils/file_loader.h"
-#include "utils/thread_pool.h"
+#include "utils/game_manager_pool.h"
+#include "utils/map_cache.h"
+#include "utils/work_stealing_thread_pool.h"
+#include "utils/match_scheduler.h"
+#include "utils/process_sandbox.h"
 #include "utils/error_collector.h"
 #include "common/GameResult.h"
 
@@ -46,6 +49,11 @@ public:
         std::string gameManagerLib;
         std::string algorithmsFolder;
         size_t numThreads = 1;
+        std::string matchHistoryFile;  // Optional, empty to schedule by board cost only
+        std::string mapCacheFolder;    // Optional, empty to parse every map on each run
+        bool sandbox = false;          // Run matches in worker processes
+        bool reuseGameManagers = false; // Reset and reuse game managers between matches
+        ProcessSandbox::Limits matchLimits;
         
         CompetitiveParameters() : BaseParameters() {}
     };
@@ -87,11 +95,16 @@ protected:
 private:
 
     /**
-     * Load and validate map from file
+     * Load and validate map from file, reading it from the cache when possible
+     * Safe to call from several threads with separate boards and collectors
      * @param mapPath Path to map file
+     * @param board Filled with the loaded board
+     * @param errors Collects the errors and warnings of this map
+     * @param cache Map cache, or nullptr to always parse the file
      * @return MapInfo with load result
      */
-    MapInfo loadMapFile(const std::string& mapPath);
+    MapInfo loadMapFile(const std::string& mapPath, FileLoader::BoardInfo& board,
+                        ErrorCollector& errors, const MapCache* cache) const;
 
     /**
      * Generate algorithm pairings for given map index using competition formula
@@ -116,18 +129,66 @@ private:
         const CompetitiveParameters& params
     );
 
+    /**
+     * Collect all matches of the tournament in dispatch order, most
+     * expensive first (see MatchScheduler)
+     * @param params Competitive parameters
+     * @param scheduler Scheduler holding the match history, if any
+     * @return Matches to run
+     */
+    std::vector<MatchScheduler::Match> scheduleMatches(
+        const CompetitiveParameters& params,
+        MatchScheduler& scheduler
+    );
+
+    /**
+     * Score counters of one algorithm, updated by matches running in
+     * parallel without a lock. Each algorithm gets its own cache line.
+     */
+    struct alignas(64) ScoreCounters {
+        std::atomic<int> totalScore{0};
+        std::atomic<int> wins{0};
+        std::atomic<int> ties{0};
+        std::atomic<int> losses{0};
+    };
+
     /**
      * Update algorithm scores based on game result
      * @param algorithm1Index Index of first algorithm
      * @param algorithm2Index Index of second algorithm
      * @param result Game result
-     * @param scores Reference to scores map to update
+     * @param scores Score counters indexed by algorithm index
      */
     void updateScores(
         int algorithm1Index,
         int algorithm2Index,
         const GameResult& result,
-        std::unordered_map<int, AlgorithmScore>& scores
+        std::vector<ScoreCounters>& scores
+    );
+
+    /**
+     * Run the matches on a thread pool in this process
+     * @param matches Matches in dispatch order, actual durations are filled in
+     * @param params Competitive parameters
+     * @param scores Score counters indexed by algorithm index
+     */
+    void runMatches(
+        std::vector<MatchScheduler::Match>& matches,
+        const CompetitiveParameters& params,
+        std::vector<ScoreCounters>& scores
+    );
+
+    /**
+     * Run the matches in pre-forked worker processes (sandbox mode)
+     * A match that crashes, runs out of CPU time or memory is not scored
+     * @param matches Matches in dispatch order, actual durations are filled in
+     * @param params Competitive parameters
+     * @param scores Score counters indexed by algorithm index
+     */
+    void runSandboxedMatches(
+        std::vector<MatchScheduler::Match>& matches,
+        const CompetitiveParameters& params,
+        std::vector<ScoreCounters>& scores
     );
 
     /**
@@ -151,10 +212,11 @@ private:
 
     /**
      * Sort algorithms by score (descending order)
-     * @param scores Unsorted scores map
+     * Algorithms without a finished match are left out
+     * @param scores Score counters indexed by algorithm index
      * @return Sorted vector of algorithm scores
      */
-    std::vector<AlgorithmScore> sortByScore(const std::unordered_map<int, AlgorithmScore>& scores);
+    std::vector<AlgorithmScore> sortByScore(const std::vector<ScoreCounters>& scores);
 
     std::vector<AlgorithmInfo> m_discoveredAlgorithms;
     std::vector<MapInfo> m_discoveredMaps;
@@ -162,7 +224,5 @@ private:
     std::string m_gameManagerName;
     std::vector<AlgorithmScore> m_finalScores;
     ErrorCollector m_errorCollector;
-    
-    // Thread-safety for parallel execution
-    std::mutex m_scoresMutex;
+    GameManagerPool m_gameManagerPool;  // Only used with reuseGameManagers
 };
\ No newline at end of file
@@ -9,7 +9,8 @@ GameResult GameRunner::runSingleGame(
     const std::string& gameManagerName,
     const std::string& algorithm1Name,
     const std::string& algorithm2Name,
-    bool verbose
+    bool verbose,
+    GameManagerPool* gameManagerPool
 ) {
     // 1. Extract board information
     if (!boardInfo.satelliteView) {
@@ -69,8 +70,14 @@ GameResult GameRunner::runSingleGame(
     auto player1 = algo1It->getPlayerFactory()(1, mapWidth, mapHeight, maxSteps, numShells);
     auto player2 = algo2It->getPlayerFactory()(2, mapWidth, mapHeight, maxSteps, numShells);
     
-    // 5. Create GameManager
-    auto gameManager = gameManagerEntry->create(verbose);
+    // 5. Create GameManager, or reuse one from an earlier match
+    std::unique_ptr<AbstractGameManager> gameManager;
+    if (gameManagerPool) {
+        gameManager = gameManagerPool->acquire(gameManagerName, verbose);
+    }
+    if (!gameManager) {
+        gameManager = gameManagerEntry->create(verbose);
+    }
     
     // 6. Execute game using map name from board file
     GameResult result = gameManager->run(
@@ -84,5 +91,8 @@ GameResult GameRunner::runSingleGame(
         algo2It->getTankAlgorithmFactory()
     );
     
+    if (gameManagerPool) {
+        gameManagerPool->release(gameManagerName, verbose, std::move(gameManager));
+    }
     return result;
 }
\ No newline at end of file
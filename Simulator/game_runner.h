@@ -3,6 +3,7 @@
 #include <string>
 #include "common/GameResult.h"
 #include "utils/file_loader.h"
+#include "utils/game_manager_pool.h"
 
 class GameRunner {
 public:
@@ -11,7 +12,8 @@ public:
         const std::string& gameManagerName,
         const std::string& algorithm1Name,
         const std::string& algorithm2Name,
-        bool verbose = false
+        bool verbose = false,
+        GameManagerPool* gameManagerPool = nullptr
     );
 
 private:
@@ -77,6 +77,21 @@ int executeCompetitionMode(const CommandLineParser& parser) {
     if (numThreads.has_value()) {
         params.numThreads = numThreads.value();
     }
+
+    // Optional: match_history parameter
+    params.matchHistoryFile = parser.getMatchHistory();
+
+    // Optional: map_cache parameter
+    params.mapCacheFolder = parser.getMapCache();
+
+    // Optional: sandbox mode with per-match limits
+    params.sandbox = parser.isSandboxed();
+
+    // Optional: reuse our game managers between matches
+    params.reuseGameManagers = parser.isReusingGameManagers();
+    params.matchLimits.cpuSeconds = parser.getMatchCpuSeconds().value_or(0);
+    params.matchLimits.wallSeconds = parser.getMatchWallSeconds().value_or(ProcessSandbox::DEFAULT_WALL_SECONDS);
+    params.matchLimits.memoryMb = parser.getMatchMemoryMb().value_or(0);
     
     const auto& scores = runner.runCompetition(params);
     
@@ -4,7 +4,7 @@
 #include <sstream>
 
 CommandLineParser::CommandLineParser() 
-    : m_mode(Mode::Unknown), m_verbose(false), m_hasBasicFlag(false), m_hasComparativeFlag(false), m_hasCompetitionFlag(false) {
+    : m_mode(Mode::Unknown), m_verbose(false), m_sandbox(false), m_reuseGameManagers(false), m_hasBasicFlag(false), m_hasComparativeFlag(false), m_hasCompetitionFlag(false) {
 }
 
 CommandLineParser::~CommandLineParser() = default;
@@ -51,19 +51,23 @@ bool CommandLineParser::isVerbose() const {
 }
 
 std::optional<int> CommandLineParser::getNumThreads() const {
-    // Only return threads if supported by current mode
-    if (!isParameterSupported("num_threads")) {
+    return getPositiveParameter("num_threads");
+}
+
+std::optional<int> CommandLineParser::getPositiveParameter(const std::string& paramName) const {
+    // Only return the value if supported by current mode
+    if (!isParameterSupported(paramName)) {
         return std::nullopt;
     }
     
-    auto it = m_parameters.find("num_threads");
+    auto it = m_parameters.find(paramName);
     if (it == m_parameters.end()) {
         return std::nullopt;
     }
     
     try {
-        int threads = std::stoi(it->second);
-        return threads > 0 ? std::optional<int>(threads) : std::nullopt;
+        int value = std::stoi(it->second);
+        return value > 0 ? std::optional<int>(value) : std::nullopt;
     } catch (const std::exception&) {
         return std::nullopt;
     }
@@ -135,6 +139,38 @@ std::string CommandLineParser::getAlgorithmsFolder() const {
     return it != m_parameters.end() ? it->second : "";
 }
 
+std::string CommandLineParser::getMatchHistory() const {
+    if (m_mode != Mode::Competition) return "";
+    auto it = m_parameters.find("match_history");
+    return it != m_parameters.end() ? it->second : "";
+}
+
+std::string CommandLineParser::getMapCache() const {
+    if (m_mode != Mode::Competition) return "";
+    auto it = m_parameters.find("map_cache");
+    return it != m_parameters.end() ? it->second : "";
+}
+
+bool CommandLineParser::isSandboxed() const {
+    return m_mode == Mode::Competition && m_sandbox;
+}
+
+bool CommandLineParser::isReusingGameManagers() const {
+    return m_mode == Mode::Competition && m_reuseGameManagers;
+}
+
+std::optional<int> CommandLineParser::getMatchCpuSeconds() const {
+    return getPositiveParameter("match_cpu_seconds");
+}
+
+std::optional<int> CommandLineParser::getMatchWallSeconds() const {
+    return getPositiveParameter("match_wall_seconds");
+}
+
+std::optional<int> CommandLineParser::getMatchMemoryMb() const {
+    return getPositiveParameter("match_memory_mb");
+}
+
 std::string CommandLineParser::generateUsage(const std::string& programName) const {
     std::ostringstream usage;
     usage << "Usage:\n";
@@ -148,7 +184,9 @@ std::string CommandLineParser::generateUsage(const std::string& programName) con
     
     usage << "  Competition mode:\n";
     usage << "    " << programName << " -competition game_maps_folder=<folder> game_manager=<file> ";
-    usage << "algorithms_folder=<folder> [num_threads=<num>] [-verbose]\n\n";
+    usage << "algorithms_folder=<folder> [num_threads=<num>] [match_history=<file>] [map_cache=<folder>] ";
+    usage << "[-reuse_game_managers] ";
+    usage << "[-sandbox [match_cpu_seconds=<num>] [match_wall_seconds=<num>] [match_memory_mb=<num>]] [-verbose]\n\n";
     
     usage << "Notes:\n";
     usage << "  - All arguments can appear in any order\n";
@@ -162,6 +200,8 @@ std::string CommandLineParser::generateUsage(const std::string& programName) con
 void CommandLineParser::reset() {
     m_mode = Mode::Unknown;
     m_verbose = false;
+    m_sandbox = false;
+    m_reuseGameManagers = false;
     m_parameters.clear();
     m_positionalArgs.clear();
     m_missingParams.clear();
@@ -177,6 +217,10 @@ bool CommandLineParser::parseFlags(int argc, char* argv[]) {
         
         if (arg == "-verbose") {
             m_verbose = true;
+        } else if (arg == "-sandbox") {
+            m_sandbox = true;
+        } else if (arg == "-reuse_game_managers") {
+            m_reuseGameManagers = true;
         } else if (arg == "-basic") {
             m_hasBasicFlag = true;
         } else if (arg == "-comparative") {
@@ -190,10 +234,10 @@ bool CommandLineParser::parseFlags(int argc, char* argv[]) {
             // Key=value pair
             std::string key, value;
             if (parseKeyValue(arg, key, value)) {
-                if (key == "num_threads") {
+                if (isPositiveParameter(key)) {
                     try {
-                        int threads = std::stoi(value);
-                        if (threads > 0) {
+                        int number = std::stoi(value);
+                        if (number > 0) {
                             m_parameters[key] = value;
                         } else {
                             m_unsupportedParams.push_back(arg + " (must be positive)");
@@ -245,9 +289,20 @@ bool CommandLineParser::validateMode() {
     for (const auto& [key, value] : m_parameters) {
         if (!isParameterSupported(key)) {
             m_unsupportedParams.push_back(key + "=" + value);
+        } else if (!m_sandbox && (key == "match_cpu_seconds" || key == "match_wall_seconds" ||
+                                  key == "match_memory_mb")) {
+            m_unsupportedParams.push_back(key + "=" + value + " (requires -sandbox)");
         }
     }
     
+    // Only competition matches can run in worker processes
+    if (m_sandbox && m_mode != Mode::Competition) {
+        m_unsupportedParams.push_back("-sandbox");
+    }
+    if (m_reuseGameManagers && m_mode != Mode::Competition) {
+        m_unsupportedParams.push_back("-reuse_game_managers");
+    }
+    
     // Validate required parameters
     return validateRequiredParameters() && m_unsupportedParams.empty();
 }
@@ -294,6 +349,11 @@ std::vector<std::string> CommandLineParser::getRequiredParameters(Mode mode) con
     }
 }
 
+bool CommandLineParser::isPositiveParameter(const std::string& paramName) const {
+    return paramName == "num_threads" || paramName == "match_cpu_seconds" ||
+           paramName == "match_wall_seconds" || paramName == "match_memory_mb";
+}
+
 bool CommandLineParser::isParameterSupported(const std::string& paramName) const {
     std::vector<std::string> supported = getSupportedParameters(m_mode);
     return std::find(supported.begin(), supported.end(), paramName) != supported.end();
@@ -306,7 +366,8 @@ std::vector<std::string> CommandLineParser::getSupportedParameters(Mode mode) co
         case Mode::Comparative:
             return {"game_map", "game_managers_folder", "algorithm1", "algorithm2", "num_threads"};
         case Mode::Competition:
-            return {"game_maps_folder", "game_manager", "algorithms_folder", "num_threads"};
+            return {"game_maps_folder", "game_manager", "algorithms_folder", "num_threads", "match_history",
+                    "map_cache", "match_cpu_seconds", "match_wall_seconds", "match_memory_mb"};
         default:
             return {};
     }
@@ -45,6 +45,13 @@ public:
     std::string getGameMapsFolder() const;
     std::string getGameManager() const;
     std::string getAlgorithmsFolder() const;
+    std::string getMatchHistory() const;
+    std::string getMapCache() const;
+    bool isSandboxed() const;
+    bool isReusingGameManagers() const;
+    std::optional<int> getMatchCpuSeconds() const;
+    std::optional<int> getMatchWallSeconds() const;
+    std::optional<int> getMatchMemoryMb() const;
 
     std::string generateUsage(const std::string& programName) const;
     void reset();
@@ -52,6 +59,8 @@ public:
 private:
     Mode m_mode;
     bool m_verbose;
+    bool m_sandbox;
+    bool m_reuseGameManagers;
     std::map<std::string, std::string> m_parameters;
     std::vector<std::string> m_positionalArgs;
     std::vector<std::string> m_missingParams;
@@ -67,5 +76,7 @@ private:
     bool validateRequiredParameters();
     std::vector<std::string> getRequiredParameters(Mode mode) const;
     bool isParameterSupported(const std::string& paramName) const;
+    bool isPositiveParameter(const std::string& paramName) const;
+    std::optional<int> getPositiveParameter(const std::string& paramName) const;
     std::vector<std::string> getSupportedParameters(Mode mode) const;
 };
\ No newline at end of file
@@ -169,6 +169,99 @@ TEST_F(CommandLineParserTest, CompetitionMode_MissingRequired) {
     EXPECT_THAT(result.missingParams, UnorderedElementsAre("game_manager", "algorithms_folder"));
 }
 
+TEST_F(CommandLineParserTest, CompetitionMode_MatchHistory) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "match_history=test_temp/history.txt"});
+    
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(parser.getMatchHistory(), "test_temp/history.txt");
+}
+
+TEST_F(CommandLineParserTest, CompetitionMode_MapCache) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "map_cache=test_temp/cache"});
+    
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(parser.getMapCache(), "test_temp/cache");
+}
+
+TEST_F(CommandLineParserTest, CompetitionMode_SandboxWithLimits) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "-sandbox", "match_cpu_seconds=5", "match_wall_seconds=20",
+                           "match_memory_mb=256"});
+    
+    EXPECT_TRUE(result.success);
+    EXPECT_TRUE(parser.isSandboxed());
+    EXPECT_EQ(parser.getMatchCpuSeconds().value(), 5);
+    EXPECT_EQ(parser.getMatchWallSeconds().value(), 20);
+    EXPECT_EQ(parser.getMatchMemoryMb().value(), 256);
+}
+
+TEST_F(CommandLineParserTest, CompetitionMode_LimitsRequireSandbox) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "match_cpu_seconds=5", "match_wall_seconds=20"});
+    
+    EXPECT_FALSE(result.success);
+    EXPECT_THAT(result.unsupportedParams, UnorderedElementsAre("match_cpu_seconds=5 (requires -sandbox)",
+                                                               "match_wall_seconds=20 (requires -sandbox)"));
+}
+
+TEST_F(CommandLineParserTest, CompetitionMode_InvalidLimit) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "-sandbox", "match_memory_mb=0"});
+    
+    EXPECT_FALSE(result.success);
+    EXPECT_THAT(result.unsupportedParams, ElementsAre("match_memory_mb=0 (must be positive)"));
+}
+
+TEST_F(CommandLineParserTest, CompetitionMode_ReuseGameManagers) {
+    auto result = parseArgs({"-competition", "game_maps_folder=test_temp/maps", 
+                           "game_manager=test_temp/gamemanager.so",
+                           "algorithms_folder=test_temp/algorithms",
+                           "-reuse_game_managers"});
+    
+    EXPECT_TRUE(result.success);
+    EXPECT_TRUE(parser.isReusingGameManagers());
+}
+
+TEST_F(CommandLineParserTest, BasicMode_ReuseGameManagersUnsupported) {
+    auto result = parseArgs({"-basic", "game_map=test_temp/map.txt", "game_manager=test_temp/gamemanager.so",
+                           "algorithm1=test_temp/algo1.so", "algorithm2=test_temp/algo2.so", "-reuse_game_managers"});
+    
+    EXPECT_FALSE(result.success);
+    EXPECT_THAT(result.unsupportedParams, ElementsAre("-reuse_game_managers"));
+    EXPECT_FALSE(parser.isReusingGameManagers());
+}
+
+TEST_F(CommandLineParserTest, BasicMode_SandboxUnsupported) {
+    auto result = parseArgs({"-basic", "game_map=test_temp/map.txt", "game_manager=test_temp/gamemanager.so",
+                           "algorithm1=test_temp/algo1.so", "algorithm2=test_temp/algo2.so", "-sandbox"});
+    
+    EXPECT_FALSE(result.success);
+    EXPECT_THAT(result.unsupportedParams, ElementsAre("-sandbox"));
+    EXPECT_FALSE(parser.isSandboxed());
+}
+
+TEST_F(CommandLineParserTest, ComparativeMode_MatchHistoryUnsupported) {
+    auto result = parseArgs({"-comparative", "game_map=test_temp/map.txt", 
+                           "game_managers_folder=test_temp/game_managers",
+                           "algorithm1=test_temp/algo1.so", "algorithm2=test_temp/algo2.so",
+                           "match_history=test_temp/history.txt"});
+    
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(parser.getMatchHistory(), "");
+}
+
 // ===== KEY=VALUE PARSING TESTS =====
 
 TEST_F(CommandLineParserTest, KeyValueParsing_NoSpacesAroundEquals) {
@@ -314,6 +407,7 @@ TEST_F(CommandLineParserTest, CompetitionModeAccessors_WrongMode) {
     EXPECT_EQ(parser.getGameMapsFolder(), "");
     EXPECT_EQ(parser.getGameManager(), "");
     EXPECT_EQ(parser.getAlgorithmsFolder(), "");
+    EXPECT_EQ(parser.getMatchHistory(), "");
 }
 
 // ===== USAGE MESSAGE TEST =====
@@ -27,6 +27,13 @@ void ErrorCollector::addMapWarnings(const std::string& mapName, const std::vecto
     }
 }
 
+void ErrorCollector::addAll(const ErrorCollector& other) {
+    m_errors.insert(m_errors.end(), other.m_errors.begin(), other.m_errors.end());
+    m_errorCount += other.m_errorCount;
+    m_gameManagerErrorCount += other.m_gameManagerErrorCount;
+    m_algorithmErrorCount += other.m_algorithmErrorCount;
+}
+
 bool ErrorCollector::hasErrors() const {
     return !m_errors.empty();
 }
@@ -84,6 +84,16 @@ public:
      */
     void addAlgorithmError(const std::string& algorithmPath, const std::string& error);
 
+    /**
+     * @brief Append everything collected by another collector
+     * 
+     * Lets work running on other threads collect into a collector of its
+     * own, which is then appended here in a fixed order.
+     * 
+     * @param other The collector to append
+     */
+    void addAll(const ErrorCollector& other);
+
     /**
      * @brief Check if any errors or warnings have been collected
      * 
@@ -262,4 +262,22 @@ TEST_F(ErrorCollectorTest, ErrorCountWithMultipleWarnings) {
     EXPECT_TRUE(collector.hasMapWarnings());
     EXPECT_EQ(collector.getErrorCount(), 0);  // No fatal errors
     EXPECT_EQ(collector.getAllErrors().size(), 3);  // But 3 warnings
-}
\ No newline at end of file
+}
+TEST_F(ErrorCollectorTest, AddAllAppendsInOrder) {
+    ErrorCollector first;
+    ErrorCollector second;
+    first.addMapWarning("map1.txt", "Column too short");
+    second.addMapError("map2.txt", "Board dimensions cannot be zero");
+    second.addAlgorithmError("algo.so", "Library not found");
+
+    ErrorCollector merged;
+    merged.addAll(first);
+    merged.addAll(second);
+
+    ASSERT_EQ(merged.getAllErrors().size(), 3);
+    EXPECT_EQ(merged.getAllErrors()[0], first.getAllErrors()[0]);
+    EXPECT_EQ(merged.getAllErrors()[1], second.getAllErrors()[0]);
+    EXPECT_EQ(merged.getAllErrors()[2], second.getAllErrors()[1]);
+    EXPECT_EQ(merged.getErrorCount(), second.getErrorCount());
+    EXPECT_EQ(merged.getAlgorithmErrorCount(), 1);
+}
@@ -6,6 +6,7 @@
 #include "file_loader.h"
 #include "file_satellite_view.h"
 #include "error_collector.h"
+#include "mapped_file.h"
 
 std::vector<std::string> FileLoader::loadBoardFile(
     const std::string& filePath,
@@ -15,6 +16,25 @@ std::vector<std::string> FileLoader::loadBoardFile(
     size_t& numShells,
     std::string& mapName,
     ErrorCollector& errorCollector
+) {
+    std::vector<std::string_view> boardLines;
+    std::shared_ptr<const MappedFile> file = readBoardFile(filePath, rows, cols, maxSteps, numShells,
+                                                           mapName, errorCollector, boardLines);
+    if (!file) {
+        return {};
+    }
+    return std::vector<std::string>(boardLines.begin(), boardLines.end());
+}
+
+std::shared_ptr<const MappedFile> FileLoader::readBoardFile(
+    const std::string& filePath,
+    size_t& rows,
+    size_t& cols,
+    size_t& maxSteps,
+    size_t& numShells,
+    std::string& mapName,
+    ErrorCollector& errorCollector,
+    std::vector<std::string_view>& boardLines
 ) {
     // Extract filename for error reporting (before we have the map name)
     std::string fileName = filePath;
@@ -23,68 +43,78 @@ std::vector<std::string> FileLoader::loadBoardFile(
         fileName = filePath.substr(lastSlash + 1);
     }
     
-    std::ifstream inputFile(filePath);
-    if (!inputFile.is_open()) {
+    std::shared_ptr<const MappedFile> file = MappedFile::open(filePath);
+    if (!file) {
         errorCollector.addMapError(fileName, "Failed to load map: Could not open file '" + filePath + "'");
-        return {};
+        return nullptr;
     }
 
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(inputFile, line)) {
-        lines.push_back(line);
+    // Split into lines in place, like std::getline
+    std::vector<std::string_view> lines;
+    std::string_view text = file->contents();
+    while (!text.empty()) {
+        size_t end = text.find('\n');
+        if (end == std::string_view::npos) {
+            lines.push_back(text);
+            break;
+        }
+        lines.push_back(text.substr(0, end));
+        text.remove_prefix(end + 1);
     }
-    inputFile.close();
 
     if (lines.size() < 5) {
         errorCollector.addMapError(fileName, "Failed to load map: File must have at least 5 header lines");
-        return {};
+        return nullptr;
     }
 
     // 1. Extract map name from first line and clean it
-    mapName = lines[0];
+    mapName = std::string(lines[0]);
     // Replace spaces with underscores
     std::replace(mapName.begin(), mapName.end(), ' ', '_');
     // 2. MaxSteps = <NUM>
     if (!parseKeyValue(lines[1], "MaxSteps", maxSteps)) {
-        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing MaxSteps line: '" + lines[1] + "'");
-        return {};
+        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing MaxSteps line: '" + std::string(lines[1]) + "'");
+        return nullptr;
     }
     // 3. NumShells = <NUM>
     if (!parseKeyValue(lines[2], "NumShells", numShells)) {
-        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing NumShells line: '" + lines[2] + "'");
-        return {};
+        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing NumShells line: '" + std::string(lines[2]) + "'");
+        return nullptr;
     }
     // 4. Rows = <NUM>
     if (!parseKeyValue(lines[3], "Rows", rows) || rows == 0) {
-        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing Rows line: '" + lines[3] + "'");
-        return {};
+        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing Rows line: '" + std::string(lines[3]) + "'");
+        return nullptr;
     }
     // 5. Cols = <NUM>
     if (!parseKeyValue(lines[4], "Cols", cols) || cols == 0) {
-        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing Cols line: '" + lines[4] + "'");
-        return {};
+        errorCollector.addMapError(mapName, "Failed to load map: Invalid or missing Cols line: '" + std::string(lines[4]) + "'");
+        return nullptr;
     }
 
-    // Remove the first 5 lines (headers) and return the rest as the board
-    return std::vector<std::string>(lines.begin() + 5, lines.end());
+    // The lines after the 5 headers are the board
+    boardLines.assign(lines.begin() + 5, lines.end());
+    return file;
 }
 
-bool FileLoader::parseKeyValue(const std::string& line, const std::string& key, size_t& value) {
+bool FileLoader::parseKeyValue(std::string_view line, std::string_view key, size_t& value) {
     // Accepts lines like: Key = Value (spaces around '=' allowed)
-    std::string::size_type pos = line.find('=');
-    if (pos == std::string::npos) return false;
-    std::string left = line.substr(0, pos);
-    std::string right = line.substr(pos + 1);
+    std::string_view::size_type pos = line.find('=');
+    if (pos == std::string_view::npos) return false;
+    std::string_view left = line.substr(0, pos);
+    std::string_view right = line.substr(pos + 1);
     // Trim spaces
-    left.erase(left.find_last_not_of(" \t") + 1);
-    left.erase(0, left.find_first_not_of(" \t"));
-    right.erase(right.find_last_not_of(" \t") + 1);
-    right.erase(0, right.find_first_not_of(" \t"));
+    auto trim = [](std::string_view text) {
+        size_t first = text.find_first_not_of(" \t");
+        if (first == std::string_view::npos) return std::string_view();
+        return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    };
+    left = trim(left);
+    right = trim(right);
     if (left != key) return false;
     
     // Parse as long long first to check for negative values
-    std::istringstream iss(right);
+    std::istringstream iss{std::string(right)};
     long long temp;
     iss >> temp;
     if (iss.fail() || temp < 0) {
@@ -97,10 +127,14 @@ bool FileLoader::parseKeyValue(const std::string& line, const std::string& key,
 FileLoader::BoardInfo FileLoader::loadBoardWithSatelliteView(const std::string& filePath, ErrorCollector& errorCollector) {
     BoardInfo info{};
     
-    std::vector<std::string> boardData = loadBoardFile(filePath, info.rows, info.cols, info.maxSteps, info.numShells, info.mapName, errorCollector);
+    // The view keeps the mapped file and reads its rows in place
+    std::vector<std::string_view> boardLines;
+    std::shared_ptr<const MappedFile> file = readBoardFile(filePath, info.rows, info.cols, info.maxSteps,
+                                                           info.numShells, info.mapName, errorCollector, boardLines);
     
-    if (!boardData.empty()) {
-        info.satelliteView = std::make_unique<FileSatelliteView>(boardData, info.rows, info.cols);
+    if (file && !boardLines.empty()) {
+        info.satelliteView = std::make_unique<FileSatelliteView>(std::move(file), std::move(boardLines),
+                                                                 info.rows, info.cols);
     }
     
     return info;
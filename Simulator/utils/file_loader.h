@@ -2,12 +2,14 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "common/SatelliteView.h"
 #include "error_collector.h"
 
 class FileSatelliteView;
+class MappedFile;
 
 /**
  * @brief Utility class for loading and parsing game board files
@@ -75,6 +77,19 @@ public:
     );
 
 private:
+    // Reads the header values and returns the mapped file with views of the board rows,
+    // or nullptr if loading failed
+    static std::shared_ptr<const MappedFile> readBoardFile(
+        const std::string& filePath,
+        size_t& rows,
+        size_t& cols,
+        size_t& maxSteps,
+        size_t& numShells,
+        std::string& mapName,
+        ErrorCollector& errorCollector,
+        std::vector<std::string_view>& boardLines
+    );
+
     // Parse a line of the form "Key = Value" (spaces around '=' allowed)
-    static bool parseKeyValue(const std::string& line, const std::string& key, size_t& value);
+    static bool parseKeyValue(std::string_view line, std::string_view key, size_t& value);
 };
\ No newline at end of file
@@ -1,8 +1,11 @@
 #include "gtest/gtest.h"
 #include "file_loader.h"
 #include "error_collector.h"
+#include "file_satellite_view.h"
+#include <chrono>
 #include <fstream>
 #include <cstdio>
+#include <string>
 
 class FileLoaderTest : public ::testing::Test {
 protected:
@@ -535,4 +538,79 @@ TEST_F(FileLoaderTest, BoardInfoValidation_NullSatelliteView) {
     EXPECT_FALSE(boardInfo.isValid());
     EXPECT_EQ(boardInfo.getErrorReason(), "Failed to load board file");
     EXPECT_TRUE(boardInfo.getWarnings().empty());
-}
\ No newline at end of file
+}
+TEST_F(FileLoaderTest, LoadBoardWithSatelliteView_LastLineWithoutNewline) {
+    std::ofstream outFile(tempFileName, std::ios::binary);
+    outFile << "Map\nMaxSteps = 10\nNumShells = 2\nRows = 2\nCols = 3\n#1#\n2 #";
+    outFile.close();
+
+    ErrorCollector errorCollector;
+    FileLoader::BoardInfo boardInfo = FileLoader::loadBoardWithSatelliteView(tempFileName, errorCollector);
+
+    ASSERT_TRUE(boardInfo.isValid());
+    EXPECT_TRUE(boardInfo.getWarnings().empty());
+    EXPECT_EQ(boardInfo.satelliteView->getObjectAt(0, 1), '2');
+    EXPECT_EQ(boardInfo.satelliteView->getObjectAt(2, 1), '#');
+}
+
+TEST_F(FileLoaderTest, LoadBoardWithSatelliteView_RecoversRowsOnRead) {
+    createTestFile({"Map", "MaxSteps = 10", "NumShells = 2", "Rows = 3", "Cols = 3",
+                    "#1#\r", "X2", "###"});
+
+    ErrorCollector errorCollector;
+    FileLoader::BoardInfo boardInfo = FileLoader::loadBoardWithSatelliteView(tempFileName, errorCollector);
+    ASSERT_TRUE(boardInfo.isValid());
+    EXPECT_EQ(boardInfo.getWarnings().size(), 3u);
+
+    const auto& view = static_cast<const FileSatelliteView&>(*boardInfo.satelliteView);
+    // A trailing carriage return is beyond the width, the row is still read whole
+    ASSERT_NE(view.getRow(0), nullptr);
+    EXPECT_EQ(std::string(view.getRow(0), 3), "#1#");
+    // A recovered row is read per cell, padded and cleaned
+    EXPECT_EQ(view.getRow(1), nullptr);
+    EXPECT_EQ(view.getObjectAt(0, 1), ' ');
+    EXPECT_EQ(view.getObjectAt(1, 1), '2');
+    EXPECT_EQ(view.getObjectAt(2, 1), ' ');
+}
+
+TEST_F(FileLoaderTest, DISABLED_Benchmark_MappedComparedToCopiedLoad) {
+    const size_t size = 1000;
+    const int loads = 5;
+    std::vector<std::string> lines = {"Big", "MaxSteps = 1000", "NumShells = 10",
+                                      "Rows = " + std::to_string(size), "Cols = " + std::to_string(size)};
+    for (size_t y = 0; y < size; ++y) {
+        std::string row(size, ' ');
+        row[(y * 7) % size] = '#';
+        lines.push_back(row);
+    }
+    lines[5][1] = '1';
+    lines.back()[size - 2] = '2';
+    createTestFile(lines);
+
+    // Line by line into strings, then into the view, as the loader used to read maps
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loads; ++i) {
+        std::ifstream inputFile(tempFileName);
+        std::vector<std::string> fileLines;
+        std::string line;
+        while (std::getline(inputFile, line)) {
+            fileLines.push_back(line);
+        }
+        std::vector<std::string> board(fileLines.begin() + 5, fileLines.end());
+        FileSatelliteView view(board, size, size);
+        ASSERT_TRUE(view.isValid());
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loads; ++i) {
+        ErrorCollector errorCollector;
+        FileLoader::BoardInfo boardInfo = FileLoader::loadBoardWithSatelliteView(tempFileName, errorCollector);
+        ASSERT_TRUE(boardInfo.isValid());
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double copiedTime = std::chrono::duration<double>(middle - start).count();
+    double mappedTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("copied_ms", std::to_string(copiedTime * 1000));
+    RecordProperty("mapped_ms", std::to_string(mappedTime * 1000));
+
+}
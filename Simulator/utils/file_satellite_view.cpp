@@ -1,8 +1,72 @@
 #include "file_satellite_view.h"
 
+#include <algorithm>
+#include <array>
+
+namespace {
+
+// Characters a board may contain, indexed by unsigned char
+constexpr std::array<bool, 256> BOARD_OBJECTS = [] {
+    std::array<bool, 256> objects{};
+    objects['#'] = true;  // Wall
+    objects['@'] = true;  // Mine
+    objects[' '] = true;  // Empty
+    objects['*'] = true;  // Shell
+    for (char tank = '1'; tank <= '9'; ++tank) {
+        objects[static_cast<unsigned char>(tank)] = true;  // Tank players 1-9
+    }
+    return objects;
+}();
+
+bool isBoardObject(char ch) {
+    return BOARD_OBJECTS[static_cast<unsigned char>(ch)];
+}
+
+} // namespace
+
 FileSatelliteView::FileSatelliteView(const std::vector<std::string>& boardData, size_t rows, size_t cols)
     : m_rows(rows), m_cols(cols), m_isValid(true) {
-    initializeAndRecoverBoard(boardData);
+    adoptRows(boardData);
+    initializeAndRecoverBoard();
+}
+
+FileSatelliteView::FileSatelliteView(std::shared_ptr<const void> storage, std::vector<std::string_view> boardData,
+                                     size_t rows, size_t cols)
+    : m_storage(std::move(storage)), m_boardRows(std::move(boardData)), m_rows(rows), m_cols(cols), m_isValid(true) {
+    initializeAndRecoverBoard();
+}
+
+FileSatelliteView::FileSatelliteView(size_t rows, size_t cols)
+    : m_rows(rows), m_cols(cols), m_isValid(true) {}
+
+std::unique_ptr<FileSatelliteView> FileSatelliteView::fromValidatedRows(
+    std::vector<std::string> processedRows, size_t cols, std::vector<std::string> warnings) {
+    std::unique_ptr<FileSatelliteView> view(new FileSatelliteView(processedRows.size(), cols));
+    view->adoptRows(processedRows);
+    view->m_completeRows.assign(processedRows.size(), true);
+    view->m_warnings = std::move(warnings);
+    return view;
+}
+
+void FileSatelliteView::adoptRows(const std::vector<std::string>& rows) {
+    size_t total = 0;
+    for (const auto& row : rows) {
+        total += row.size();
+    }
+    auto buffer = std::make_shared<std::string>();
+    buffer->reserve(total);
+    for (const auto& row : rows) {
+        buffer->append(row);
+    }
+
+    m_boardRows.clear();
+    m_boardRows.reserve(rows.size());
+    size_t offset = 0;
+    for (const auto& row : rows) {
+        m_boardRows.emplace_back(buffer->data() + offset, row.size());
+        offset += row.size();
+    }
+    m_storage = std::move(buffer);
 }
 
 char FileSatelliteView::getObjectAt(size_t x, size_t y) const {
@@ -11,15 +75,39 @@ char FileSatelliteView::getObjectAt(size_t x, size_t y) const {
     }
     
     // Within board dimensions but no data available
-    if (y >= m_processedBoard.size()) {
+    if (y >= m_boardRows.size()) {
         return ' ';
     }
-    const std::string& row = m_processedBoard[y];
+    std::string_view row = m_boardRows[y];
     if (x >= row.length()) {
-        return ' ';
+        return ' ';  // Short row, padded with empty space
+    }
+
+    char ch = row[x];
+    return isBoardObject(ch) ? ch : ' ';
+}
+
+size_t FileSatelliteView::getWidth() const {
+    return m_cols;
+}
+
+size_t FileSatelliteView::getHeight() const {
+    return m_rows;
+}
+
+const char* FileSatelliteView::getRow(size_t y) const {
+    // An invalid board keeps no rows, recovered rows are read per cell
+    if (y >= m_completeRows.size() || !m_completeRows[y]) {
+        return nullptr;
     }
+    return m_boardRows[y].data();
+}
 
-    return row[x];
+std::shared_ptr<const UserCommon_318835816_211314471::CompiledMap> FileSatelliteView::getCompiledMap() const {
+    std::call_once(m_compileOnce, [this]() {
+        m_compiledMap = UserCommon_318835816_211314471::CompiledMap::compile(*this, m_cols, m_rows);
+    });
+    return m_compiledMap;
 }
 
 // Validation interface implementation
@@ -39,13 +127,16 @@ const std::vector<std::string>& FileSatelliteView::getWarnings() const {
 void FileSatelliteView::setError(const std::string& errorMessage) {
     m_isValid = false;
     m_errorReason = errorMessage;
+    m_boardRows.clear();
+    m_completeRows.clear();
+    m_storage.reset();
 }
 
 void FileSatelliteView::addWarning(const std::string& warningMessage) {
     m_warnings.push_back(warningMessage);
 }
 
-void FileSatelliteView::initializeAndRecoverBoard(const std::vector<std::string>& rawBoardData) {
+void FileSatelliteView::initializeAndRecoverBoard() {
     // Critical error checks - early exit
     if (m_rows == 0 || m_cols == 0) {
         setError("Board dimensions cannot be zero");
@@ -54,14 +145,16 @@ void FileSatelliteView::initializeAndRecoverBoard(const std::vector<std::string>
 
     // Check for tanks in board data
     bool hasTanks = false;
-    for (const auto& row : rawBoardData) {
-        for (char ch : row) {
-            if (ch >= '1' && ch <= '9') {
-                hasTanks = true;
-                break;
-            }
+    for (std::string_view row : m_boardRows) {
+        const char* ch = row.data();
+        const char* end = ch + row.size();
+        while (ch != end && (*ch < '1' || *ch > '9')) {
+            ++ch;
+        }
+        if (ch != end) {
+            hasTanks = true;
+            break;
         }
-        if (hasTanks) break;
     }
 
     if (!hasTanks) {
@@ -69,69 +162,50 @@ void FileSatelliteView::initializeAndRecoverBoard(const std::vector<std::string>
         return;
     }
 
-    // Initialize processed board
-    m_processedBoard.clear();
-    m_processedBoard.reserve(m_rows);
-
-    // Process and recover board data
-    for (size_t y = 0; y < m_rows; ++y) {
-        std::string processedRow;
-        
-        if (y < rawBoardData.size()) {
-            const std::string& rawRow = rawBoardData[y];
-            
-            // Process existing row
-            for (size_t x = 0; x < m_cols; ++x) {
-                char ch = ' ';
-                
-                if (x < rawRow.length()) {
-                    char rawChar = rawRow[x];
-                    
-                    // Validate and clean character
-                    if (rawChar == '#' ||    // Wall
-                        rawChar == '@' ||    // Mine
-                        rawChar == ' ' ||    // Empty
-                        rawChar == '*' ||    // Shell
-                        (rawChar >= '1' && rawChar <= '9')) {  // Tank players 1-9
-                        ch = rawChar;
-                    } else {
-                        // Invalid character - replace with empty and warn
-                        ch = ' ';
-                        addWarning("Invalid character '" + std::string(1, rawChar) + 
-                                 "' at position (" + std::to_string(x) + "," + std::to_string(y) + 
-                                 ") replaced with empty space");
-                    }
-                } else {
-                    // Row too short - pad with empty space and warn
-                    if (x == rawRow.length() && !rawRow.empty()) {
-                        addWarning("Row " + std::to_string(y) + " is shorter than expected width " + 
-                                 std::to_string(m_cols) + ", padded with empty spaces");
-                    }
-                }
-                
-                processedRow += ch;
-            }
-            
-            // Check for extra characters in row
-            if (rawRow.length() > m_cols) {
-                addWarning("Row " + std::to_string(y) + " is longer than expected width " + 
-                         std::to_string(m_cols) + ", extra characters ignored");
-            }
-        } else {
-            // Missing row - create empty row and warn
-            processedRow = std::string(m_cols, ' ');
-            if (y == rawBoardData.size()) {
-                addWarning("Board has fewer rows than expected (" + std::to_string(rawBoardData.size()) + 
-                         " vs " + std::to_string(m_rows) + "), missing rows filled with empty spaces");
+    // Check rows, the recovery itself happens in getObjectAt
+    size_t rawRowCount = m_boardRows.size();
+    m_completeRows.assign(m_rows, false);
+    for (size_t y = 0; y < m_rows && y < rawRowCount; ++y) {
+        std::string_view rawRow = m_boardRows[y];
+        bool complete = rawRow.length() >= m_cols;
+
+        const char* rawChars = rawRow.data();
+        size_t checkedLength = std::min(rawRow.length(), m_cols);
+        for (size_t x = 0; x < checkedLength; ++x) {
+            char rawChar = rawChars[x];
+            if (!BOARD_OBJECTS[static_cast<unsigned char>(rawChar)]) {
+                // Invalid character - read as empty and warn
+                complete = false;
+                addWarning("Invalid character '" + std::string(1, rawChar) + 
+                         "' at position (" + std::to_string(x) + "," + std::to_string(y) + 
+                         ") replaced with empty space");
             }
         }
-        
-        m_processedBoard.push_back(processedRow);
+
+        // Row too short - read as padded with empty space and warn
+        if (!rawRow.empty() && rawRow.length() < m_cols) {
+            addWarning("Row " + std::to_string(y) + " is shorter than expected width " + 
+                     std::to_string(m_cols) + ", padded with empty spaces");
+        }
+
+        // Check for extra characters in row
+        if (rawRow.length() > m_cols) {
+            addWarning("Row " + std::to_string(y) + " is longer than expected width " + 
+                     std::to_string(m_cols) + ", extra characters ignored");
+        }
+        m_completeRows[y] = complete;
+    }
+
+    // Missing rows - read as empty rows and warn
+    if (rawRowCount < m_rows) {
+        addWarning("Board has fewer rows than expected (" + std::to_string(rawRowCount) + 
+                 " vs " + std::to_string(m_rows) + "), missing rows filled with empty spaces");
     }
 
     // Check for extra rows
-    if (rawBoardData.size() > m_rows) {
-        addWarning("Board has more rows than expected (" + std::to_string(rawBoardData.size()) + 
+    if (rawRowCount > m_rows) {
+        addWarning("Board has more rows than expected (" + std::to_string(rawRowCount) + 
                  " vs " + std::to_string(m_rows) + "), extra rows ignored");
+        m_boardRows.resize(m_rows);
     }
-}
\ No newline at end of file
+}
@@ -1,25 +1,73 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "common/SatelliteView.h"
+#include "UserCommon/compiled_map.h"
 
 /**
  * @brief Simple SatelliteView implementation for raw board data from files
+ *
+ * Rows are kept as views into the loaded file, or into one buffer for boards
+ * built from strings, and are never copied. Recovery is applied on read:
+ * getObjectAt pads short rows and replaces invalid characters with empty
+ * space. Rows that need no recovery can be read whole through
+ * RowAccessSatelliteView; getRow returns nullptr for the others.
+ *
+ * One view serves every match on its map, so the map is compiled once, on
+ * first request, and the compiled map is shared by those matches.
  */
-class FileSatelliteView : public SatelliteView {
+class FileSatelliteView : public UserCommon_318835816_211314471::CompiledMapSatelliteView {
 public:
     FileSatelliteView(const std::vector<std::string>& boardData, size_t rows, size_t cols);
+
+    /**
+     * @brief Creates a view over rows held by another object
+     *
+     * @param storage Keeps the memory of the rows alive, e.g. a MappedFile
+     * @param boardData Raw rows of the board, as read from the file
+     * @param rows Number of rows of the board
+     * @param cols Number of columns of the board
+     */
+    FileSatelliteView(std::shared_ptr<const void> storage, std::vector<std::string_view> boardData,
+                      size_t rows, size_t cols);
+
+    /**
+     * @brief Creates a valid view from rows that were already validated
+     *
+     * Used for boards read back from the map cache. The rows must be the
+     * processed rows of a valid view and the warnings those it reported.
+     */
+    static std::unique_ptr<FileSatelliteView> fromValidatedRows(
+        std::vector<std::string> processedRows, size_t cols, std::vector<std::string> warnings);
+
     char getObjectAt(size_t x, size_t y) const override;
 
+    size_t getWidth() const override;
+    size_t getHeight() const override;
+    const char* getRow(size_t y) const override;
+    std::shared_ptr<const UserCommon_318835816_211314471::CompiledMap> getCompiledMap() const override;
+
     // Validation interface
     bool isValid() const;
     const std::string& getErrorReason() const;
     const std::vector<std::string>& getWarnings() const;
 
 private:
-    std::vector<std::string> m_processedBoard;
+    FileSatelliteView(size_t rows, size_t cols);
+
+    // Joins rows into one owned buffer and views them
+    void adoptRows(const std::vector<std::string>& rows);
+
+    std::shared_ptr<const void> m_storage;
+    std::vector<std::string_view> m_boardRows;
+    std::vector<bool> m_completeRows;  // Full width with only valid characters
+    mutable std::once_flag m_compileOnce;
+    mutable std::shared_ptr<const UserCommon_318835816_211314471::CompiledMap> m_compiledMap;
     size_t m_rows;
     size_t m_cols;
 
@@ -31,5 +79,5 @@ private:
     // Helper methods for validation state management
     void setError(const std::string& errorMessage);
     void addWarning(const std::string& warningMessage);
-    void initializeAndRecoverBoard(const std::vector<std::string>& rawBoardData);
-};
\ No newline at end of file
+    void initializeAndRecoverBoard();
+};
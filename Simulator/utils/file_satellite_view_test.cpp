@@ -343,4 +343,37 @@ TEST_F(FileSatelliteViewTest, ValidationMultipleInvalidCharacters) {
     EXPECT_EQ(satelliteView.getObjectAt(0, 2), '3');
     EXPECT_EQ(satelliteView.getObjectAt(1, 2), '#');
     EXPECT_EQ(satelliteView.getObjectAt(2, 2), ' ');  // D -> ' '
-}
\ No newline at end of file
+}
+TEST_F(FileSatelliteViewTest, RowAccess) {
+    std::vector<std::string> variableBoard = {
+        "#1#",
+        "#",
+        "###"
+    };
+    FileSatelliteView satelliteView(variableBoard, 3, 3);
+
+    EXPECT_EQ(satelliteView.getWidth(), 3u);
+    EXPECT_EQ(satelliteView.getHeight(), 3u);
+    ASSERT_NE(satelliteView.getRow(0), nullptr);
+    EXPECT_EQ(std::string(satelliteView.getRow(0), 3), "#1#");
+    EXPECT_EQ(satelliteView.getRow(3), nullptr);
+
+    // Rows stored short are still read correctly through copyRow
+    std::string row(3, '?');
+    UserCommon_318835816_211314471::RowAccessSatelliteView::copyRow(satelliteView, 1, row.size(), row.data());
+    EXPECT_EQ(row, "#  ");
+}
+
+TEST_F(FileSatelliteViewTest, CompiledMapIsSharedAndRecovered) {
+    std::vector<std::string> recoveredBoard = {"#1X", "2"};
+    FileSatelliteView satelliteView(recoveredBoard, 2, 3);
+
+    auto map = satelliteView.getCompiledMap();
+    ASSERT_NE(map, nullptr);
+    EXPECT_EQ(map, satelliteView.getCompiledMap());
+    EXPECT_EQ(map->getWidth(), 3u);
+    EXPECT_EQ(map->getHeight(), 2u);
+    EXPECT_EQ(map->getTankPositions().size(), 2u);
+    EXPECT_EQ(map->getBoard().getCellType(0, 0), UserCommon_318835816_211314471::GameBoard::CellType::Wall);
+    EXPECT_EQ(map->getBoard().getCellType(2, 0), UserCommon_318835816_211314471::GameBoard::CellType::Empty);
+}
@@ -0,0 +1,40 @@
+#include "game_manager_pool.h"
+
+#include "UserCommon/reusable_game_manager.h"
+
+std::unique_ptr<AbstractGameManager> GameManagerPool::acquire(const std::string& name, bool verbose) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_idle.rbegin(); it != m_idle.rend(); ++it) {
+        if (it->name == name && it->verbose == verbose) {
+            std::unique_ptr<AbstractGameManager> manager = std::move(it->manager);
+            m_idle.erase(std::next(it).base());
+            return manager;
+        }
+    }
+    return nullptr;
+}
+
+void GameManagerPool::release(const std::string& name, bool verbose, std::unique_ptr<AbstractGameManager> manager) {
+    auto* reusable = dynamic_cast<UserCommon_318835816_211314471::ReusableGameManager*>(manager.get());
+    if (!reusable) {
+        return;  // Destroyed here, as without a pool
+    }
+
+    // Reset outside the lock, it releases the players and algorithms of the match
+    reusable->reset();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_idle.push_back(IdleManager{name, verbose, std::move(manager)});
+}
+
+size_t GameManagerPool::idleCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle.size();
+}
+
+void GameManagerPool::clear() {
+    std::vector<IdleManager> idle;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        idle.swap(m_idle);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/AbstractGameManager.h"
+
+/**
+ * @brief Keeps game managers between matches so they are not rebuilt
+ *
+ * After a match the manager is handed back to the pool. Managers that
+ * implement ReusableGameManager are reset and kept for the next match on
+ * any worker. Others are destroyed as if there were no pool, so managers
+ * from other implementations behave as before.
+ *
+ * At most one manager per worker is idle at a time. The pool must be
+ * cleared before the libraries that made its managers are unloaded.
+ */
+class GameManagerPool {
+public:
+    /**
+     * @brief Take an idle manager made by a factory
+     *
+     * @param name Name of the game manager registration
+     * @param verbose The verbose flag the manager must have been made with
+     * @return An idle manager ready to run, or nullptr if there is none
+     */
+    std::unique_ptr<AbstractGameManager> acquire(const std::string& name, bool verbose);
+
+    /**
+     * @brief Hand back a manager after its match
+     *
+     * @param name Name of the game manager registration that made it
+     * @param verbose The verbose flag it was made with
+     * @param manager The manager, reset and kept if it is reusable
+     */
+    void release(const std::string& name, bool verbose, std::unique_ptr<AbstractGameManager> manager);
+
+    // Number of managers waiting for a match
+    size_t idleCount() const;
+
+    // Destroy all idle managers
+    void clear();
+
+private:
+    struct IdleManager {
+        std::string name;
+        bool verbose;
+        std::unique_ptr<AbstractGameManager> manager;
+    };
+
+    mutable std::mutex m_mutex;
+    std::vector<IdleManager> m_idle;
+};
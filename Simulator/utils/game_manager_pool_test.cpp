@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+#include "game_manager_pool.h"
+#include "test/mocks/MockGameManager.h"
+#include "UserCommon/reusable_game_manager.h"
+
+namespace {
+
+class ResettableGameManager : public UserCommon_318835816_211314471::ReusableGameManager {
+public:
+    GameResult run(size_t, size_t, const SatelliteView&, string, size_t, size_t,
+                   Player&, string, Player&, string,
+                   TankAlgorithmFactory, TankAlgorithmFactory) override {
+        return GameResult{};
+    }
+
+    void reset() override { resets++; }
+
+    int resets = 0;
+};
+
+} // namespace
+
+TEST(GameManagerPoolTest, ReusableManagerIsResetAndReused) {
+    GameManagerPool pool;
+    EXPECT_EQ(pool.acquire("gm", false), nullptr);
+
+    auto manager = std::make_unique<ResettableGameManager>();
+    ResettableGameManager* raw = manager.get();
+    pool.release("gm", false, std::move(manager));
+    EXPECT_EQ(raw->resets, 1);
+    EXPECT_EQ(pool.idleCount(), 1u);
+
+    // Only a manager made by the same factory with the same flag is handed out
+    EXPECT_EQ(pool.acquire("other", false), nullptr);
+    EXPECT_EQ(pool.acquire("gm", true), nullptr);
+    auto reused = pool.acquire("gm", false);
+    EXPECT_EQ(reused.get(), raw);
+    EXPECT_EQ(pool.idleCount(), 0u);
+}
+
+TEST(GameManagerPoolTest, OtherManagersAreNotKept) {
+    GameManagerPool pool;
+    pool.release("mock", false, std::make_unique<MockGameManager>(false));
+    EXPECT_EQ(pool.idleCount(), 0u);
+    EXPECT_EQ(pool.acquire("mock", false), nullptr);
+}
+
+TEST(GameManagerPoolTest, ClearDestroysIdleManagers) {
+    GameManagerPool pool;
+    pool.release("gm", false, std::make_unique<ResettableGameManager>());
+    pool.release("gm", false, std::make_unique<ResettableGameManager>());
+    EXPECT_EQ(pool.idleCount(), 2u);
+    pool.clear();
+    EXPECT_EQ(pool.idleCount(), 0u);
+}
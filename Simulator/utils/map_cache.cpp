@@ -0,0 +1,177 @@
+#include "map_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "file_satellite_view.h"
+#include "UserCommon/row_access_satellite_view.h"
+
+namespace {
+
+const char* const CACHE_HEADER = "TANKMAP 1";
+
+} // namespace
+
+MapCache::MapCache(std::string directory) : m_directory(std::move(directory)) {}
+
+bool MapCache::stampFile(const std::string& mapPath, FileStamp& stamp) {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(mapPath, error);
+    if (error) {
+        return false;
+    }
+    auto size = std::filesystem::file_size(absolute, error);
+    if (error) {
+        return false;
+    }
+    auto modified = std::filesystem::last_write_time(absolute, error);
+    if (error) {
+        return false;
+    }
+    stamp.path = absolute.lexically_normal().string();
+    stamp.size = static_cast<unsigned long long>(size);
+    stamp.modified = static_cast<long long>(modified.time_since_epoch().count());
+    return true;
+}
+
+std::string MapCache::entryPath(const std::string& absolutePath) const {
+    std::ostringstream name;
+    name << std::hex << std::hash<std::string>{}(absolutePath) << ".map";
+    return (std::filesystem::path(m_directory) / name.str()).string();
+}
+
+bool MapCache::load(const std::string& mapPath, FileLoader::BoardInfo& board) const {
+    FileStamp stamp;
+    if (!stampFile(mapPath, stamp)) {
+        return false;
+    }
+    std::string entry = entryPath(stamp.path);
+    std::error_code error;
+    auto entrySize = std::filesystem::file_size(entry, error);
+    if (error) {
+        return false;
+    }
+    std::ifstream file(entry);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Format: header, path, size and time, dimensions, map name, warnings, rows
+    std::string line;
+    if (!std::getline(file, line) || line != CACHE_HEADER) {
+        return false;
+    }
+    if (!std::getline(file, line) || line != stamp.path) {
+        return false;  // Another path with the same hash
+    }
+    FileStamp cached;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t maxSteps = 0;
+    size_t numShells = 0;
+    size_t warningCount = 0;
+    if (!std::getline(file, line) || !(std::istringstream(line) >> cached.size >> cached.modified) ||
+        cached.size != stamp.size || cached.modified != stamp.modified) {
+        return false;
+    }
+    if (!std::getline(file, line) || !(std::istringstream(line) >> rows >> cols >> maxSteps >> numShells) ||
+        rows == 0 || cols == 0) {
+        return false;
+    }
+    std::string mapName;
+    if (!std::getline(file, mapName) || !std::getline(file, line) ||
+        !(std::istringstream(line) >> warningCount)) {
+        return false;
+    }
+
+    // Every warning and row takes at least its line break, so a damaged count
+    // larger than what is left of the entry is a miss, not an allocation
+    std::streamoff offset = file.tellg();
+    if (offset < 0 || static_cast<unsigned long long>(offset) > entrySize) {
+        return false;
+    }
+    unsigned long long remaining = entrySize - static_cast<unsigned long long>(offset);
+    if (warningCount > remaining || rows > remaining || cols >= remaining / rows) {
+        return false;
+    }
+
+    std::vector<std::string> warnings(warningCount);
+    for (auto& warning : warnings) {
+        if (!std::getline(file, warning)) {
+            return false;
+        }
+    }
+    std::vector<std::string> boardRows(rows);
+    for (auto& row : boardRows) {
+        if (!std::getline(file, row) || row.size() != cols) {
+            return false;
+        }
+    }
+
+    board.rows = rows;
+    board.cols = cols;
+    board.maxSteps = maxSteps;
+    board.numShells = numShells;
+    board.mapName = std::move(mapName);
+    board.satelliteView = FileSatelliteView::fromValidatedRows(std::move(boardRows), cols, std::move(warnings));
+    return true;
+}
+
+bool MapCache::store(const FileStamp& stamp, const FileLoader::BoardInfo& board) const {
+    if (!board.isValid()) {
+        return false;
+    }
+    FileStamp current;
+    if (!stampFile(stamp.path, current) || current.size != stamp.size || current.modified != stamp.modified) {
+        return false;  // Changed while it was parsed
+    }
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        return false;
+    }
+
+    std::string target = entryPath(stamp.path);
+    std::ostringstream suffix;
+    // Unique per writer, several runs or threads may store the same map
+    suffix << ".tmp" << ::getpid() << '.' << std::hash<std::thread::id>{}(std::this_thread::get_id());
+    std::string temporary = target + suffix.str();
+    {
+        std::ofstream file(temporary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << CACHE_HEADER << '\n' << stamp.path << '\n'
+             << stamp.size << ' ' << stamp.modified << '\n'
+             << board.rows << ' ' << board.cols << ' ' << board.maxSteps << ' ' << board.numShells << '\n'
+             << board.mapName << '\n';
+        std::vector<std::string> warnings = board.getWarnings();
+        file << warnings.size() << '\n';
+        for (const auto& warning : warnings) {
+            file << warning << '\n';
+        }
+        std::string row(board.cols, ' ');
+        for (size_t y = 0; y < board.rows; ++y) {
+            UserCommon_318835816_211314471::RowAccessSatelliteView::copyRow(
+                *board.satelliteView, y, board.cols, row.data());
+            file << row << '\n';
+        }
+        if (!file.good()) {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary, target, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+
+#include "file_loader.h"
+
+/**
+ * @brief On-disk cache of validated map boards
+ *
+ * Each valid map is stored in the cache folder as its processed rows, its
+ * header values and the warnings it raised, in one file per map path. An
+ * entry is only used while the map file keeps the size and modification
+ * time it had when stored, so an edited map is parsed again and the new
+ * entry replaces the old one.
+ *
+ * Entries are written to a temporary file and renamed into place, so runs
+ * sharing a cache folder never read a partial entry.
+ */
+class MapCache {
+public:
+    // Identity of a map file, an entry is stale when it changes
+    struct FileStamp {
+        std::string path;
+        unsigned long long size = 0;
+        long long modified = 0;
+    };
+
+    /**
+     * @brief Take the stamp of a map file
+     *
+     * Take it before parsing the file and pass it to store, so a file edited
+     * while it was parsed is not stored under its new stamp.
+     *
+     * @param mapPath Path of the map file
+     * @param stamp Filled with the absolute path, size and modification time
+     * @return true if the file exists and could be stamped
+     */
+    static bool stampFile(const std::string& mapPath, FileStamp& stamp);
+
+    /**
+     * @brief Create a cache stored in a folder
+     * @param directory Cache folder, created on the first store
+     */
+    explicit MapCache(std::string directory);
+
+    /**
+     * @brief Load the cached board of a map file
+     *
+     * @param mapPath Path of the map file
+     * @param board Filled with the cached board, with its warnings, on success
+     * @return true if an up to date entry was found
+     */
+    bool load(const std::string& mapPath, FileLoader::BoardInfo& board) const;
+
+    /**
+     * @brief Store the board of a map file
+     *
+     * Nothing is stored if the file no longer has the stamp it had before it
+     * was parsed, the board may then not match the file.
+     *
+     * @param stamp Stamp of the map file taken before the board was loaded
+     * @param board A valid board loaded by FileLoader
+     * @return true if the entry was written
+     */
+    bool store(const FileStamp& stamp, const FileLoader::BoardInfo& board) const;
+
+private:
+    std::string entryPath(const std::string& absolutePath) const;
+
+    std::string m_directory;
+};
@@ -0,0 +1,185 @@
+#include "gtest/gtest.h"
+#include "map_cache.h"
+#include "error_collector.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class MapCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(cacheFolder);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(cacheFolder);
+        std::filesystem::remove(mapFile);
+    }
+
+    void writeMap(const std::vector<std::string>& boardLines, size_t rows, size_t cols) {
+        std::ofstream file(mapFile);
+        file << "Cache Test Map\nMaxSteps = 500\nNumShells = 16\n";
+        file << "Rows = " << rows << "\nCols = " << cols << "\n";
+        for (const auto& line : boardLines) {
+            file << line << "\n";
+        }
+    }
+
+    MapCache::FileStamp stampMap() const {
+        MapCache::FileStamp stamp;
+        EXPECT_TRUE(MapCache::stampFile(mapFile, stamp));
+        return stamp;
+    }
+
+    static std::vector<std::string> readRows(const FileLoader::BoardInfo& board) {
+        std::vector<std::string> rows;
+        for (size_t y = 0; y < board.rows; ++y) {
+            std::string row;
+            for (size_t x = 0; x < board.cols; ++x) {
+                row += board.satelliteView->getObjectAt(x, y);
+            }
+            rows.push_back(row);
+        }
+        return rows;
+    }
+
+    std::string cacheFolder = "test_map_cache";
+    std::string mapFile = "test_map_cache_board.txt";
+};
+
+TEST_F(MapCacheTest, StoredBoardLoadsBackWithWarnings) {
+    writeMap({"1 #", "X 2"}, 3, 3);
+    MapCache::FileStamp stamp = stampMap();
+    ErrorCollector errors;
+    auto parsed = FileLoader::loadBoardWithSatelliteView(mapFile, errors);
+    ASSERT_TRUE(parsed.isValid());
+    ASSERT_FALSE(parsed.getWarnings().empty());
+
+    MapCache cache(cacheFolder);
+    FileLoader::BoardInfo cached{};
+    EXPECT_FALSE(cache.load(mapFile, cached));
+    ASSERT_TRUE(cache.store(stamp, parsed));
+    ASSERT_TRUE(cache.load(mapFile, cached));
+
+    EXPECT_TRUE(cached.isValid());
+    EXPECT_EQ(cached.rows, parsed.rows);
+    EXPECT_EQ(cached.cols, parsed.cols);
+    EXPECT_EQ(cached.maxSteps, parsed.maxSteps);
+    EXPECT_EQ(cached.numShells, parsed.numShells);
+    EXPECT_EQ(cached.mapName, parsed.mapName);
+    EXPECT_EQ(cached.getWarnings(), parsed.getWarnings());
+    EXPECT_EQ(readRows(cached), readRows(parsed));
+    EXPECT_EQ(cached.satelliteView->getObjectAt(3, 0), '&');
+}
+
+TEST_F(MapCacheTest, ChangedMapIsNotLoaded) {
+    writeMap({"1 2"}, 1, 3);
+    MapCache::FileStamp stamp = stampMap();
+    ErrorCollector errors;
+    auto parsed = FileLoader::loadBoardWithSatelliteView(mapFile, errors);
+    MapCache cache(cacheFolder);
+    ASSERT_TRUE(cache.store(stamp, parsed));
+
+    writeMap({"1  2"}, 1, 4);
+    FileLoader::BoardInfo cached{};
+    EXPECT_FALSE(cache.load(mapFile, cached));
+}
+
+TEST_F(MapCacheTest, MapChangedDuringParseIsNotStored) {
+    writeMap({"1 2"}, 1, 3);
+    MapCache::FileStamp stamp = stampMap();
+    ErrorCollector errors;
+    auto parsed = FileLoader::loadBoardWithSatelliteView(mapFile, errors);
+    ASSERT_TRUE(parsed.isValid());
+
+    // Edited after the parse, the parsed board is the old one
+    writeMap({"1  2"}, 1, 4);
+    MapCache cache(cacheFolder);
+    EXPECT_FALSE(cache.store(stamp, parsed));
+    FileLoader::BoardInfo cached{};
+    EXPECT_FALSE(cache.load(mapFile, cached));
+}
+
+TEST_F(MapCacheTest, DamagedCountsAreAMiss) {
+    writeMap({"1 2"}, 1, 3);
+    MapCache cache(cacheFolder);
+    ErrorCollector errors;
+    ASSERT_TRUE(cache.store(stampMap(), FileLoader::loadBoardWithSatelliteView(mapFile, errors)));
+    std::filesystem::path entry = std::filesystem::directory_iterator(cacheFolder)->path();
+    std::vector<std::string> lines;
+    {
+        std::ifstream file(entry);
+        for (std::string line; std::getline(file, line);) {
+            lines.push_back(line);
+        }
+    }
+    ASSERT_EQ(lines.size(), 7u);
+
+    // Dimensions on line 3 and the warning count on line 5
+    auto loadWithLine = [&](size_t index, const std::string& value) {
+        std::vector<std::string> damaged = lines;
+        damaged[index] = value;
+        {
+            std::ofstream file(entry, std::ios::trunc);
+            for (const auto& line : damaged) {
+                file << line << "\n";
+            }
+        }
+        FileLoader::BoardInfo cached{};
+        return cache.load(mapFile, cached);
+    };
+    EXPECT_TRUE(loadWithLine(5, "0"));
+    EXPECT_FALSE(loadWithLine(5, "18446744073709551615"));
+    EXPECT_FALSE(loadWithLine(5, "1000000000000"));
+    EXPECT_FALSE(loadWithLine(3, "1000000000000 3 500 16"));
+    EXPECT_FALSE(loadWithLine(3, "4294967296 4294967296 500 16"));
+    EXPECT_FALSE(loadWithLine(3, "1 18446744073709551615 500 16"));
+}
+
+TEST_F(MapCacheTest, InvalidBoardIsNotStored) {
+    writeMap({"   "}, 1, 3);
+    ErrorCollector errors;
+    auto parsed = FileLoader::loadBoardWithSatelliteView(mapFile, errors);
+    ASSERT_FALSE(parsed.isValid());
+
+    MapCache cache(cacheFolder);
+    EXPECT_FALSE(cache.store(stampMap(), parsed));
+    FileLoader::BoardInfo cached{};
+    EXPECT_FALSE(cache.load(mapFile, cached));
+}
+
+TEST_F(MapCacheTest, DISABLED_Benchmark_ParseComparedToCacheHit) {
+    const size_t size = 500;
+    const int loads = 10;
+    std::vector<std::string> boardLines(size, std::string(size, ' '));
+    for (size_t i = 0; i < size; ++i) {
+        boardLines[i][(i * 7) % size] = '#';
+    }
+    boardLines[0][1] = '1';
+    boardLines[size - 1][size - 2] = '2';
+    writeMap(boardLines, size, size);
+
+    MapCache cache(cacheFolder);
+    ErrorCollector errors;
+    ASSERT_TRUE(cache.store(stampMap(), FileLoader::loadBoardWithSatelliteView(mapFile, errors)));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loads; ++i) {
+        auto board = FileLoader::loadBoardWithSatelliteView(mapFile, errors);
+        ASSERT_TRUE(board.isValid());
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loads; ++i) {
+        FileLoader::BoardInfo board{};
+        ASSERT_TRUE(cache.load(mapFile, board));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double parseTime = std::chrono::duration<double>(middle - start).count();
+    double cacheTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("parse_ms", std::to_string(parseTime * 1000));
+    RecordProperty("cache_hit_ms", std::to_string(cacheTime * 1000));
+
+}
@@ -0,0 +1,54 @@
+#include "mapped_file.h"
+
+#include <fstream>
+#include <iterator>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Smaller files are copied, a mapping is kept for as long as its view and
+// every mapping counts against vm.max_map_count
+constexpr off_t MIN_MAPPED_SIZE = off_t(1) << 20;
+
+} // namespace
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::string& filePath) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size >= MIN_MAPPED_SIZE) {
+        void* data = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            file->m_data = static_cast<const char*>(data);
+            file->m_size = static_cast<size_t>(info.st_size);
+            file->m_mapped = true;
+        }
+    }
+    ::close(fd);
+    if (file->m_mapped) {
+        return file;
+    }
+
+    std::ifstream input(filePath, std::ios::binary);
+    if (!input.is_open()) {
+        return nullptr;
+    }
+    file->m_buffer.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    file->m_data = file->m_buffer.data();
+    file->m_size = file->m_buffer.size();
+    return file;
+}
+
+MappedFile::~MappedFile() {
+    if (m_mapped) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped when possible
+ *
+ * Parsers can keep string_views into the contents for as long as they hold
+ * the shared pointer, without copying the file into strings. Only files of
+ * at least 1 MiB are mapped, and they must not be truncated while mapped.
+ * Smaller files and files that cannot be mapped, such as pipes, are read
+ * into a buffer instead.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Open a file and map its contents
+     * @param filePath Path of the file
+     * @return The mapped file, or nullptr if it cannot be opened
+     */
+    static std::shared_ptr<const MappedFile> open(const std::string& filePath);
+
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view contents() const { return std::string_view(m_data, m_size); }
+
+private:
+    MappedFile() = default;
+
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    std::string m_buffer;  // Contents when the file is not mapped
+};
@@ -0,0 +1,164 @@
+#include "match_scheduler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+
+// Names are written between tabs, one match per line
+bool isWritableName(const std::string& name) {
+    return !name.empty() && name.find_first_of("\t\r\n") == std::string::npos;
+}
+
+std::vector<std::string> splitTabs(const std::string& line) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    while (true) {
+        size_t tab = line.find('\t', start);
+        fields.push_back(line.substr(start, tab - start));
+        if (tab == std::string::npos) {
+            return fields;
+        }
+        start = tab + 1;
+    }
+}
+
+bool parseNumber(const std::string& field, double& value) {
+    if (field.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtod(field.c_str(), &end);
+    return end == field.c_str() + field.size();
+}
+
+} // namespace
+
+double MatchScheduler::estimateCost(const FileLoader::BoardInfo& board) {
+    size_t tanks = 0;
+    if (board.satelliteView) {
+        for (size_t y = 0; y < board.rows; ++y) {
+            for (size_t x = 0; x < board.cols; ++x) {
+                char object = board.satelliteView->getObjectAt(x, y);
+                if (object == '1' || object == '2') {
+                    tanks++;
+                }
+            }
+        }
+    }
+
+    double cells = static_cast<double>(board.rows) * static_cast<double>(board.cols);
+    return static_cast<double>(board.maxSteps) * cells * static_cast<double>(1 + tanks);
+}
+
+bool MatchScheduler::loadHistory(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Tab separated, so map paths and algorithm names may contain spaces:
+    // <map> <algorithm1> <algorithm2> <cost> <estimated seconds> <actual seconds>
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> fields = splitTabs(line);
+        double cost = 0;
+        double seconds = 0;
+        if (fields.size() != 6 || fields[0].empty() || fields[1].empty() || fields[2].empty() ||
+            !parseNumber(fields[3], cost) || !parseNumber(fields[5], seconds) || seconds < 0) {
+            continue;
+        }
+
+        Match match;
+        match.mapName = fields[0];
+        match.algorithm1Name = fields[1];
+        match.algorithm2Name = fields[2];
+        m_history[makeKey(match)] = HistoryEntry{cost, seconds};
+    }
+    return true;
+}
+
+void MatchScheduler::schedule(std::vector<Match>& matches) const {
+    double rate = secondsPerCost();
+
+    for (Match& match : matches) {
+        auto it = m_history.find(makeKey(match));
+        if (it != m_history.end()) {
+            match.estimatedSeconds = it->second.seconds;
+        } else if (rate >= 0) {
+            match.estimatedSeconds = match.cost * rate;
+        } else {
+            match.estimatedSeconds = -1;
+        }
+    }
+
+    // Sort by seconds only if every match has an estimate, so both keys never mix
+    bool allEstimated = std::all_of(matches.begin(), matches.end(), [](const Match& match) {
+        return match.estimatedSeconds >= 0;
+    });
+    std::stable_sort(matches.begin(), matches.end(), [allEstimated](const Match& a, const Match& b) {
+        return allEstimated ? a.estimatedSeconds > b.estimatedSeconds : a.cost > b.cost;
+    });
+}
+
+bool MatchScheduler::saveReport(const std::string& filePath, const std::vector<Match>& matches) const {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "# map\talgorithm1\talgorithm2\testimated_cost\testimated_seconds\tactual_seconds" << std::endl;
+
+    // This run in dispatch order. Names that cannot be written on one tab
+    // separated line are left out, the match is then simply not in the history.
+    std::map<std::string, HistoryEntry> written;
+    for (const Match& match : matches) {
+        if (!isWritableName(match.mapName) || !isWritableName(match.algorithm1Name) ||
+            !isWritableName(match.algorithm2Name)) {
+            continue;
+        }
+        file << makeKey(match) << "\t" << match.cost << "\t";
+        if (match.estimatedSeconds >= 0) {
+            file << match.estimatedSeconds;
+        } else {
+            file << "-";
+        }
+        file << "\t" << match.actualSeconds << std::endl;
+        written[makeKey(match)] = HistoryEntry{match.cost, match.actualSeconds};
+    }
+
+    // Earlier runs of matches that were not played this time
+    for (const auto& [key, entry] : m_history) {
+        if (written.find(key) == written.end()) {
+            file << key << "\t" << entry.cost << "\t-\t" << entry.seconds << std::endl;
+        }
+    }
+
+    return file.good();
+}
+
+size_t MatchScheduler::getHistorySize() const {
+    return m_history.size();
+}
+
+std::string MatchScheduler::makeKey(const Match& match) {
+    return match.mapName + "\t" + match.algorithm1Name + "\t" + match.algorithm2Name;
+}
+
+double MatchScheduler::secondsPerCost() const {
+    double totalCost = 0;
+    double totalSeconds = 0;
+    for (const auto& [key, entry] : m_history) {
+        totalCost += entry.cost;
+        totalSeconds += entry.seconds;
+    }
+    return totalCost > 0 ? totalSeconds / totalCost : -1;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "file_loader.h"
+
+/**
+ * @brief Orders tournament matches so the most expensive ones start first
+ *
+ * Matches are dispatched longest first so a huge map does not start last and
+ * keep one worker busy while the others sit idle. The cost of a match is
+ * estimated from its board (rows x cols, MaxSteps and tank count) and, when a
+ * match history file from earlier runs is loaded, from the measured durations
+ * of those runs.
+ *
+ * The history file doubles as the schedule report: one tab separated line
+ * per match with its map, algorithms, estimated cost, estimated seconds and
+ * actual seconds. Tabs keep map paths and algorithm names with spaces intact.
+ */
+class MatchScheduler {
+public:
+    struct Match {
+        int algorithm1Index = 0;
+        int algorithm2Index = 0;
+        int mapIndex = 0;
+        std::string mapName;
+        std::string algorithm1Name;
+        std::string algorithm2Name;
+        double cost = 0;               // Static estimate in board cell-steps
+        double estimatedSeconds = -1;  // -1 when no history is available
+        double actualSeconds = -1;     // -1 until the match ran
+    };
+
+    /**
+     * @brief Estimate the cost of playing a match on a board
+     *
+     * Every step updates the board and lets every tank decide, and tank
+     * algorithms typically look at the whole board, so the cost is
+     * MaxSteps x cells x (1 + tanks).
+     *
+     * @param board Loaded board information
+     * @return Estimated cost in board cell-steps
+     */
+    static double estimateCost(const FileLoader::BoardInfo& board);
+
+    /**
+     * @brief Load the durations recorded by earlier runs
+     *
+     * @param filePath History file written by saveReport
+     * @return true if the file was read, false if it does not exist or cannot be opened
+     */
+    bool loadHistory(const std::string& filePath);
+
+    /**
+     * @brief Estimate durations and sort matches longest first
+     *
+     * Matches seen in the history use their recorded duration, the others
+     * scale their cost by the seconds per cost unit measured in the history.
+     * Without history the static cost alone decides the order. Equal
+     * estimates keep their original order.
+     *
+     * @param matches Matches to estimate and reorder in place
+     */
+    void schedule(std::vector<Match>& matches) const;
+
+    /**
+     * @brief Write the schedule report, merged with the loaded history
+     *
+     * Matches of this run replace their history entries, entries of matches
+     * that did not run are kept so later runs can still use them.
+     *
+     * @param filePath Output file path
+     * @param matches Matches of this run with their actual durations
+     * @return true if the file was written
+     */
+    bool saveReport(const std::string& filePath, const std::vector<Match>& matches) const;
+
+    size_t getHistorySize() const;
+
+private:
+    struct HistoryEntry {
+        double cost = 0;
+        double seconds = 0;
+    };
+
+    static std::string makeKey(const Match& match);
+
+    // Seconds per cost unit over the history, -1 if unknown
+    double secondsPerCost() const;
+
+    std::map<std::string, HistoryEntry> m_history;
+};
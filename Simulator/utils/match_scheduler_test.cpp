@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+#include "match_scheduler.h"
+#include "work_stealing_thread_pool.h"
+#include "test/helpers/board_info_test_helpers.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+class MatchSchedulerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(historyFile.c_str());
+    }
+
+    static MatchScheduler::Match makeMatch(const std::string& mapName, double cost,
+                                           const std::string& algorithm1 = "A",
+                                           const std::string& algorithm2 = "B") {
+        MatchScheduler::Match match;
+        match.mapName = mapName;
+        match.algorithm1Name = algorithm1;
+        match.algorithm2Name = algorithm2;
+        match.cost = cost;
+        return match;
+    }
+
+    static std::vector<std::string> mapOrder(const std::vector<MatchScheduler::Match>& matches) {
+        std::vector<std::string> order;
+        for (const auto& match : matches) {
+            order.push_back(match.mapName + match.algorithm1Name);
+        }
+        return order;
+    }
+
+    std::string historyFile = "test_match_history.txt";
+};
+
+TEST_F(MatchSchedulerTest, EstimateCost_GrowsWithBoardStepsAndTanks) {
+    auto board = BoardInfoTestHelpers::createValidBoardInfo();
+    // 10x10 board, 100 steps, 2 tanks
+    EXPECT_DOUBLE_EQ(MatchScheduler::estimateCost(board), 100.0 * 100.0 * 3.0);
+
+    auto bigger = BoardInfoTestHelpers::createCustomBoardInfo(20, 30, 100, 5);
+    auto longer = BoardInfoTestHelpers::createCustomBoardInfo(10, 10, 1000, 5);
+    EXPECT_GT(MatchScheduler::estimateCost(bigger), MatchScheduler::estimateCost(board));
+    EXPECT_GT(MatchScheduler::estimateCost(longer), MatchScheduler::estimateCost(board));
+
+    auto invalid = BoardInfoTestHelpers::createInvalidBoardInfo();
+    EXPECT_DOUBLE_EQ(MatchScheduler::estimateCost(invalid), 100.0 * 100.0);
+}
+
+TEST_F(MatchSchedulerTest, Schedule_WithoutHistorySortsByCost) {
+    MatchScheduler scheduler;
+    std::vector<MatchScheduler::Match> matches = {
+        makeMatch("small", 10), makeMatch("huge", 1000), makeMatch("medium", 100),
+        makeMatch("small", 10, "C", "D")
+    };
+    scheduler.schedule(matches);
+
+    EXPECT_EQ(mapOrder(matches), (std::vector<std::string>{"hugeA", "mediumA", "smallA", "smallC"}));
+    for (const auto& match : matches) {
+        EXPECT_LT(match.estimatedSeconds, 0);
+    }
+}
+
+TEST_F(MatchSchedulerTest, Schedule_UsesHistoryBeforeCost) {
+    {
+        std::ofstream file(historyFile);
+        file << "# map\talgorithm1\talgorithm2\testimated_cost\testimated_seconds\tactual_seconds\n";
+        // The small map turned out to be slow for these algorithms
+        file << "small\tA\tB\t10\t-\t4\n";
+        file << "medium\tA\tB\t100\t-\t1\n";
+        file << "not a valid line\n";
+        file << "small A B 10 - 4\n";
+    }
+
+    MatchScheduler scheduler;
+    ASSERT_TRUE(scheduler.loadHistory(historyFile));
+    EXPECT_EQ(scheduler.getHistorySize(), 2u);
+
+    std::vector<MatchScheduler::Match> matches = {
+        makeMatch("medium", 100), makeMatch("small", 10), makeMatch("huge", 1000)
+    };
+    scheduler.schedule(matches);
+
+    // 5 seconds over 110 cost units puts the unseen huge map at ~45 seconds
+    EXPECT_EQ(mapOrder(matches), (std::vector<std::string>{"hugeA", "smallA", "mediumA"}));
+    EXPECT_NEAR(matches[0].estimatedSeconds, 1000 * 5.0 / 110.0, 1e-9);
+    EXPECT_DOUBLE_EQ(matches[1].estimatedSeconds, 4);
+    EXPECT_DOUBLE_EQ(matches[2].estimatedSeconds, 1);
+}
+
+TEST_F(MatchSchedulerTest, LoadHistory_MissingFile) {
+    MatchScheduler scheduler;
+    EXPECT_FALSE(scheduler.loadHistory("no_such_match_history.txt"));
+    EXPECT_EQ(scheduler.getHistorySize(), 0u);
+}
+
+TEST_F(MatchSchedulerTest, SaveReport_MergesWithHistory) {
+    {
+        std::ofstream file(historyFile);
+        file << "old\tA\tB\t50\t-\t2\n";
+        file << "small\tA\tB\t10\t-\t4\n";
+    }
+
+    MatchScheduler scheduler;
+    ASSERT_TRUE(scheduler.loadHistory(historyFile));
+    std::vector<MatchScheduler::Match> matches = {makeMatch("small", 10), makeMatch("new", 20)};
+    scheduler.schedule(matches);
+    matches[0].actualSeconds = 0.5;
+    matches[1].actualSeconds = 3;
+    ASSERT_TRUE(scheduler.saveReport(historyFile, matches));
+
+    MatchScheduler reloaded;
+    ASSERT_TRUE(reloaded.loadHistory(historyFile));
+    EXPECT_EQ(reloaded.getHistorySize(), 3u);
+
+    // This run's durations replace the old ones
+    std::vector<MatchScheduler::Match> next = {makeMatch("small", 10), makeMatch("new", 20)};
+    reloaded.schedule(next);
+    EXPECT_EQ(mapOrder(next), (std::vector<std::string>{"newA", "smallA"}));
+    EXPECT_DOUBLE_EQ(next[0].estimatedSeconds, 3);
+    EXPECT_DOUBLE_EQ(next[1].estimatedSeconds, 0.5);
+}
+
+TEST_F(MatchSchedulerTest, SaveReport_KeepsNamesWithSpaces) {
+    MatchScheduler scheduler;
+    std::vector<MatchScheduler::Match> matches = {
+        makeMatch("my maps/big map.txt", 100, "Player A", "B"),
+        makeMatch("my", 10, "maps/big", "map.txt Player A")
+    };
+    scheduler.schedule(matches);
+    matches[0].actualSeconds = 7;
+    matches[1].actualSeconds = 1;
+    ASSERT_TRUE(scheduler.saveReport(historyFile, matches));
+
+    MatchScheduler reloaded;
+    ASSERT_TRUE(reloaded.loadHistory(historyFile));
+    EXPECT_EQ(reloaded.getHistorySize(), 2u);
+
+    std::vector<MatchScheduler::Match> next = {
+        makeMatch("my", 10, "maps/big", "map.txt Player A"),
+        makeMatch("my maps/big map.txt", 100, "Player A", "B")
+    };
+    reloaded.schedule(next);
+    EXPECT_EQ(next[0].mapName, "my maps/big map.txt");
+    EXPECT_DOUBLE_EQ(next[0].estimatedSeconds, 7);
+    EXPECT_DOUBLE_EQ(next[1].estimatedSeconds, 1);
+}
+
+TEST_F(MatchSchedulerTest, SaveReport_SkipsNamesWithTabs) {
+    MatchScheduler scheduler;
+    std::vector<MatchScheduler::Match> matches = {
+        makeMatch("tab\tmap", 10), makeMatch("plain", 10)
+    };
+    scheduler.schedule(matches);
+    matches[0].actualSeconds = 2;
+    matches[1].actualSeconds = 3;
+    ASSERT_TRUE(scheduler.saveReport(historyFile, matches));
+
+    MatchScheduler reloaded;
+    ASSERT_TRUE(reloaded.loadHistory(historyFile));
+    EXPECT_EQ(reloaded.getHistorySize(), 1u);
+}
+
+namespace {
+
+// Runs the matches in order on a pool, each sleeping for its cost in milliseconds
+double runMakespan(const std::vector<MatchScheduler::Match>& matches, size_t numThreads) {
+    auto start = std::chrono::steady_clock::now();
+    {
+        WorkStealingThreadPool pool(numThreads);
+        for (const auto& match : matches) {
+            int millis = static_cast<int>(match.cost);
+            pool.submit([millis]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+            });
+        }
+        pool.waitForAll();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_F(MatchSchedulerTest, DISABLED_Benchmark_LongestFirstMakespan) {
+    // Map order puts the few huge maps last, as a folder listing may
+    std::vector<MatchScheduler::Match> matches;
+    for (int i = 0; i < 20; ++i) {
+        matches.push_back(makeMatch("small" + std::to_string(i), 5));
+    }
+    for (int i = 0; i < 5; ++i) {
+        matches.push_back(makeMatch("huge" + std::to_string(i), 60));
+    }
+
+    double mapOrderTime = runMakespan(matches, 4);
+    MatchScheduler().schedule(matches);
+    double longestFirstTime = runMakespan(matches, 4);
+
+    RecordProperty("map_order_ms", std::to_string(mapOrderTime * 1000));
+    RecordProperty("longest_first_ms", std::to_string(longestFirstTime * 1000));
+
+    EXPECT_LT(longestFirstTime, mapOrderTime);
+}
@@ -0,0 +1,371 @@
+#include "process_sandbox.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+enum class MatchStatus : int32_t { Completed, Failed };
+
+// Fixed-size result sent from a worker to the parent
+struct ResultMessage {
+    uint64_t matchIndex;
+    MatchStatus status;
+    int32_t winner;
+    int32_t reason;
+    uint64_t rounds;
+    uint64_t remainingTanks[2];
+    double seconds;
+};
+
+bool writeAll(int fd, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Returns false on end of file or error before size bytes arrived
+bool readAll(int fd, void* data, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t received = ::read(fd, bytes, size);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+rlim_t usedCpuSeconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<rlim_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + 1);
+}
+
+std::string describeExit(int status) {
+    if (WIFSIGNALED(status)) {
+        int signal = WTERMSIG(status);
+        if (signal == SIGXCPU) {
+            return "CPU time limit exceeded";
+        }
+        return "Worker killed by signal " + std::to_string(signal) + " (" + strsignal(signal) + ")";
+    }
+    if (WIFEXITED(status)) {
+        return "Worker exited with code " + std::to_string(WEXITSTATUS(status));
+    }
+    return "Worker stopped unexpectedly";
+}
+
+} // namespace
+
+ProcessSandbox::ProcessSandbox(size_t numWorkers, const Limits& limits, MatchFunction runMatch)
+    : m_workers(numWorkers > 0 ? numWorkers : 1), m_limits(limits), m_runMatch(std::move(runMatch)) {
+    // A write to a dead worker must fail instead of killing the parent
+    m_previousSigpipe = std::signal(SIGPIPE, SIG_IGN);
+
+    for (Worker& worker : m_workers) {
+        spawn(worker);
+    }
+}
+
+ProcessSandbox::~ProcessSandbox() {
+    for (Worker& worker : m_workers) {
+        stop(worker);
+    }
+    std::signal(SIGPIPE, m_previousSigpipe == SIG_ERR ? SIG_DFL : m_previousSigpipe);
+}
+
+size_t ProcessSandbox::getNumWorkers() const {
+    return m_workers.size();
+}
+
+size_t ProcessSandbox::getSpawnCount() const {
+    return m_spawnCount;
+}
+
+bool ProcessSandbox::spawn(Worker& worker) {
+    int requestPipe[2];
+    int resultPipe[2];
+    if (pipe(requestPipe) != 0) {
+        return false;
+    }
+    if (pipe(resultPipe) != 0) {
+        close(requestPipe[0]);
+        close(requestPipe[1]);
+        return false;
+    }
+
+    // Buffered output would otherwise be written again by the child
+    std::cout.flush();
+    std::cerr.flush();
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(requestPipe[0]);
+        close(requestPipe[1]);
+        close(resultPipe[0]);
+        close(resultPipe[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        // Only keep this worker's ends, so other workers see end of file
+        for (const Worker& other : m_workers) {
+            if (other.requestFd >= 0) close(other.requestFd);
+            if (other.resultFd >= 0) close(other.resultFd);
+        }
+        close(requestPipe[1]);
+        close(resultPipe[0]);
+        workerLoop(requestPipe[0], resultPipe[1]);
+        std::cout.flush();
+        std::cerr.flush();
+        _exit(0);
+    }
+
+    close(requestPipe[0]);
+    close(resultPipe[1]);
+    worker.pid = pid;
+    worker.requestFd = requestPipe[1];
+    worker.resultFd = resultPipe[0];
+    worker.busy = false;
+    m_spawnCount++;
+    return true;
+}
+
+void ProcessSandbox::stop(Worker& worker) {
+    if (worker.requestFd >= 0) {
+        // End of file on the request pipe lets an idle worker exit
+        close(worker.requestFd);
+        worker.requestFd = -1;
+    }
+    if (worker.resultFd >= 0) {
+        close(worker.resultFd);
+        worker.resultFd = -1;
+    }
+    if (worker.pid > 0) {
+        if (worker.busy) {
+            kill(worker.pid, SIGKILL);
+        }
+        waitpid(worker.pid, nullptr, 0);
+        worker.pid = -1;
+    }
+    worker.busy = false;
+}
+
+void ProcessSandbox::workerLoop(int requestFd, int resultFd) {
+    if (m_limits.memoryMb > 0) {
+        rlim_t bytes = static_cast<rlim_t>(m_limits.memoryMb) * 1024 * 1024;
+        rlimit memoryLimit{bytes, bytes};
+        setrlimit(RLIMIT_AS, &memoryLimit);
+    }
+
+    uint64_t matchIndex = 0;
+    while (readAll(requestFd, &matchIndex, sizeof(matchIndex))) {
+        if (m_limits.cpuSeconds > 0) {
+            // The CPU limit counts the whole process, so move it past what
+            // earlier matches used. Only the soft limit moves, an unprivileged
+            // process cannot raise its hard limit again.
+            rlimit cpuLimit{};
+            getrlimit(RLIMIT_CPU, &cpuLimit);
+            cpuLimit.rlim_cur = usedCpuSeconds() + static_cast<rlim_t>(m_limits.cpuSeconds);
+            if (cpuLimit.rlim_max != RLIM_INFINITY && cpuLimit.rlim_cur > cpuLimit.rlim_max) {
+                cpuLimit.rlim_cur = cpuLimit.rlim_max;
+            }
+            setrlimit(RLIMIT_CPU, &cpuLimit);
+        }
+
+        ResultMessage message{};
+        message.matchIndex = matchIndex;
+        message.status = MatchStatus::Failed;
+        auto start = std::chrono::steady_clock::now();
+        try {
+            GameResult result = m_runMatch(static_cast<size_t>(matchIndex));
+            message.status = MatchStatus::Completed;
+            message.winner = result.winner;
+            message.reason = static_cast<int32_t>(result.reason);
+            message.rounds = result.rounds;
+            for (size_t i = 0; i < result.remaining_tanks.size() && i < 2; ++i) {
+                message.remainingTanks[i] = result.remaining_tanks[i];
+            }
+        } catch (...) {
+            // Reported as a failed match, including running out of memory
+        }
+        message.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout.flush();
+
+        if (!writeAll(resultFd, &message, sizeof(message))) {
+            break;
+        }
+    }
+}
+
+bool ProcessSandbox::dispatch(Worker& worker, size_t matchIndex) {
+    uint64_t index = matchIndex;
+    if (!writeAll(worker.requestFd, &index, sizeof(index))) {
+        return false;
+    }
+    worker.busy = true;
+    worker.matchIndex = matchIndex;
+    worker.started = std::chrono::steady_clock::now();
+    return true;
+}
+
+ProcessSandbox::MatchOutcome ProcessSandbox::collect(Worker& worker) {
+    MatchOutcome outcome;
+    ResultMessage message{};
+    worker.busy = false;
+
+    if (readAll(worker.resultFd, &message, sizeof(message))) {
+        outcome.seconds = message.seconds;
+        if (message.status == MatchStatus::Completed) {
+            outcome.completed = true;
+            outcome.result.winner = message.winner;
+            outcome.result.reason = static_cast<GameResult::Reason>(message.reason);
+            outcome.result.rounds = static_cast<size_t>(message.rounds);
+            outcome.result.remaining_tanks = {static_cast<size_t>(message.remainingTanks[0]),
+                                              static_cast<size_t>(message.remainingTanks[1])};
+        } else {
+            outcome.error = "Match failed with an exception";
+        }
+        return outcome;
+    }
+
+    // The worker died during the match, replace it
+    int status = 0;
+    close(worker.requestFd);
+    close(worker.resultFd);
+    worker.requestFd = -1;
+    worker.resultFd = -1;
+    waitpid(worker.pid, &status, 0);
+    worker.pid = -1;
+    outcome.error = describeExit(status);
+    spawn(worker);
+    return outcome;
+}
+
+ProcessSandbox::MatchOutcome ProcessSandbox::timeOut(Worker& worker) {
+    MatchOutcome outcome;
+    outcome.error = "Wall clock time limit exceeded";
+    outcome.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - worker.started).count();
+
+    // The worker is busy, so stop kills it before reaping
+    stop(worker);
+    spawn(worker);
+    return outcome;
+}
+
+int ProcessSandbox::pollTimeoutMs() const {
+    if (m_limits.wallSeconds == 0) {
+        return -1;
+    }
+
+    // Wake up at the earliest deadline of the matches in flight
+    auto now = std::chrono::steady_clock::now();
+    auto limit = std::chrono::seconds(m_limits.wallSeconds);
+    int timeout = -1;
+    for (const Worker& worker : m_workers) {
+        if (!worker.busy) {
+            continue;
+        }
+        auto left = std::chrono::ceil<std::chrono::milliseconds>(worker.started + limit - now).count();
+        int leftMs = static_cast<int>(std::max<decltype(left)>(left, 0));
+        if (timeout < 0 || leftMs < timeout) {
+            timeout = leftMs;
+        }
+    }
+    return timeout;
+}
+
+bool ProcessSandbox::isOverWallLimit(const Worker& worker) const {
+    return m_limits.wallSeconds > 0 &&
+           std::chrono::steady_clock::now() - worker.started >= std::chrono::seconds(m_limits.wallSeconds);
+}
+
+std::vector<ProcessSandbox::MatchOutcome> ProcessSandbox::runMatches(size_t matchCount) {
+    std::vector<MatchOutcome> outcomes(matchCount);
+    size_t nextMatch = 0;
+    size_t finished = 0;
+
+    while (finished < matchCount) {
+        // Hand out matches to idle workers in dispatch order
+        for (Worker& worker : m_workers) {
+            for (int attempt = 0; attempt < 2 && !worker.busy && nextMatch < matchCount; ++attempt) {
+                if (worker.pid < 0 && !spawn(worker)) {
+                    break;
+                }
+                if (dispatch(worker, nextMatch)) {
+                    nextMatch++;
+                } else {
+                    // The idle worker is gone, replace it and try again
+                    stop(worker);
+                }
+            }
+        }
+
+        std::vector<pollfd> pollFds;
+        std::vector<Worker*> polled;
+        for (Worker& worker : m_workers) {
+            if (worker.busy) {
+                pollFds.push_back(pollfd{worker.resultFd, POLLIN, 0});
+                polled.push_back(&worker);
+            }
+        }
+
+        if (pollFds.empty()) {
+            // No worker could be started, fail what is left
+            for (; nextMatch < matchCount; ++nextMatch, ++finished) {
+                outcomes[nextMatch].error = "Cannot start a worker process";
+            }
+            break;
+        }
+
+        if (poll(pollFds.data(), pollFds.size(), pollTimeoutMs()) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            for (MatchOutcome& outcome : outcomes) {
+                if (!outcome.completed && outcome.error.empty()) {
+                    outcome.error = "Lost track of the worker processes";
+                }
+            }
+            break;
+        }
+
+        for (size_t i = 0; i < pollFds.size(); ++i) {
+            size_t matchIndex = polled[i]->matchIndex;
+            if (pollFds[i].revents != 0) {
+                outcomes[matchIndex] = collect(*polled[i]);
+                finished++;
+            } else if (isOverWallLimit(*polled[i])) {
+                outcomes[matchIndex] = timeOut(*polled[i]);
+                finished++;
+            }
+        }
+    }
+
+    return outcomes;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+#include "common/GameResult.h"
+
+/**
+ * @brief Runs matches in pre-forked worker processes
+ *
+ * Workers are forked once the libraries are loaded, so every worker starts
+ * warm and runs many matches. A match that crashes its worker, runs over its
+ * CPU or wall clock time or cannot get memory only fails that match: the
+ * worker is replaced and the remaining matches go on. Results come back over
+ * a pipe.
+ *
+ * The wall clock limit also catches matches that block, sleep or deadlock
+ * without using CPU time, so it applies even when no CPU limit is set.
+ *
+ * The parent must not run other threads while the sandbox forks workers.
+ */
+class ProcessSandbox {
+public:
+    static constexpr size_t DEFAULT_WALL_SECONDS = 600;
+
+    struct Limits {
+        size_t cpuSeconds = 0;                      // Per match, 0 for no limit
+        size_t wallSeconds = DEFAULT_WALL_SECONDS;  // Per match, 0 for no limit
+        size_t memoryMb = 0;                        // Address space of a worker, 0 for no limit
+    };
+
+    struct MatchOutcome {
+        bool completed = false;
+        GameResult result{};  // Without the final game state
+        std::string error;    // Why the match did not complete
+        double seconds = 0;   // Time the worker spent on the match
+    };
+
+    // Plays a match in a worker, called with the match index
+    using MatchFunction = std::function<GameResult(size_t)>;
+
+    /**
+     * @brief Fork the worker processes
+     * @param numWorkers Number of worker processes (at least one)
+     * @param limits Resource limits of each match
+     * @param runMatch Function playing one match, runs in the workers
+     */
+    ProcessSandbox(size_t numWorkers, const Limits& limits, MatchFunction runMatch);
+    ~ProcessSandbox();
+
+    ProcessSandbox(const ProcessSandbox&) = delete;
+    ProcessSandbox& operator=(const ProcessSandbox&) = delete;
+
+    /**
+     * @brief Play matches 0 to matchCount - 1, dispatched in index order
+     * @param matchCount Number of matches
+     * @return Outcome of every match, by match index
+     */
+    std::vector<MatchOutcome> runMatches(size_t matchCount);
+
+    size_t getNumWorkers() const;
+
+    // Number of workers started so far, including replacements
+    size_t getSpawnCount() const;
+
+private:
+    struct Worker {
+        pid_t pid = -1;
+        int requestFd = -1;  // Parent writes match indices
+        int resultFd = -1;   // Parent reads results
+        bool busy = false;
+        size_t matchIndex = 0;
+        std::chrono::steady_clock::time_point started;  // When the match was dispatched
+    };
+
+    bool spawn(Worker& worker);
+    void stop(Worker& worker);
+    bool dispatch(Worker& worker, size_t matchIndex);
+    MatchOutcome collect(Worker& worker);
+    MatchOutcome timeOut(Worker& worker);
+    int pollTimeoutMs() const;
+    bool isOverWallLimit(const Worker& worker) const;
+    void workerLoop(int requestFd, int resultFd);
+
+    using SignalHandler = void (*)(int);
+
+    std::vector<Worker> m_workers;
+    Limits m_limits;
+    MatchFunction m_runMatch;
+    size_t m_spawnCount = 0;
+    SignalHandler m_previousSigpipe = nullptr;
+};
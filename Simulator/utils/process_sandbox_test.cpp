@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+#include "process_sandbox.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class ProcessSandboxTest : public ::testing::Test {
+protected:
+    static GameResult makeResult(int winner, size_t rounds) {
+        GameResult result{};
+        result.winner = winner;
+        result.reason = GameResult::MAX_STEPS;
+        result.rounds = rounds;
+        result.remaining_tanks = {1, 2};
+        return result;
+    }
+};
+
+TEST_F(ProcessSandboxTest, RunMatches_ReturnsResultsByIndex) {
+    ProcessSandbox sandbox(3, {}, [](size_t index) {
+        return makeResult(static_cast<int>(index % 3), index * 10);
+    });
+    EXPECT_EQ(sandbox.getNumWorkers(), 3u);
+
+    auto outcomes = sandbox.runMatches(20);
+    ASSERT_EQ(outcomes.size(), 20u);
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+        ASSERT_TRUE(outcomes[i].completed) << outcomes[i].error;
+        EXPECT_EQ(outcomes[i].result.winner, static_cast<int>(i % 3));
+        EXPECT_EQ(outcomes[i].result.reason, GameResult::MAX_STEPS);
+        EXPECT_EQ(outcomes[i].result.rounds, i * 10);
+        EXPECT_EQ(outcomes[i].result.remaining_tanks, (std::vector<size_t>{1, 2}));
+        EXPECT_EQ(outcomes[i].result.gameState, nullptr);
+    }
+    EXPECT_EQ(sandbox.getSpawnCount(), 3u);
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_ReusesWarmWorkers) {
+    pid_t parent = getpid();
+    ProcessSandbox sandbox(2, {}, [](size_t) {
+        return makeResult(0, static_cast<size_t>(getpid()));
+    });
+
+    auto outcomes = sandbox.runMatches(10);
+    std::vector<size_t> pids;
+    for (const auto& outcome : outcomes) {
+        ASSERT_TRUE(outcome.completed);
+        EXPECT_NE(outcome.result.rounds, static_cast<size_t>(parent));
+        if (std::find(pids.begin(), pids.end(), outcome.result.rounds) == pids.end()) {
+            pids.push_back(outcome.result.rounds);
+        }
+    }
+    EXPECT_LE(pids.size(), 2u);
+
+    // The same workers serve the next batch
+    outcomes = sandbox.runMatches(4);
+    EXPECT_EQ(sandbox.getSpawnCount(), 2u);
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_CrashOnlyFailsItsMatch) {
+    ProcessSandbox sandbox(2, {}, [](size_t index) {
+        if (index == 3) {
+            std::abort();
+        }
+        return makeResult(1, index);
+    });
+
+    auto outcomes = sandbox.runMatches(8);
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+        if (i == 3) {
+            EXPECT_FALSE(outcomes[i].completed);
+            EXPECT_NE(outcomes[i].error.find("signal"), std::string::npos) << outcomes[i].error;
+        } else {
+            EXPECT_TRUE(outcomes[i].completed) << i << ": " << outcomes[i].error;
+        }
+    }
+    // The crashed worker was replaced
+    EXPECT_EQ(sandbox.getSpawnCount(), 3u);
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_ExceptionFailsMatch) {
+    ProcessSandbox sandbox(1, {}, [](size_t index) -> GameResult {
+        if (index == 0) {
+            throw std::runtime_error("bad algorithm");
+        }
+        return makeResult(2, index);
+    });
+
+    auto outcomes = sandbox.runMatches(2);
+    EXPECT_FALSE(outcomes[0].completed);
+    EXPECT_FALSE(outcomes[0].error.empty());
+    EXPECT_TRUE(outcomes[1].completed);
+    EXPECT_EQ(sandbox.getSpawnCount(), 1u);
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_CpuLimitStopsEndlessMatch) {
+    ProcessSandbox::Limits limits;
+    limits.cpuSeconds = 1;
+    ProcessSandbox sandbox(1, limits, [](size_t index) {
+        if (index == 0) {
+            volatile unsigned long spin = 0;
+            while (true) {
+                spin = spin + 1;
+            }
+        }
+        return makeResult(0, index);
+    });
+
+    auto outcomes = sandbox.runMatches(2);
+    EXPECT_FALSE(outcomes[0].completed);
+    EXPECT_EQ(outcomes[0].error, "CPU time limit exceeded");
+    EXPECT_TRUE(outcomes[1].completed) << outcomes[1].error;
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_WallLimitStopsSleepingMatch) {
+    ProcessSandbox::Limits limits;
+    limits.wallSeconds = 1;
+    ProcessSandbox sandbox(2, limits, [](size_t index) {
+        if (index == 1) {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
+        return makeResult(0, index);
+    });
+
+    auto outcomes = sandbox.runMatches(6);
+    EXPECT_FALSE(outcomes[1].completed);
+    EXPECT_EQ(outcomes[1].error, "Wall clock time limit exceeded");
+    EXPECT_GE(outcomes[1].seconds, 1.0);
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+        if (i != 1) {
+            EXPECT_TRUE(outcomes[i].completed) << i << ": " << outcomes[i].error;
+        }
+    }
+    // The stuck worker was replaced
+    EXPECT_EQ(sandbox.getSpawnCount(), 3u);
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_WallLimitStopsBlockedMatchUnderCpuLimit) {
+    // A match blocked on I/O uses no CPU time, so only the wall limit ends it
+    int blockPipe[2];
+    ASSERT_EQ(pipe(blockPipe), 0);
+    ProcessSandbox::Limits limits;
+    limits.cpuSeconds = 5;
+    limits.wallSeconds = 1;
+    ProcessSandbox sandbox(1, limits, [readFd = blockPipe[0]](size_t index) {
+        if (index == 0) {
+            char byte = 0;
+            while (read(readFd, &byte, 1) != 0) {
+            }
+        }
+        return makeResult(0, index);
+    });
+
+    auto outcomes = sandbox.runMatches(2);
+    close(blockPipe[0]);
+    close(blockPipe[1]);
+    EXPECT_FALSE(outcomes[0].completed);
+    EXPECT_EQ(outcomes[0].error, "Wall clock time limit exceeded");
+    EXPECT_TRUE(outcomes[1].completed) << outcomes[1].error;
+}
+
+TEST_F(ProcessSandboxTest, RunMatches_MemoryLimitStopsMemoryBlowup) {
+    ProcessSandbox::Limits limits;
+    limits.memoryMb = 512;
+    ProcessSandbox sandbox(1, limits, [](size_t index) {
+        if (index == 0) {
+            std::vector<std::vector<char>> blocks;
+            while (true) {
+                blocks.emplace_back(64 * 1024 * 1024, 'x');
+            }
+        }
+        return makeResult(0, index);
+    });
+
+    auto outcomes = sandbox.runMatches(2);
+    EXPECT_FALSE(outcomes[0].completed);
+    EXPECT_TRUE(outcomes[1].completed) << outcomes[1].error;
+}
+
+TEST_F(ProcessSandboxTest, DISABLED_Benchmark_ComparedToInProcess) {
+    const size_t matchCount = 2000;
+    auto play = [](size_t index) {
+        unsigned long value = index;
+        for (int i = 0; i < 20000; ++i) {
+            value = value * 6364136223846793005UL + 1442695040888963407UL;
+        }
+        return makeResult(static_cast<int>(value % 3), index);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    int inProcessWins = 0;
+    for (size_t i = 0; i < matchCount; ++i) {
+        inProcessWins += play(i).winner;
+    }
+    auto middle = std::chrono::steady_clock::now();
+
+    ProcessSandbox sandbox(2, {}, play);
+    auto outcomes = sandbox.runMatches(matchCount);
+    auto end = std::chrono::steady_clock::now();
+
+    int sandboxWins = 0;
+    for (const auto& outcome : outcomes) {
+        sandboxWins += outcome.result.winner;
+    }
+
+    double inProcessTime = std::chrono::duration<double>(middle - start).count();
+    double sandboxTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("in_process_ms", std::to_string(inProcessTime * 1000));
+    RecordProperty("sandbox_ms", std::to_string(sandboxTime * 1000));
+
+    EXPECT_EQ(sandboxWins, inProcessWins);
+}
@@ -0,0 +1,158 @@
+#include "work_stealing_thread_pool.h"
+
+namespace {
+// Index of the pool worker running on this thread, tasks submitted from a
+// worker go to its own queue
+thread_local const WorkStealingThreadPool* t_workerPool = nullptr;
+thread_local size_t t_workerIndex = 0;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t numThreads) {
+    if (numThreads == 0) {
+        numThreads = 1;
+    }
+
+    // Same threading rule as ThreadPool: 1 means the main thread only,
+    // otherwise numThreads workers
+    if (numThreads == 1) {
+        return;
+    }
+
+    m_queues.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_workers.emplace_back(&WorkStealingThreadPool::workerThread, this, i);
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    shutdown();
+}
+
+void WorkStealingThreadPool::shutdown() {
+    {
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    m_workers.clear();
+}
+
+void WorkStealingThreadPool::waitForAll() {
+    // In single-threaded mode, all tasks are executed immediately
+    if (isSingleThreaded()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_finishedMutex);
+    m_finishedCondition.wait(lock, [this] {
+        return m_pendingTasks == 0;
+    });
+}
+
+size_t WorkStealingThreadPool::getNumThreads() const {
+    return m_workers.size();
+}
+
+size_t WorkStealingThreadPool::getQueueSize() const {
+    return m_queuedTasks;
+}
+
+bool WorkStealingThreadPool::isSingleThreaded() const {
+    return m_workers.empty();
+}
+
+void WorkStealingThreadPool::push(Task task) {
+    size_t queueIndex = t_workerPool == this
+        ? t_workerIndex
+        : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+    m_pendingTasks++;
+    {
+        // Counted under the queue lock so a pop never sees it negative
+        std::lock_guard<std::mutex> lock(m_queues[queueIndex]->mutex);
+        m_queues[queueIndex]->tasks.push_back(std::move(task));
+        m_queuedTasks++;
+    }
+
+    // A worker going to sleep registers before re-checking the queued
+    // count, so either it sees this task or we see it sleeping
+    if (m_sleepingWorkers > 0) {
+        { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+        m_wakeCondition.notify_one();
+    }
+}
+
+bool WorkStealingThreadPool::popTask(size_t workerIndex, Task& task) {
+    // Own queue first, oldest task so submission order is kept
+    {
+        WorkerQueue& own = *m_queues[workerIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            m_queuedTasks--;
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of another worker
+    for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+        WorkerQueue& victim = *m_queues[(workerIndex + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_queuedTasks--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::workerThread(size_t workerIndex) {
+    t_workerPool = this;
+    t_workerIndex = workerIndex;
+
+    while (true) {
+        Task task;
+        if (!popTask(workerIndex, task)) {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers++;
+            m_wakeCondition.wait(lock, [this] {
+                return m_stop || m_queuedTasks > 0;
+            });
+            m_sleepingWorkers--;
+
+            if (m_stop && m_queuedTasks == 0) {
+                return;
+            }
+            continue;
+        }
+
+        try {
+            task();
+        } catch (...) {
+            // Keep the worker alive, enqueued tasks report through their future
+        }
+        // Release the task's captures before it counts as finished
+        task = Task();
+
+        if (--m_pendingTasks == 0) {
+            std::lock_guard<std::mutex> lock(m_finishedMutex);
+            m_finishedCondition.notify_all();
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Thread pool with one task deque per worker. Workers run their own tasks
+// in submission order and steal the oldest tasks of other workers when idle,
+// so long tasks do not hold up the rest of the queue and tasks submitted
+// longest first also start longest first. Same interface and threading
+// rules as ThreadPool (numThreads <= 1 runs tasks inline).
+class WorkStealingThreadPool {
+public:
+    explicit WorkStealingThreadPool(size_t numThreads = 1);
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool(WorkStealingThreadPool&&) = delete;
+    WorkStealingThreadPool& operator=(WorkStealingThreadPool&&) = delete;
+
+    // Run a task and get its result through a future
+    template<typename F, typename... Args>
+    auto enqueue(F&& func, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>>;
+
+    // Run a task without a future, use waitForAll to wait for it
+    template<typename F>
+    void submit(F&& func);
+
+    void waitForAll();
+    void shutdown();
+    size_t getNumThreads() const;
+    size_t getQueueSize() const;
+    bool isSingleThreaded() const;
+
+private:
+    // Move-only type-erased task, one allocation per task
+    class Task {
+    public:
+        Task() = default;
+
+        template<typename F,
+                 typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+        explicit Task(F&& func)
+            : m_callable(std::make_unique<Callable<std::decay_t<F>>>(std::forward<F>(func))) {}
+
+        void operator()() { m_callable->call(); }
+
+    private:
+        struct CallableBase {
+            virtual ~CallableBase() = default;
+            virtual void call() = 0;
+        };
+
+        template<typename F>
+        struct Callable : CallableBase {
+            template<typename G>
+            explicit Callable(G&& func) : m_func(std::forward<G>(func)) {}
+            void call() override { m_func(); }
+            F m_func;
+        };
+
+        std::unique_ptr<CallableBase> m_callable;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+    std::atomic<bool> m_stop{false};
+    std::atomic<size_t> m_nextQueue{0};
+    std::atomic<size_t> m_queuedTasks{0};   // Waiting in a queue
+    std::atomic<size_t> m_pendingTasks{0};  // Queued or running
+    std::atomic<size_t> m_sleepingWorkers{0};
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+    std::mutex m_finishedMutex;
+    std::condition_variable m_finishedCondition;
+
+    void push(Task task);
+    bool popTask(size_t workerIndex, Task& task);
+    void workerThread(size_t workerIndex);
+};
+
+template<typename F, typename... Args>
+auto WorkStealingThreadPool::enqueue(F&& func, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
+
+    using ReturnType = std::invoke_result_t<F, Args...>;
+
+    std::packaged_task<ReturnType()> task(
+        [func = std::forward<F>(func), ...args = std::forward<Args>(args)]() mutable {
+            return std::invoke(std::move(func), std::move(args)...);
+        }
+    );
+    std::future<ReturnType> result = task.get_future();
+
+    if (m_stop) {
+        throw std::runtime_error("Cannot enqueue task on stopped WorkStealingThreadPool");
+    }
+
+    // If single-threaded, execute immediately on main thread
+    if (isSingleThreaded()) {
+        task();
+        return result;
+    }
+
+    push(Task(std::move(task)));
+    return result;
+}
+
+template<typename F>
+void WorkStealingThreadPool::submit(F&& func) {
+    if (m_stop) {
+        throw std::runtime_error("Cannot submit task on stopped WorkStealingThreadPool");
+    }
+
+    if (isSingleThreaded()) {
+        try {
+            func();
+        } catch (...) {
+            // Same as on a worker, a failing task does not stop the caller
+        }
+        return;
+    }
+
+    push(Task(std::forward<F>(func)));
+}
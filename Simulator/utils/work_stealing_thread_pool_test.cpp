@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+#include "work_stealing_thread_pool.h"
+#include "thread_pool.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+class WorkStealingThreadPoolTest : public ::testing::Test {
+};
+
+TEST_F(WorkStealingThreadPoolTest, ThreadCounts) {
+    WorkStealingThreadPool defaultPool;
+    EXPECT_EQ(defaultPool.getNumThreads(), 0);
+    EXPECT_TRUE(defaultPool.isSingleThreaded());
+
+    WorkStealingThreadPool zeroPool(0);
+    EXPECT_TRUE(zeroPool.isSingleThreaded());
+
+    WorkStealingThreadPool singlePool(1);
+    EXPECT_EQ(singlePool.getNumThreads(), 0);
+
+    WorkStealingThreadPool pool(4);
+    EXPECT_EQ(pool.getNumThreads(), 4);
+    EXPECT_FALSE(pool.isSingleThreaded());
+}
+
+TEST_F(WorkStealingThreadPoolTest, SingleThreadedRunsOnCallerThread) {
+    WorkStealingThreadPool pool(1);
+    std::thread::id callerId = std::this_thread::get_id();
+
+    auto future = pool.enqueue([]() { return std::this_thread::get_id(); });
+    EXPECT_EQ(future.get(), callerId);
+
+    std::thread::id submittedId;
+    pool.submit([&submittedId]() { submittedId = std::this_thread::get_id(); });
+    EXPECT_EQ(submittedId, callerId);
+}
+
+TEST_F(WorkStealingThreadPoolTest, TaskReturnValuesAndParameters) {
+    WorkStealingThreadPool pool(3);
+
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 50; ++i) {
+        futures.push_back(pool.enqueue([](int a, int b) { return a * b; }, i, 2));
+    }
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(futures[i].get(), i * 2);
+    }
+}
+
+TEST_F(WorkStealingThreadPoolTest, MoveOnlyArguments) {
+    WorkStealingThreadPool pool(2);
+    auto value = std::make_unique<int>(7);
+    auto future = pool.enqueue([](std::unique_ptr<int> p) { return *p; }, std::move(value));
+    EXPECT_EQ(future.get(), 7);
+}
+
+TEST_F(WorkStealingThreadPoolTest, ExceptionReachesFuture) {
+    WorkStealingThreadPool pool(2);
+    auto future = pool.enqueue([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+
+    // Workers keep running after a failing task
+    auto next = pool.enqueue([]() { return 1; });
+    EXPECT_EQ(next.get(), 1);
+
+    pool.submit([]() { throw std::runtime_error("ignored"); });
+    pool.waitForAll();
+}
+
+TEST_F(WorkStealingThreadPoolTest, WaitForAllSubmittedTasks) {
+    WorkStealingThreadPool pool(4);
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit([&counter]() { counter++; });
+    }
+    pool.waitForAll();
+    EXPECT_EQ(counter.load(), 1000);
+    EXPECT_EQ(pool.getQueueSize(), 0);
+}
+
+TEST_F(WorkStealingThreadPoolTest, TasksSubmittedFromTasks) {
+    WorkStealingThreadPool pool(3);
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 20; ++i) {
+        pool.submit([&pool, &counter]() {
+            for (int j = 0; j < 10; ++j) {
+                pool.submit([&counter]() { counter++; });
+            }
+        });
+    }
+    pool.waitForAll();
+    EXPECT_EQ(counter.load(), 200);
+}
+
+TEST_F(WorkStealingThreadPoolTest, IdleWorkersStealQueuedTasks) {
+    WorkStealingThreadPool pool(4);
+
+    // Tasks are spread over the worker queues, but the first one blocks
+    // its worker until all others ran, so the tasks queued behind it can
+    // only finish if other workers steal them
+    std::atomic<int> done{0};
+    const int taskCount = 40;
+    pool.submit([&done]() {
+        while (done.load() < taskCount - 1) {
+            std::this_thread::yield();
+        }
+    });
+    for (int i = 1; i < taskCount; ++i) {
+        pool.submit([&done]() { done++; });
+    }
+    pool.waitForAll();
+    EXPECT_EQ(done.load(), taskCount - 1);
+}
+
+TEST_F(WorkStealingThreadPoolTest, ShutdownPreventsNewTasks) {
+    WorkStealingThreadPool pool(2);
+    pool.shutdown();
+    EXPECT_THROW(pool.enqueue([]() { return 1; }), std::runtime_error);
+    EXPECT_THROW(pool.submit([]() {}), std::runtime_error);
+}
+
+TEST_F(WorkStealingThreadPoolTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> counter{0};
+    {
+        WorkStealingThreadPool pool(3);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&counter]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                counter++;
+            });
+        }
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+namespace {
+
+// Busy work standing in for a match, the result keeps it from being optimized out
+uint64_t spin(uint64_t iterations) {
+    uint64_t value = iterations;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return value;
+}
+
+// Match lengths vary wildly: most are short, a few run to the step limit
+std::vector<uint64_t> makeSkewedWorkload(size_t count) {
+    std::mt19937 rng(12345);
+    std::vector<uint64_t> work(count);
+    for (auto& iterations : work) {
+        iterations = rng() % 20 == 0 ? 200000 : 500 + rng() % 5000;
+    }
+    return work;
+}
+
+template<typename Pool>
+double runWorkload(size_t numThreads, const std::vector<uint64_t>& work,
+                   std::atomic<uint64_t>& sink) {
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        Pool pool(numThreads);
+        std::vector<std::future<void>> futures;
+        futures.reserve(work.size());
+        for (uint64_t iterations : work) {
+            futures.push_back(pool.enqueue([iterations, &sink]() {
+                sink += spin(iterations);
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+TEST_F(WorkStealingThreadPoolTest, DISABLED_Benchmark_ComparedToThreadPool) {
+    std::vector<uint64_t> work = makeSkewedWorkload(2000);
+    std::atomic<uint64_t> sink{0};
+
+    for (size_t numThreads : {1, 2, 4, 8, 16, 32, 64}) {
+        double queueTime = runWorkload<ThreadPool>(numThreads, work, sink);
+        double stealingTime = runWorkload<WorkStealingThreadPool>(numThreads, work, sink);
+        const std::string threads = std::to_string(numThreads);
+        RecordProperty("thread_pool_ms_" + threads, std::to_string(queueTime * 1000));
+        RecordProperty("work_stealing_ms_" + threads, std::to_string(stealingTime * 1000));
+    }
+
+    EXPECT_NE(sink.load(), 0u);
+}
+
+TEST_F(WorkStealingThreadPoolTest, DISABLED_Benchmark_SubmitBarrierComparedToFutures) {
+    const int taskCount = 200000;
+    std::atomic<int> counter{0};
+    WorkStealingThreadPool pool(4);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < taskCount; ++i) {
+            futures.push_back(pool.enqueue([&counter]() {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < taskCount; ++i) {
+        pool.submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+    pool.waitForAll();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double futuresTime = std::chrono::duration<double>(middle - start).count();
+    double barrierTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("futures_ms", std::to_string(futuresTime * 1000));
+    RecordProperty("submit_and_wait_ms", std::to_string(barrierTime * 1000));
+
+    EXPECT_EQ(counter.load(), 2 * taskCount);
+}
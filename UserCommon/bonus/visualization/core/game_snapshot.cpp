@@ -26,23 +26,30 @@ GameSnapshot::GameSnapshot(
     const std::vector<Tank>& tanks,
     const std::vector<Shell>& shells,
     int countdown,
-    const std::string& message
+    const std::string& message,
+    const GameSnapshot* previous
 ) : m_stepNumber(step), m_countdown(countdown), m_message(message) {
-    // Copy board state
-    int width = board.getWidth();
-    int height = board.getHeight();
-    m_boardState.resize(height);
-    
-    for (int y = 0; y < height; ++y) {
-        m_boardState[y].resize(width);
-        for (int x = 0; x < width; ++x) {
-            m_boardState[y][x] = board.getCellType(x, y);
+    if (previous && boardMatches(*previous->m_board, board)) {
+        m_board = previous->m_board;
+    } else {
+        // Copy board state
+        auto state = std::make_shared<BoardState>();
+        int width = board.getWidth();
+        int height = board.getHeight();
+        state->cells.resize(height);
+        
+        for (int y = 0; y < height; ++y) {
+            state->cells[y].resize(width);
+            for (int x = 0; x < width; ++x) {
+                state->cells[y][x] = board.getCellType(x, y);
 
-            if (board.getCellType(x, y) == GameBoard::CellType::Wall) {
-              Point pos(x, y);
-              m_wallHealth[pos] = board.getWallHealth(pos);
+                if (board.getCellType(x, y) == GameBoard::CellType::Wall) {
+                  Point pos(x, y);
+                  state->wallHealth[pos] = board.getWallHealth(pos);
+                }
             }
         }
+        m_board = std::move(state);
     }
     
     // Copy tank states
@@ -58,6 +65,35 @@ GameSnapshot::GameSnapshot(
     }
 }
 
+bool GameSnapshot::boardMatches(const BoardState& state, const GameBoard& board) {
+    int width = board.getWidth();
+    int height = board.getHeight();
+    if (static_cast<int>(state.cells.size()) != height) {
+        return false;
+    }
+    size_t walls = 0;
+    for (int y = 0; y < height; ++y) {
+        if (static_cast<int>(state.cells[y].size()) != width) {
+            return false;
+        }
+        for (int x = 0; x < width; ++x) {
+            GameBoard::CellType type = board.getCellType(x, y);
+            if (state.cells[y][x] != type) {
+                return false;
+            }
+            if (type == GameBoard::CellType::Wall) {
+                Point pos(x, y);
+                auto it = state.wallHealth.find(pos);
+                if (it == state.wallHealth.end() || it->second != board.getWallHealth(pos)) {
+                    return false;
+                }
+                walls++;
+            }
+        }
+    }
+    return walls == state.wallHealth.size();
+}
+
 std::string GameSnapshot::toJson() const {
     std::ostringstream json;
     
@@ -71,8 +107,9 @@ std::string GameSnapshot::toJson() const {
     json << "  \"message\": \"" << m_message << "\"," << std::endl;
     
     // Board dimensions
-    int height = m_boardState.size();
-    int width = height > 0 ? m_boardState[0].size() : 0;
+    const auto& cells = m_board->cells;
+    int height = cells.size();
+    int width = height > 0 ? cells[0].size() : 0;
     
     json << "  \"board\": {" << std::endl;
     json << "    \"width\": " << width << "," << std::endl;
@@ -83,7 +120,7 @@ std::string GameSnapshot::toJson() const {
     for (int y = 0; y < height; ++y) {
         json << "      [";
         for (int x = 0; x < width; ++x) {
-            json << static_cast<int>(m_boardState[y][x]);
+            json << static_cast<int>(cells[y][x]);
             if (x < width - 1) {
                 json << ", ";
             }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,11 +40,20 @@ struct ShellState {
     explicit ShellState(const Shell& shell);
 };
 
+/**
+ * @brief Board cells and wall health captured by a snapshot
+ */
+struct BoardState {
+    std::vector<std::vector<GameBoard::CellType>> cells;
+    std::map<Point, int> wallHealth;
+};
+
 /**
  * @brief Complete snapshot of game state at a point in time
  * 
  * This class captures all the necessary state information for visualizing
- * a single step of the game simulation.
+ * a single step of the game simulation. The board is immutable once
+ * captured, so consecutive snapshots of an unchanged board share it.
  */
 class GameSnapshot {
 public:
@@ -57,6 +68,8 @@ public:
      * @param shells The shells in the game
      * @param countdown The countdown timer value (if active, -1 otherwise)
      * @param message Optional message describing this step
+     * @param previous Optional earlier snapshot whose board is reused if
+     *  the board did not change since
      */
     GameSnapshot(
         int step,
@@ -64,13 +77,14 @@ public:
         const std::vector<Tank>& tanks,
         const std::vector<Shell>& shells,
         int countdown = -1,
-        const std::string& message = ""
+        const std::string& message = "",
+        const GameSnapshot* previous = nullptr
     );
     
     // Accessors
     int getStepNumber() const { return m_stepNumber; }
-    const std::vector<std::vector<GameBoard::CellType>>& getBoardState() const { return m_boardState; }
-    const std::map<Point, int>& getWallHealth() const { return m_wallHealth; }
+    const std::vector<std::vector<GameBoard::CellType>>& getBoardState() const { return m_board->cells; }
+    const std::map<Point, int>& getWallHealth() const { return m_board->wallHealth; }
     const std::vector<TankState>& getTanks() const { return m_tanks; }
     const std::vector<ShellState>& getShells() const { return m_shells; }
     int getCountdown() const { return m_countdown; }
@@ -82,11 +96,18 @@ public:
      * @return A JSON representation of the snapshot
      */
     std::string toJson() const;
+
+    /**
+     * @brief Check if this snapshot shares its board with another snapshot
+     */
+    bool sharesBoardWith(const GameSnapshot& other) const { return m_board == other.m_board; }
     
 private:
+    // Checks if the captured board matches the given board
+    static bool boardMatches(const BoardState& state, const GameBoard& board);
+
     int m_stepNumber = 0;
-    std::vector<std::vector<GameBoard::CellType>> m_boardState;
-    std::map<Point, int> m_wallHealth;
+    std::shared_ptr<const BoardState> m_board = std::make_shared<const BoardState>();
     std::vector<TankState> m_tanks;
     std::vector<ShellState> m_shells;
     int m_countdown = -1;
@@ -120,7 +120,7 @@ TEST_F(GameSnapshotTest, TankStateConstructor) {
     EXPECT_EQ(state.position.getX(), 1);
     EXPECT_EQ(state.position.getY(), 1);
     EXPECT_EQ(state.direction, Direction::Down);
-    EXPECT_EQ(state.remainingShells, Tank::INITIAL_SHELLS - 1);
+    EXPECT_EQ(state.remainingShells, Tank::DEFAULT_INITIAL_SHELLS - 1);
     EXPECT_FALSE(state.destroyed);
     
     // Test destroyed state
@@ -144,6 +144,29 @@ TEST_F(GameSnapshotTest, ShellStateConstructor) {
     EXPECT_TRUE(destroyedState.destroyed);
 }
 
+TEST_F(GameSnapshotTest, SharesBoardWithPreviousWhenUnchanged) {
+    GameSnapshot first(1, board, tanks, shells);
+    
+    // Tanks and shells move but the board stays the same
+    tanks[0].setPosition(Point(2, 1));
+    GameSnapshot second(2, board, tanks, shells, -1, "", &first);
+    EXPECT_TRUE(second.sharesBoardWith(first));
+    EXPECT_EQ(second.getTanks()[0].position, Point(2, 1));
+    
+    // A damaged wall needs a new board copy
+    board.damageWall(Point(1, 0));
+    GameSnapshot third(3, board, tanks, shells, -1, "", &second);
+    EXPECT_FALSE(third.sharesBoardWith(second));
+    EXPECT_EQ(third.getWallHealth().at(Point(1, 0)), board.getWallHealth(Point(1, 0)));
+    EXPECT_EQ(second.getWallHealth().at(Point(1, 0)), GameBoard::WALL_STARTING_HEALTH);
+    
+    // So does a changed cell type
+    board.setCellType(2, 3, GameBoard::CellType::Empty);
+    GameSnapshot fourth(4, board, tanks, shells, -1, "", &third);
+    EXPECT_FALSE(fourth.sharesBoardWith(third));
+    EXPECT_EQ(fourth.getBoardState()[3][2], GameBoard::CellType::Empty);
+}
+
 TEST_F(GameSnapshotTest, JsonSerialization) {
     // Create a snapshot
     int countdownValue = 15;
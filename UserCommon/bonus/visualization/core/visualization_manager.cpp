@@ -27,12 +27,16 @@ void VisualizationManager::captureGameState(
     const std::string& message
 ) {
     // Create a snapshot of the current state
-    GameSnapshot snapshot(step, board, tanks, shells, countdown, message);
+    GameSnapshot snapshot(step, board, tanks, shells, countdown, message,
+                          m_hasLastSnapshot ? &m_lastSnapshot : nullptr);
     
     // Process the snapshot in all visualizers
     for (auto& visualizer : m_visualizers) {
         visualizer->processSnapshot(snapshot);
     }
+
+    m_lastSnapshot = std::move(snapshot);
+    m_hasLastSnapshot = true;
 }
 
 bool VisualizationManager::generateOutputs(const std::string& basePath) {
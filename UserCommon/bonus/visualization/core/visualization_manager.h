@@ -42,7 +42,8 @@ public:
      * @brief Process a game state
      * 
      * Creates a snapshot from the current game state and
-     * passes it to all registered visualizers.
+     * passes it to all registered visualizers. The snapshot shares the
+     * board of the previous one when the board did not change.
      * 
      * @param step Current step number
      * @param board Current board state
@@ -100,6 +101,8 @@ public:
 private:
     std::vector<std::unique_ptr<VisualizerBase>> m_visualizers;
     bool m_liveVisualizationEnabled;
+    GameSnapshot m_lastSnapshot;
+    bool m_hasLastSnapshot = false;
 };
 
 } // namespace UserCommon_318835816_211314471
\ No newline at end of file
@@ -170,6 +170,22 @@ TEST_F(VisualizationManagerTest, CaptureGameState) {
     EXPECT_EQ(lastSnapshot.getCountdown(), 30);
 }
 
+TEST_F(VisualizationManagerTest, CaptureGameStateSharesUnchangedBoard) {
+    auto mockVisualizer = new MockVisualizer();
+    manager->addVisualizer(std::unique_ptr<VisualizerBase>(mockVisualizer));
+    
+    manager->captureGameState(1, board, tanks, shells);
+    GameSnapshot first = mockVisualizer->getLastSnapshot();
+    manager->captureGameState(2, board, tanks, shells);
+    GameSnapshot second = mockVisualizer->getLastSnapshot();
+    EXPECT_TRUE(second.sharesBoardWith(first));
+    
+    board.damageWall(Point(0, 0));
+    manager->captureGameState(3, board, tanks, shells);
+    GameSnapshot third = mockVisualizer->getLastSnapshot();
+    EXPECT_FALSE(third.sharesBoardWith(second));
+}
+
 TEST_F(VisualizationManagerTest, CaptureGameStateMultipleVisualizers) {
     // Add two mock visualizers
     auto mockVisualizer1 = new MockVisualizer();
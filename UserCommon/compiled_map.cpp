@@ -0,0 +1,37 @@
+#include <string>
+
+#include "compiled_map.h"
+
+namespace UserCommon_318835816_211314471 {
+
+CompiledMap::CompiledMap(size_t width, size_t height) : m_board(width, height) {}
+
+std::shared_ptr<const CompiledMap> CompiledMap::compile(const SatelliteView& view, size_t width, size_t height) {
+    std::shared_ptr<CompiledMap> map(new CompiledMap(width, height));
+
+    std::vector<std::string> boardLines;
+    boardLines.reserve(height);
+    for (size_t y = 0; y < height; ++y) {
+        std::string row(width, ' ');
+        RowAccessSatelliteView::copyRow(view, y, width, row.data());
+        boardLines.push_back(std::move(row));
+    }
+    if (!boardLines.empty()) {
+        map->m_board.initialize(boardLines, map->m_tankPositions);
+    }
+    return map;
+}
+
+std::shared_ptr<const CompiledMap> CompiledMapSatelliteView::compiledMapOf(
+    const SatelliteView& view, size_t width, size_t height) {
+    const auto* compiled = dynamic_cast<const CompiledMapSatelliteView*>(&view);
+    if (compiled) {
+        std::shared_ptr<const CompiledMap> map = compiled->getCompiledMap();
+        if (map && map->getWidth() == width && map->getHeight() == height) {
+            return map;
+        }
+    }
+    return CompiledMap::compile(view, width, height);
+}
+
+} // namespace UserCommon_318835816_211314471
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "game_board.h"
+#include "row_access_satellite_view.h"
+#include "utils/point.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @class CompiledMap
+ * @brief Immutable, parsed starting state of a map.
+ *
+ * Holds the cell grid and the tank spawns of a map as they are
+ * at the start of a game. A compiled map is never modified, so concurrent
+ * games on the same map share one through a shared_ptr and each copies the
+ * grid into its own GameBoard instead of parsing the map again.
+ */
+class CompiledMap {
+public:
+    /**
+     * @brief Parses a map from any satellite view
+     *
+     * Reads the view a row at a time and parses it as GameBoard::initialize
+     * does.
+     *
+     * @param view The map to parse
+     * @param width The width of the map
+     * @param height The height of the map
+     * @return The compiled map
+     */
+    static std::shared_ptr<const CompiledMap> compile(const SatelliteView& view, size_t width, size_t height);
+
+    /**
+     * @brief Gets the starting board, copy it to play on it
+     */
+    const GameBoard& getBoard() const { return m_board; }
+
+    /**
+     * @brief Gets the tank spawns as (player, position), in row-major order
+     */
+    const std::vector<std::pair<int, Point>>& getTankPositions() const { return m_tankPositions; }
+
+    size_t getWidth() const { return m_board.getWidth(); }
+    size_t getHeight() const { return m_board.getHeight(); }
+
+private:
+    CompiledMap(size_t width, size_t height);
+
+    GameBoard m_board;
+    std::vector<std::pair<int, Point>> m_tankPositions;
+};
+
+/**
+ * @class CompiledMapSatelliteView
+ * @brief Satellite view of a map that can also hand out its compiled map.
+ *
+ * Views that hold a whole map for many games implement this extension so
+ * the map is parsed once. Readers must still accept any SatelliteView, and
+ * compiledMapOf compiles a new map for views that do not derive from this
+ * class.
+ */
+class CompiledMapSatelliteView : public RowAccessSatelliteView {
+public:
+    /**
+     * @brief Gets the compiled map of this view
+     *
+     * May be called from several threads at once.
+     */
+    virtual std::shared_ptr<const CompiledMap> getCompiledMap() const = 0;
+
+    /**
+     * @brief Gets the compiled map of any satellite view
+     *
+     * @param view The map to read
+     * @param width The width of the map
+     * @param height The height of the map
+     * @return The map compiled by the view when it has one of this size,
+     *  otherwise a map compiled from the view
+     */
+    static std::shared_ptr<const CompiledMap> compiledMapOf(const SatelliteView& view, size_t width, size_t height);
+};
+
+} // namespace UserCommon_318835816_211314471
@@ -0,0 +1,172 @@
+#include "gtest/gtest.h"
+#include "compiled_map.h"
+#include "satellite_view_impl.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace UserCommon_318835816_211314471;
+
+namespace {
+
+// A map view that compiles itself once, as the simulator's map views do
+class CompiledRowsView : public CompiledMapSatelliteView {
+public:
+    CompiledRowsView(std::vector<std::string> rows) : m_rows(std::move(rows)) {
+        m_compiled = CompiledMap::compile(*this, getWidth(), getHeight());
+    }
+
+    char getObjectAt(size_t x, size_t y) const override {
+        if (y >= m_rows.size() || x >= m_rows[y].size()) {
+            return '&';
+        }
+        return m_rows[y][x];
+    }
+    size_t getWidth() const override { return m_rows[0].size(); }
+    size_t getHeight() const override { return m_rows.size(); }
+    const char* getRow(size_t y) const override { return y < m_rows.size() ? m_rows[y].data() : nullptr; }
+    std::shared_ptr<const CompiledMap> getCompiledMap() const override { return m_compiled; }
+
+private:
+    std::vector<std::string> m_rows;
+    std::shared_ptr<const CompiledMap> m_compiled;
+};
+
+// A view that only implements the base interface
+class CellOnlyView : public SatelliteView {
+public:
+    CellOnlyView(std::vector<std::string> rows) : m_rows(std::move(rows)) {}
+
+    char getObjectAt(size_t x, size_t y) const override {
+        if (y >= m_rows.size() || x >= m_rows[y].size()) {
+            return '&';
+        }
+        return m_rows[y][x];
+    }
+
+private:
+    std::vector<std::string> m_rows;
+};
+
+} // namespace
+
+TEST(CompiledMapTest, CompileMatchesInitialize) {
+    std::vector<std::string> rows = {"#1 @", " #2 ", "3  #"};
+    CellOnlyView view(rows);
+    auto map = CompiledMap::compile(view, 4, 3);
+
+    GameBoard board(4, 3);
+    std::vector<std::pair<int, Point>> tankPositions;
+    ASSERT_TRUE(board.initialize(rows, tankPositions));
+
+    EXPECT_EQ(map->getWidth(), 4u);
+    EXPECT_EQ(map->getHeight(), 3u);
+    EXPECT_EQ(map->getTankPositions(), tankPositions);
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            EXPECT_EQ(map->getBoard().getCellType(x, y), board.getCellType(x, y));
+        }
+    }
+}
+
+TEST(CompiledMapTest, CompileReadsEveryRow) {
+    CellOnlyView view({"# 1", " @ ", "2  "});
+    auto map = CompiledMap::compile(view, 3, 3);
+
+    ASSERT_EQ(map->getHeight(), 3u);
+    EXPECT_EQ(map->getBoard().getCellType(0, 0), GameBoard::CellType::Wall);
+    EXPECT_EQ(map->getBoard().getCellType(1, 1), GameBoard::CellType::Mine);
+    EXPECT_EQ(map->getBoard().getCellType(1, 2), GameBoard::CellType::Empty);
+    EXPECT_EQ(map->getTankPositions(),
+              (std::vector<std::pair<int, Point>>{{1, Point(2, 0)}, {2, Point(0, 2)}}));
+}
+
+TEST(CompiledMapTest, CompileEmptyBoard) {
+    CellOnlyView view({"  ", "  "});
+    auto map = CompiledMap::compile(view, 2, 2);
+
+    EXPECT_TRUE(map->getTankPositions().empty());
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 2; ++x) {
+            EXPECT_EQ(map->getBoard().getCellType(x, y), GameBoard::CellType::Empty);
+        }
+    }
+}
+
+TEST(CompiledMapTest, CompileSingleCell) {
+    CellOnlyView view({"#"});
+    auto map = CompiledMap::compile(view, 1, 1);
+
+    EXPECT_EQ(map->getWidth(), 1u);
+    EXPECT_EQ(map->getHeight(), 1u);
+    EXPECT_EQ(map->getBoard().getCellType(0, 0), GameBoard::CellType::Wall);
+}
+
+TEST(CompiledMapTest, CompileZeroDimensions) {
+    CellOnlyView view({});
+    auto map = CompiledMap::compile(view, 0, 0);
+
+    EXPECT_EQ(map->getWidth(), 0u);
+    EXPECT_EQ(map->getHeight(), 0u);
+    EXPECT_TRUE(map->getTankPositions().empty());
+}
+
+TEST(CompiledMapTest, CompiledMapOfSharesTheViewsMap) {
+    CompiledRowsView view({"1 #", "# 2"});
+    auto first = CompiledMapSatelliteView::compiledMapOf(view, 3, 2);
+    auto second = CompiledMapSatelliteView::compiledMapOf(view, 3, 2);
+    EXPECT_EQ(first, view.getCompiledMap());
+    EXPECT_EQ(first, second);
+
+    // A different size is compiled from the view itself
+    auto wider = CompiledMapSatelliteView::compiledMapOf(view, 4, 2);
+    EXPECT_NE(wider, first);
+    EXPECT_EQ(wider->getWidth(), 4u);
+    EXPECT_EQ(wider->getTankPositions().size(), 2u);
+}
+
+TEST(CompiledMapTest, CompiledMapOfCompilesPlainViews) {
+    CellOnlyView view({"1 ", " 2"});
+    auto first = CompiledMapSatelliteView::compiledMapOf(view, 2, 2);
+    auto second = CompiledMapSatelliteView::compiledMapOf(view, 2, 2);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(first->getTankPositions(), second->getTankPositions());
+}
+
+TEST(CompiledMapTest, DISABLED_Benchmark_StartManyGames) {
+    const size_t size = 500;
+    const int games = 20;
+    std::vector<std::string> rows(size, std::string(size, ' '));
+    for (size_t i = 0; i < size; ++i) {
+        rows[i][(i * 7) % size] = '#';
+    }
+    rows[0][1] = '1';
+    rows[size - 1][size - 2] = '2';
+    CompiledRowsView view(rows);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < games; ++i) {
+        std::vector<std::string> lines;
+        for (size_t y = 0; y < size; ++y) {
+            std::string row(size, ' ');
+            RowAccessSatelliteView::copyRow(view, y, size, row.data());
+            lines.push_back(std::move(row));
+        }
+        GameBoard board(size, size);
+        std::vector<std::pair<int, Point>> tankPositions;
+        ASSERT_TRUE(board.initialize(lines, tankPositions));
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < games; ++i) {
+        auto map = CompiledMapSatelliteView::compiledMapOf(view, size, size);
+        GameBoard board = map->getBoard();
+        ASSERT_EQ(map->getTankPositions().size(), 2u);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double parseTime = std::chrono::duration<double>(middle - start).count();
+    double copyTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("parse_ms", std::to_string(parseTime * 1000));
+    RecordProperty("compiled_map_copy_ms", std::to_string(copyTime * 1000));
+
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -7,25 +8,18 @@ namespace UserCommon_318835816_211314471 {
 
 GameBoard::GameBoard() : m_width(0), m_height(0) {}
 
-GameBoard::GameBoard(size_t width, size_t height) : m_width(width), m_height(height) {
-    m_board.resize(height);
-    for (size_t y = 0; y < height; ++y) {
-        m_board[y].resize(width, CellType::Empty);
-    }
-}
+GameBoard::GameBoard(size_t width, size_t height)
+    : m_cells(width * height, static_cast<uint8_t>(CellType::Empty)),
+      m_width(width), m_height(height) {}
 
 bool GameBoard::initialize(const std::vector<std::string>& boardLines, 
   std::vector<std::pair<int, Point>>& tankPositions) {
   if (boardLines.empty()) {
       return false;
   }
-  m_wallHealth.clear();
-  
-  for (size_t y = 0; y < m_height; ++y) {
-      for (size_t x = 0; x < m_width; ++x) {
-          setCellType(x, y, CellType::Empty);
-      }
-  }
+  std::fill(m_cells.begin(), m_cells.end(),
+            static_cast<uint8_t>(CellType::Empty));
+  m_revision++;
   
   for (size_t y = 0; y < m_height; ++y) {
       if (y >= boardLines.size()) {
@@ -45,7 +39,6 @@ bool GameBoard::initialize(const std::vector<std::string>& boardLines,
           switch (currentChar) {
               case '#':
                   cellType = CellType::Wall;
-                  m_wallHealth[Point(x, y)] = WALL_STARTING_HEALTH;
                   break;
               case '1':
                   tankPositions.push_back({1, Point(x, y)});
@@ -103,25 +96,22 @@ bool GameBoard::initialize(const std::vector<std::string>& boardLines,
   return true;
 }
 
-GameBoard::CellType GameBoard::getCellType(int x, int y) const {
-    Point wrapped = wrapPosition(Point(x, y));
-
-    return m_board[wrapped.getY()][wrapped.getX()];
-}
-
-GameBoard::CellType GameBoard::getCellType(const Point& position) const {
-    return getCellType(position.getX(), position.getY());
-}
-
 void GameBoard::setCellType(int x, int y, CellType type) {
-    Point wrapped = wrapPosition(Point(x, y));
+    uint8_t& cell = m_cells[cellIndex(x, y)];
     
-    if (type == CellType::Wall && 
-          m_board[wrapped.getY()][wrapped.getX()] != CellType::Wall) {
-      m_wallHealth[wrapped] = WALL_STARTING_HEALTH;
+    if (type == CellType::Wall) {
+      // An existing wall keeps its current health
+      if (typeOf(cell) != CellType::Wall) {
+        cell = makeWall(WALL_STARTING_HEALTH);
+        m_revision++;
+      }
+      return;
     }
     
-    m_board[wrapped.getY()][wrapped.getX()] = type;
+    if (cell != static_cast<uint8_t>(type)) {
+      cell = static_cast<uint8_t>(type);
+      m_revision++;
+    }
 }
 
 void GameBoard::setCellType(const Point& position, CellType type) {
@@ -145,48 +135,56 @@ bool GameBoard::isMine(const Point& position) const {
 }
 
 bool GameBoard::damageWall(const Point& position) {
-    Point wrapped = wrapPosition(position);
+    uint8_t& cell = m_cells[cellIndex(position.getX(), position.getY())];
     
-    if (!isWall(wrapped)) {
+    if (typeOf(cell) != CellType::Wall) {
         return false;
     }
     
-    int& health = m_wallHealth[wrapped];
-    health--;
+    int health = (cell >> WALL_HEALTH_SHIFT) - 1;
+    m_revision++;
     
     if (health <= 0) {
-        setCellType(wrapped, CellType::Empty);
-        m_wallHealth.erase(wrapped);
+        cell = static_cast<uint8_t>(CellType::Empty);
         return true; // Wall destroyed
     }
     
+    cell = makeWall(health);
     return false; // Wall was damaged but not destroyed
 }
 
 int GameBoard::getWallHealth(const Point& position) const {
-    Point wrapped = wrapPosition(position);
+    uint8_t cell = m_cells[cellIndex(position.getX(), position.getY())];
     
-    auto it = m_wallHealth.find(wrapped);
-    if (it != m_wallHealth.end()) {
-        return it->second;
+    if (typeOf(cell) != CellType::Wall) {
+        return 0;
     }
     
-    return 0;
+    return cell >> WALL_HEALTH_SHIFT;
 }
 
-Point GameBoard::wrapPosition(const Point& position) const {
-    if (m_width == 0 || m_height == 0) {
-        return Point(-1, -1);
+void GameBoard::setWallHealth(const Point& position, int health) {
+    uint8_t& cell = m_cells[cellIndex(position.getX(), position.getY())];
+    
+    if (typeOf(cell) != CellType::Wall) {
+        return;
+    }
+    
+    uint8_t updated = health <= 0
+        ? static_cast<uint8_t>(CellType::Empty)
+        : makeWall(std::min(health, WALL_STARTING_HEALTH));
+    if (cell != updated) {
+        cell = updated;
+        m_revision++;
     }
-    int wrappedX = ((position.getX() + m_width) % m_width);
-    int wrappedY = ((position.getY() + m_height) % m_height);
-    return Point(wrappedX, wrappedY);
+}
+
+uint64_t GameBoard::getRevision() const {
+    return m_revision;
 }
 
 bool GameBoard::canMoveTo(const Point& position) const {
-  Point wrapped = wrapPosition(position);
-  
-  return m_board[wrapped.getY()][wrapped.getX()] != CellType::Wall;
+  return getCellType(position) != CellType::Wall;
 }
 
 std::string GameBoard::toString() const {
@@ -194,7 +192,7 @@ std::string GameBoard::toString() const {
     
     for (size_t y = 0; y < m_height; ++y) {
         for (size_t x = 0; x < m_width; ++x) {
-            CellType cell = m_board[y][x];
+            CellType cell = typeOf(m_cells[y * m_width + x]);
             
             switch (cell) {
                 case CellType::Empty:
@@ -1,10 +1,12 @@
 #pragma once
 
-#include <map>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "utils/direction.h"
 #include "utils/point.h"
+#include "utils/torus_ray.h"
 
 namespace UserCommon_318835816_211314471 {
 
@@ -35,7 +37,7 @@ public:
     /**
      * @brief Types of cells that can exist on the game board
      */
-    enum class CellType {
+    enum class CellType : uint8_t {
         Empty,
         Wall,
         Mine
@@ -77,10 +79,13 @@ public:
     bool isMine(const Point& position) const;
 
     /**
-     * @brief Checks if the cell at the specified position is a mine
+     * @brief Damages the wall at the specified position
      * 
-     * @param position The position to check
-     * @return true if the cell is a mine, false otherwise
+     * Reduces the wall health by one and clears the cell once the
+     * health reaches zero.
+     * 
+     * @param position The position of the wall
+     * @return true if the wall was destroyed, false otherwise
      */
     bool damageWall(const Point& position);
 
@@ -91,18 +96,59 @@ public:
      * @return The remaining health of the wall, or 0 if there is no wall
      */
     int getWallHealth(const Point& position) const;
+
+    /**
+     * @brief Sets the health of a wall at the specified position
+     * 
+     * Has no effect if there is no wall at the position. A health of zero
+     * or less removes the wall.
+     * 
+     * @param position The position of the wall
+     * @param health The new health, at most WALL_STARTING_HEALTH
+     */
+    void setWallHealth(const Point& position, int health);
+
+    /**
+     * @brief Gets the revision of the board cells
+     * 
+     * The revision changes whenever a cell or a wall health changes, so
+     * callers can cheaply detect that a board did not change since they
+     * last looked at it (or at a copy of it).
+     * 
+     * @return The current revision
+     */
+    uint64_t getRevision() const;
     
     /**
      * @brief Wraps a position to ensure it falls within the board boundaries
      * 
      * Handles positions that are outside the board by wrapping them around,
      * where moving off one edge brings you to the opposite edge.
-     * Only support positions that can be reached in the game flow.
+     * Positions one step off the board take the fast path of wrapAxis.
      * 
      * @param position Position to wrap
      * @return Position wrapped to be within board boundaries
      */
-    Point wrapPosition(const Point& position) const;
+    Point wrapPosition(const Point& position) const {
+        if (m_width == 0 || m_height == 0) {
+            return Point(-1, -1);
+        }
+        return Point(wrapAxis(position.getX(), static_cast<int>(m_width)),
+                     wrapAxis(position.getY(), static_cast<int>(m_height)));
+    }
+
+    /**
+     * @brief Starts a ray walking the board from a position
+     * 
+     * @pre The board is not empty and start is on the board
+     * 
+     * @param start The first cell of the ray
+     * @param direction The direction to walk in
+     * @return A ray whose ++ steps to the next wrapped cell
+     */
+    TorusRay rayFrom(const Point& start, Direction direction) const {
+        return TorusRay(start, direction, static_cast<int>(m_width), static_cast<int>(m_height));
+    }
 
     /**
      * @brief Checks if a tank can move to the specified position
@@ -134,7 +180,9 @@ public:
      * @param y The y-coordinate
      * @return The type of cell at the specified position
      */
-    CellType getCellType(int x, int y) const;
+    CellType getCellType(int x, int y) const {
+        return typeOf(m_cells[cellIndex(x, y)]);
+    }
 
     /**
      * @brief Gets the type of cell at the specified position
@@ -144,7 +192,36 @@ public:
      * @param position The position to check
      * @return The type of cell at the specified position
      */
-    CellType getCellType(const Point& position) const;
+    CellType getCellType(const Point& position) const {
+        return getCellType(position.getX(), position.getY());
+    }
+
+    /**
+     * @brief Gets the type of cell at coordinates already on the board
+     * 
+     * Skips wrapping, for loops that only visit cells on the board.
+     * 
+     * @pre 0 <= x < width and 0 <= y < height
+     * 
+     * @param x The x-coordinate
+     * @param y The y-coordinate
+     * @return The type of cell at the specified position
+     */
+    CellType getCellTypeUnchecked(int x, int y) const {
+        return typeOf(m_cells[static_cast<size_t>(y) * m_width + static_cast<size_t>(x)]);
+    }
+
+    /**
+     * @brief Gets the type of cell at a position already on the board
+     * 
+     * @pre The position is on the board
+     * 
+     * @param position The position to check
+     * @return The type of cell at the specified position
+     */
+    CellType getCellTypeUnchecked(const Point& position) const {
+        return getCellTypeUnchecked(position.getX(), position.getY());
+    }
 
     /**
      * @brief Sets the type of cell at the specified coordinates
@@ -195,10 +272,40 @@ public:
      */
     static int stepDistance(const Point& a, const Point& b, size_t width, size_t height);
 private:
-    std::vector<std::vector<CellType>> m_board;
-    std::map<Point, int> m_wallHealth;
+    // Each cell is one byte: the CellType in the low bits and, for walls,
+    // the remaining health in the high bits
+    static constexpr uint8_t CELL_TYPE_MASK = 0x03;
+    static constexpr int WALL_HEALTH_SHIFT = 2;
+    static_assert(WALL_STARTING_HEALTH < (1 << (8 - WALL_HEALTH_SHIFT)),
+                  "Wall health must fit in the cell byte");
+
+    /**
+     * @brief Gets the index in the row-major cell buffer of a position
+     * 
+     * Coordinates are wrapped to board dimensions.
+     */
+    size_t cellIndex(int x, int y) const {
+        // Most lookups are already on the board
+        if (static_cast<size_t>(x) < m_width && static_cast<size_t>(y) < m_height) {
+            return static_cast<size_t>(y) * m_width + static_cast<size_t>(x);
+        }
+        return static_cast<size_t>(wrapAxis(y, static_cast<int>(m_height))) * m_width +
+               static_cast<size_t>(wrapAxis(x, static_cast<int>(m_width)));
+    }
+
+    static CellType typeOf(uint8_t cell) {
+        return static_cast<CellType>(cell & CELL_TYPE_MASK);
+    }
+
+    static uint8_t makeWall(int health) {
+        return static_cast<uint8_t>((health << WALL_HEALTH_SHIFT) |
+                                    static_cast<uint8_t>(CellType::Wall));
+    }
+
+    std::vector<uint8_t> m_cells;
     size_t m_width;
     size_t m_height;
+    uint64_t m_revision = 0;
 };
 
 } // namespace UserCommon_318835816_211314471
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 #include "game_board.h"
+#include <chrono>
+#include <iostream>
 #include <vector>
 #include <string>
 #include <map>
@@ -414,6 +416,47 @@ TEST_F(GameBoardTest, GetWallHealth_WallAndNonWall) {
     EXPECT_EQ(board.getWallHealth(Point(1, 1)), 1);
 }
 
+// SetWallHealth Tests
+TEST_F(GameBoardTest, SetWallHealth_WallAndNonWall) {
+    board.setCellType(1, 1, GameBoard::CellType::Wall);
+    
+    board.setWallHealth(Point(1, 1), 1);
+    EXPECT_EQ(board.getWallHealth(Point(1, 1)), 1);
+    EXPECT_TRUE(board.isWall(Point(1, 1)));
+    
+    // Zero health removes the wall
+    board.setWallHealth(Point(1, 1), 0);
+    EXPECT_FALSE(board.isWall(Point(1, 1)));
+    
+    // No effect on a non-wall
+    board.setWallHealth(Point(2, 2), 1);
+    EXPECT_EQ(board.getCellType(Point(2, 2)), GameBoard::CellType::Empty);
+    EXPECT_EQ(board.getWallHealth(Point(2, 2)), 0);
+}
+
+// GetRevision Tests
+TEST_F(GameBoardTest, GetRevision_ChangesOnlyWhenCellsChange) {
+    uint64_t revision = board.getRevision();
+    
+    board.setCellType(1, 1, GameBoard::CellType::Wall);
+    EXPECT_NE(board.getRevision(), revision);
+    revision = board.getRevision();
+    
+    // Setting the same content again is not a change
+    board.setCellType(1, 1, GameBoard::CellType::Wall);
+    board.setCellType(2, 2, GameBoard::CellType::Empty);
+    EXPECT_FALSE(board.damageWall(Point(3, 3)));
+    EXPECT_EQ(board.getRevision(), revision);
+    
+    board.damageWall(Point(1, 1));
+    EXPECT_NE(board.getRevision(), revision);
+    revision = board.getRevision();
+    
+    // Copies carry the revision of their source
+    GameBoard copy = board;
+    EXPECT_EQ(copy.getRevision(), revision);
+}
+
 // WrapPosition Tests
 TEST_F(GameBoardTest, WrapPosition_InsideBounds) {
     Point original(2, 3);
@@ -527,6 +570,39 @@ TEST_F(GameBoardTest, ToString_PopulatedBoard) {
     EXPECT_EQ(board.toString(), expected);
 }
 
+TEST_F(GameBoardTest, WrapPosition_FarOutside) {
+    // Off by more than one board length still wraps correctly
+    EXPECT_EQ(board.wrapPosition(Point(12, -9)), Point(2, 1));
+}
+
+TEST_F(GameBoardTest, GetCellTypeUnchecked_MatchesGetCellType) {
+    std::vector<std::string> boardLines = {
+        "#####",
+        "#1 2#",
+        "# @ #"
+    };
+    std::vector<std::pair<int, Point>> tankPositions;
+    createBoardWithContent(boardLines, tankPositions);
+    for (int y = 0; y < static_cast<int>(board.getHeight()); ++y) {
+        for (int x = 0; x < static_cast<int>(board.getWidth()); ++x) {
+            EXPECT_EQ(board.getCellTypeUnchecked(x, y), board.getCellType(x, y));
+        }
+    }
+    EXPECT_EQ(board.getCellTypeUnchecked(Point(2, 2)), GameBoard::CellType::Mine);
+}
+
+TEST_F(GameBoardTest, RayFrom_MatchesWrapPosition) {
+    board = GameBoard(7, 4);
+    for (const Direction& dir : ALL_DIRECTIONS) {
+        TorusRay ray = board.rayFrom(Point(6, 0), dir);
+        Point expected(6, 0);
+        for (int step = 0; step < 20; ++step) {
+            expected = board.wrapPosition(expected + getDirectionDelta(dir));
+            EXPECT_EQ(*++ray, expected);
+        }
+    }
+}
+
 TEST_F(GameBoardTest, ZeroDimensionBoard_DoesNotCrash) {
     GameBoard zeroBoard(0, 0);
     // Should not crash or throw
@@ -583,3 +659,146 @@ TEST_F(GameBoardTest, StepDistance_EdgeCases) {
     EXPECT_EQ(GameBoard::stepDistance(Point(1, 1), Point(0, 1), board.getWidth(), board.getHeight()), 1);
 }
 
+// Performance
+
+TEST_F(GameBoardTest, DISABLED_Benchmark_CellAccessThroughput) {
+    const int width = 500;
+    const int height = 500;
+    const int passes = 20;
+    board = GameBoard(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if ((x + y) % 3 == 0) {
+                board.setCellType(x, y, GameBoard::CellType::Wall);
+            } else if ((x * y) % 11 == 1) {
+                board.setCellType(x, y, GameBoard::CellType::Mine);
+            }
+        }
+    }
+    const double cellOps = static_cast<double>(width) * height * passes;
+
+    // getCellType, including wrapped coordinates on the border
+    long mines = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int y = -1; y < height - 1; ++y) {
+            for (int x = -1; x < width - 1; ++x) {
+                mines += board.getCellType(x, y) == GameBoard::CellType::Mine;
+            }
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    RecordProperty("getCellType_ops_per_s", static_cast<int>(cellOps / elapsed.count()));
+    EXPECT_GT(mines, 0);
+
+    // isWall
+    long walls = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                walls += board.isWall(Point(x, y));
+            }
+        }
+    }
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    RecordProperty("isWall_ops_per_s", static_cast<int>(cellOps / elapsed.count()));
+    EXPECT_EQ(walls % passes, 0);
+
+    // damageWall, walls are restored after each destroy pass
+    long destroyed = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                destroyed += board.damageWall(Point(x, y));
+            }
+        }
+        if (pass % GameBoard::WALL_STARTING_HEALTH == GameBoard::WALL_STARTING_HEALTH - 1) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    if ((x + y) % 3 == 0) {
+                        board.setCellType(x, y, GameBoard::CellType::Wall);
+                    }
+                }
+            }
+        }
+    }
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    RecordProperty("damageWall_ops_per_s", static_cast<int>(cellOps / elapsed.count()));
+    EXPECT_EQ(destroyed, walls / GameBoard::WALL_STARTING_HEALTH);
+}
+
+TEST_F(GameBoardTest, DISABLED_Benchmark_WrapFastPath) {
+    const int width = 300;
+    const int height = 200;
+    const int steps = 2000;
+    board = GameBoard(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if ((x * 7 + y * 13) % 97 == 0) {
+                board.setCellType(x, y, GameBoard::CellType::Wall);
+            }
+        }
+    }
+    // Modulo wrapping as every wrap was done before the fast path
+    auto moduloWrap = [&](const Point& p) {
+        return Point((p.getX() + width) % width, (p.getY() + height) % height);
+    };
+
+    // Shell moves as in the game manager's moveShellsOnce
+    std::vector<std::pair<Point, Direction>> shells;
+    for (int i = 0; i < 500; ++i) {
+        shells.emplace_back(Point((i * 37) % width, (i * 53) % height), ALL_DIRECTIONS[i % 8]);
+    }
+    std::vector<std::pair<Point, Direction>> moduloShells = shells;
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        for (auto& shell : moduloShells) {
+            shell.first = moduloWrap(shell.first + getDirectionDelta(shell.second));
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        for (auto& shell : shells) {
+            shell.first = board.wrapPosition(shell.first + getDirectionDelta(shell.second));
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double moduloMoves = std::chrono::duration<double>(middle - start).count();
+    double fastMoves = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("shell_moves_modulo_ms", std::to_string(moduloMoves * 1000));
+    RecordProperty("shell_moves_fast_ms", std::to_string(fastMoves * 1000));
+    EXPECT_EQ(shells, moduloShells);
+
+    // Line of sight walks, stopping at the first wall
+    const int rays = 20000;
+    const int maxSteps = width + height;
+    long moduloCells = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rays; ++i) {
+        const Direction dir = ALL_DIRECTIONS[i % 8];
+        Point current((i * 31) % width, (i * 17) % height);
+        for (int step = 0; step < maxSteps; ++step) {
+            current = moduloWrap(current + getDirectionDelta(dir));
+            moduloCells++;
+            if (board.isWall(current)) break;
+        }
+    }
+    middle = std::chrono::steady_clock::now();
+    long rayCells = 0;
+    for (int i = 0; i < rays; ++i) {
+        TorusRay ray = board.rayFrom(Point((i * 31) % width, (i * 17) % height), ALL_DIRECTIONS[i % 8]);
+        for (int step = 0; step < maxSteps; ++step) {
+            ++ray;
+            rayCells++;
+            if (board.getCellTypeUnchecked(ray.getX(), ray.getY()) == GameBoard::CellType::Wall) break;
+        }
+    }
+    end = std::chrono::steady_clock::now();
+    double moduloRays = std::chrono::duration<double>(middle - start).count();
+    double fastRays = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("rays_modulo_ms", std::to_string(moduloRays * 1000));
+    RecordProperty("rays_torus_ms", std::to_string(fastRays * 1000));
+    EXPECT_EQ(rayCells, moduloCells);
+}
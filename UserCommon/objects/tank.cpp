@@ -3,14 +3,9 @@
 
 namespace UserCommon_318835816_211314471 {
 
-int Tank::INITIAL_SHELLS = 16;
-void Tank::setInitialShells(int shells) {
-    INITIAL_SHELLS = shells;
-}
-
-Tank::Tank(int playerId, const Point& position, Direction direction)
+Tank::Tank(int playerId, const Point& position, Direction direction, int initialShells)
     : GameObject(playerId, position, direction),
-      m_remainingShells(INITIAL_SHELLS),
+      m_remainingShells(initialShells),
       m_shootCooldown(0),
       m_backwardCounter(0),
       m_continuousBackward(false) {
@@ -13,9 +13,8 @@ namespace UserCommon_318835816_211314471 {
  */
 class Tank : public GameObject {
 public:
-    /** Maximum number of shells available at the start of the game */
-    static int INITIAL_SHELLS;
-    static void setInitialShells(int shells);
+    /** Number of shells a tank starts with when the game does not set one */
+    static constexpr int DEFAULT_INITIAL_SHELLS = 16;
 
     /** Number of game steps a tank must wait between consecutive shots */
     static constexpr int SHOOT_COOLDOWN = 4;
@@ -29,8 +28,11 @@ public:
      * @param playerId The ID of the player owning this tank
      * @param position The initial position of the tank
      * @param direction The initial direction of the tank
+     * @param initialShells The number of shells the tank starts with, the
+     *  NumShells of the game
      */
-    Tank(int playerId, const Point& position, Direction direction);
+    Tank(int playerId, const Point& position, Direction direction,
+         int initialShells = DEFAULT_INITIAL_SHELLS);
 
 
     /**
@@ -29,7 +29,7 @@ TEST_F(TankTest, Constructor_InitializesCorrectly) {
     EXPECT_EQ(tank->getPlayerId(), playerId);
     EXPECT_EQ(tank->getPosition(), position);
     EXPECT_EQ(tank->getDirection(), direction);
-    EXPECT_EQ(tank->getRemainingShells(), Tank::INITIAL_SHELLS);
+    EXPECT_EQ(tank->getRemainingShells(), Tank::DEFAULT_INITIAL_SHELLS);
     EXPECT_FALSE(tank->isDestroyed());
     EXPECT_FALSE(tank->isMovingBackward());
     EXPECT_FALSE(tank->isContinuousBackward());
@@ -57,7 +57,7 @@ TEST_F(TankTest, DecrementShells_ReducesShellCount) {
 
 TEST_F(TankTest, DecrementShells_StopsAtZero) {
   // Empty all shells
-  for (int i = 0; i < Tank::INITIAL_SHELLS; i++) {
+  for (int i = 0; i < Tank::DEFAULT_INITIAL_SHELLS; i++) {
       tank->decrementShells();
   }
   EXPECT_EQ(tank->getRemainingShells(), 0);
@@ -156,7 +156,7 @@ TEST_F(TankTest, CanShoot_FalseWhenDestroyed) {
 
 TEST_F(TankTest, CanShoot_FalseWhenNoShells) {
   // Use all shells
-  for (int i = 0; i < Tank::INITIAL_SHELLS; i++) {
+  for (int i = 0; i < Tank::DEFAULT_INITIAL_SHELLS; i++) {
       tank->decrementShells();
   }
   EXPECT_FALSE(tank->canShoot());
@@ -193,7 +193,7 @@ TEST_F(TankTest, UpdateCooldowns_DecrementsCooldown) {
 
 TEST_F(TankTest, Shoot_FailsWhenNoShells) {
   // Use all shells
-  for (int i = 0; i < Tank::INITIAL_SHELLS; i++) {
+  for (int i = 0; i < Tank::DEFAULT_INITIAL_SHELLS; i++) {
       tank->decrementShells();
   }
   
@@ -454,9 +454,12 @@ TEST_F(TankTest, DoNothing_ProcessesBackwardMovement) {
   EXPECT_TRUE(tank->isContinuousBackward());
 }
 
-TEST_F(TankTest, SetInitialShellsAffectsNewTanks) {
-    // Set a custom initial shell count
-    Tank::setInitialShells(42);
-    Tank tank(1, Point(0, 0), Direction::Right);
+TEST_F(TankTest, InitialShellsArePerTank) {
+    // Each game passes its own shell count, tanks of other games keep theirs
+    Tank tank(1, Point(0, 0), Direction::Right, 42);
+    Tank other(2, Point(1, 0), Direction::Left, 3);
+    Tank defaulted(1, Point(2, 0), Direction::Right);
     EXPECT_EQ(tank.getRemainingShells(), 42);
+    EXPECT_EQ(other.getRemainingShells(), 3);
+    EXPECT_EQ(defaulted.getRemainingShells(), Tank::DEFAULT_INITIAL_SHELLS);
 }
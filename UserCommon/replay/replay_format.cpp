@@ -0,0 +1,93 @@
+#include "replay_format.h"
+
+namespace UserCommon_318835816_211314471 {
+
+namespace ReplayFormat {
+
+namespace {
+// Longest LEB128 encoding of a 64-bit value
+constexpr int MAX_VARINT_BYTES = 10;
+}
+
+void writeVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void writeSignedVarint(std::vector<uint8_t>& out, int64_t value) {
+    uint64_t zigzag = (static_cast<uint64_t>(value) << 1) ^
+                      static_cast<uint64_t>(value >> 63);
+    writeVarint(out, zigzag);
+}
+
+void writeString(std::vector<uint8_t>& out, const std::string& value) {
+    writeVarint(out, value.size());
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+Cursor::Cursor(const std::vector<uint8_t>& data, size_t offset)
+    : m_data(data), m_offset(offset) {}
+
+bool Cursor::readByte(uint8_t& value) {
+    if (m_offset >= m_data.size()) {
+        return false;
+    }
+    value = m_data[m_offset++];
+    return true;
+}
+
+bool Cursor::readVarint(uint64_t& value) {
+    value = 0;
+    for (int i = 0; i < MAX_VARINT_BYTES; ++i) {
+        uint8_t byte;
+        if (!readByte(byte)) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Cursor::readSignedVarint(int64_t& value) {
+    uint64_t zigzag;
+    if (!readVarint(zigzag)) {
+        return false;
+    }
+    value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    return true;
+}
+
+bool Cursor::readString(std::string& value) {
+    uint64_t length;
+    if (!readVarint(length) || length > m_data.size() - m_offset) {
+        return false;
+    }
+    value.assign(m_data.begin() + m_offset, m_data.begin() + m_offset + length);
+    m_offset += length;
+    return true;
+}
+
+int wrapCoordinate(int64_t value, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    int64_t dimension = static_cast<int64_t>(size);
+    int64_t wrapped = value % dimension;
+    return static_cast<int>(wrapped < 0 ? wrapped + dimension : wrapped);
+}
+
+int wrappedDelta(int from, int to, size_t size) {
+    int dimension = static_cast<int>(size);
+    int delta = wrapCoordinate(static_cast<int64_t>(to) - from, size);
+    return delta > dimension / 2 ? delta - dimension : delta;
+}
+
+} // namespace ReplayFormat
+
+} // namespace UserCommon_318835816_211314471
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/ActionRequest.h"
+#include "common/GameResult.h"
+#include "utils/direction.h"
+#include "utils/point.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @brief Game parameters stored at the start of a replay
+ */
+struct ReplayHeader {
+    size_t width = 0;
+    size_t height = 0;
+    size_t maxSteps = 0;
+    size_t numShells = 0;
+    std::string mapName;
+    std::string player1Name;
+    std::string player2Name;
+};
+
+/**
+ * @brief Action of a single tank in a single step
+ *
+ * The writer only reads action and success, killed and dead are
+ * derived from the tank states.
+ */
+struct ReplayTankAction {
+    ActionRequest action = ActionRequest::DoNothing;
+    bool success = true;
+    bool killed = false;  // Destroyed during this step
+    bool dead = false;    // Already destroyed before this step
+};
+
+/**
+ * @brief Tank state as stored in a replay
+ */
+struct ReplayTankState {
+    int playerId = 0;
+    Point position;
+    Direction direction = Direction::Up;
+    int remainingShells = 0;
+    bool destroyed = false;
+};
+
+/**
+ * @brief Shell state as stored in a replay
+ */
+struct ReplayShellState {
+    int playerId = 0;
+    Point position;
+    Direction direction = Direction::Up;
+};
+
+/**
+ * @brief Game outcome stored at the end of a finished replay
+ */
+struct ReplayResult {
+    int winner = 0;
+    GameResult::Reason reason = GameResult::MAX_STEPS;
+    size_t rounds = 0;
+};
+
+/**
+ * @brief Binary replay layout shared by ReplayWriter and ReplayReader
+ *
+ * All integers are LEB128 varints, signed values are zigzag encoded.
+ *
+ *   header:   magic "TKRP", version byte, width, height, max steps,
+ *             shells per tank, map name, player 1 name, player 2 name
+ *             (strings are a length followed by the bytes)
+ *   board:    run-length encoded cells in row-major order, each run is a
+ *             cell value byte and a length. A cell value holds the cell
+ *             type in the low two bits and the wall health above them.
+ *   objects:  tank count, then per tank player id, x, y, direction and
+ *             shells; shell count, then per shell player id, x, y and
+ *             direction
+ *   steps:    one record per step, starting with a flags byte:
+ *             - per tank alive at the start of the step, an action byte
+ *               (action, ignored, killed, delta follows) and optionally a
+ *               delta byte with position/direction/shell count changes
+ *             - a survivor bitmap over the previous shells, only if some
+ *               shell was removed. Survivors advance two cells.
+ *             - newly fired shells with their positions
+ *             - changed cells as index gaps and new cell values
+ *   end:      END_OF_STEPS, winner, reason and rounds
+ *
+ * Only changes are stored, so a quiet step costs about two bytes per
+ * live tank.
+ */
+namespace ReplayFormat {
+
+constexpr char MAGIC[4] = {'T', 'K', 'R', 'P'};
+constexpr uint8_t VERSION = 1;
+
+/** Largest board a reader accepts, so a corrupt header cannot demand any allocation */
+constexpr uint64_t MAX_BOARD_CELLS = uint64_t(1) << 26;
+
+// Step flags
+constexpr uint8_t STEP_SHELLS_REMOVED = 0x01;
+constexpr uint8_t STEP_SHELLS_FIRED = 0x02;
+constexpr uint8_t STEP_BOARD_CHANGED = 0x04;
+constexpr uint8_t END_OF_STEPS = 0xFF;
+
+// Tank action byte
+constexpr uint8_t ACTION_MASK = 0x0F;
+constexpr uint8_t ACTION_IGNORED = 0x10;
+constexpr uint8_t ACTION_KILLED = 0x20;
+constexpr uint8_t ACTION_HAS_DELTA = 0x40;
+
+// Tank delta byte
+constexpr uint8_t DELTA_POSITION = 0x01;
+constexpr uint8_t DELTA_DIRECTION = 0x02;
+constexpr uint8_t DELTA_SHELLS = 0x04;
+
+// Cell value byte
+constexpr uint8_t CELL_TYPE_MASK = 0x03;
+constexpr int CELL_HEALTH_SHIFT = 2;
+
+/** Distance a surviving shell travels in one step */
+constexpr int SHELL_STEP_DISTANCE = 2;
+
+void writeVarint(std::vector<uint8_t>& out, uint64_t value);
+void writeSignedVarint(std::vector<uint8_t>& out, int64_t value);
+void writeString(std::vector<uint8_t>& out, const std::string& value);
+
+/**
+ * @brief Bounds-checked sequential reader over replay bytes
+ *
+ * Every read returns false once the data is exhausted or malformed.
+ */
+class Cursor {
+public:
+    Cursor(const std::vector<uint8_t>& data, size_t offset = 0);
+
+    bool readByte(uint8_t& value);
+    bool readVarint(uint64_t& value);
+    bool readSignedVarint(int64_t& value);
+    bool readString(std::string& value);
+
+    size_t getOffset() const { return m_offset; }
+    bool atEnd() const { return m_offset >= m_data.size(); }
+
+private:
+    const std::vector<uint8_t>& m_data;
+    size_t m_offset;
+};
+
+/**
+ * @brief Wraps a coordinate onto a board dimension of the given size
+ */
+int wrapCoordinate(int64_t value, size_t size);
+
+/**
+ * @brief Smallest signed step from one coordinate to another on a torus
+ */
+int wrappedDelta(int from, int to, size_t size);
+
+} // namespace ReplayFormat
+
+} // namespace UserCommon_318835816_211314471
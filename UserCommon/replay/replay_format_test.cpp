@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "replay/replay_format.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace UserCommon_318835816_211314471;
+using namespace UserCommon_318835816_211314471::ReplayFormat;
+
+TEST(ReplayFormatTest, Varint_RoundTrip) {
+    const std::vector<uint64_t> values = {
+        0, 1, 127, 128, 300, 16384, std::numeric_limits<uint64_t>::max()
+    };
+    std::vector<uint8_t> data;
+    for (uint64_t value : values) {
+        writeVarint(data, value);
+    }
+
+    Cursor cursor(data);
+    for (uint64_t expected : values) {
+        uint64_t value;
+        ASSERT_TRUE(cursor.readVarint(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(cursor.atEnd());
+}
+
+TEST(ReplayFormatTest, Varint_SmallValuesUseOneByte) {
+    std::vector<uint8_t> data;
+    writeVarint(data, 127);
+    EXPECT_EQ(data.size(), 1u);
+    writeVarint(data, 128);
+    EXPECT_EQ(data.size(), 3u);
+}
+
+TEST(ReplayFormatTest, SignedVarint_RoundTrip) {
+    const std::vector<int64_t> values = {
+        0, 1, -1, 63, -64, 64, -65,
+        std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()
+    };
+    std::vector<uint8_t> data;
+    for (int64_t value : values) {
+        writeSignedVarint(data, value);
+    }
+
+    Cursor cursor(data);
+    for (int64_t expected : values) {
+        int64_t value;
+        ASSERT_TRUE(cursor.readSignedVarint(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(cursor.atEnd());
+}
+
+TEST(ReplayFormatTest, String_RoundTrip) {
+    std::vector<uint8_t> data;
+    writeString(data, "map.txt");
+    writeString(data, "");
+
+    Cursor cursor(data);
+    std::string value;
+    ASSERT_TRUE(cursor.readString(value));
+    EXPECT_EQ(value, "map.txt");
+    ASSERT_TRUE(cursor.readString(value));
+    EXPECT_EQ(value, "");
+}
+
+TEST(ReplayFormatTest, Cursor_FailsOnTruncatedData) {
+    std::vector<uint8_t> data;
+    writeVarint(data, 300);
+    data.pop_back();
+
+    Cursor cursor(data);
+    uint64_t value;
+    EXPECT_FALSE(cursor.readVarint(value));
+
+    std::vector<uint8_t> stringData;
+    writeString(stringData, "long name");
+    stringData.resize(4);
+    Cursor stringCursor(stringData);
+    std::string text;
+    EXPECT_FALSE(stringCursor.readString(text));
+}
+
+TEST(ReplayFormatTest, WrapCoordinate_WrapsBothWays) {
+    EXPECT_EQ(wrapCoordinate(0, 5), 0);
+    EXPECT_EQ(wrapCoordinate(6, 5), 1);
+    EXPECT_EQ(wrapCoordinate(-1, 5), 4);
+    EXPECT_EQ(wrapCoordinate(-11, 5), 4);
+}
+
+TEST(ReplayFormatTest, WrappedDelta_TakesShortestWay) {
+    EXPECT_EQ(wrappedDelta(2, 3, 10), 1);
+    EXPECT_EQ(wrappedDelta(3, 2, 10), -1);
+    EXPECT_EQ(wrappedDelta(0, 9, 10), -1);
+    EXPECT_EQ(wrappedDelta(9, 0, 10), 1);
+}
@@ -0,0 +1,451 @@
+#include <climits>
+#include <fstream>
+#include <iterator>
+
+#include "replay_reader.h"
+
+namespace UserCommon_318835816_211314471 {
+
+using namespace ReplayFormat;
+
+namespace {
+
+constexpr uint8_t MAX_ACTION = static_cast<uint8_t>(ActionRequest::DoNothing);
+constexpr uint8_t MAX_DIRECTION = static_cast<uint8_t>(Direction::UpLeft);
+constexpr uint8_t MAX_REASON = static_cast<uint8_t>(GameResult::ZERO_SHELLS);
+
+const char* actionName(ActionRequest action) {
+    switch (action) {
+        case ActionRequest::MoveForward: return "MoveForward";
+        case ActionRequest::MoveBackward: return "MoveBackward";
+        case ActionRequest::RotateLeft45: return "RotateLeft45";
+        case ActionRequest::RotateRight45: return "RotateRight45";
+        case ActionRequest::RotateLeft90: return "RotateLeft90";
+        case ActionRequest::RotateRight90: return "RotateRight90";
+        case ActionRequest::Shoot: return "Shoot";
+        case ActionRequest::GetBattleInfo: return "GetBattleInfo";
+        case ActionRequest::DoNothing: return "DoNothing";
+        default: return "Unknown";
+    }
+}
+
+bool readDirection(Cursor& cursor, Direction& direction) {
+    uint8_t value;
+    if (!cursor.readByte(value) || value > MAX_DIRECTION) {
+        return false;
+    }
+    direction = static_cast<Direction>(value);
+    return true;
+}
+
+bool readPosition(Cursor& cursor, const ReplayHeader& header, Point& position) {
+    uint64_t x, y;
+    if (!cursor.readVarint(x) || !cursor.readVarint(y) ||
+        x >= header.width || y >= header.height) {
+        return false;
+    }
+    position = Point(static_cast<int>(x), static_cast<int>(y));
+    return true;
+}
+
+} // namespace
+
+bool ReplayReader::loadFromFile(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return fail("Cannot open replay file: " + filePath);
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    return loadFromData(std::move(data));
+}
+
+bool ReplayReader::loadFromData(std::vector<uint8_t> data) {
+    m_data = std::move(data);
+    m_error.clear();
+    m_header = ReplayHeader();
+    m_result = ReplayResult();
+    m_hasResult = false;
+    m_stepOffsets.clear();
+    m_initialState = State();
+    m_state = State();
+
+    Cursor cursor(m_data);
+    if (!readHeader(cursor) || !readInitialState(cursor)) {
+        return false;
+    }
+
+    // Decode every step once to validate the replay and index the steps
+    State state = m_initialState;
+    while (!cursor.atEnd()) {
+        if (m_data[cursor.getOffset()] == END_OF_STEPS) {
+            uint8_t marker;
+            cursor.readByte(marker);
+            if (!readResult(cursor)) {
+                return false;
+            }
+            if (!cursor.atEnd()) {
+                return fail("Unexpected data after the game result");
+            }
+            break;
+        }
+        m_stepOffsets.push_back(cursor.getOffset());
+        if (!applyStep(cursor, state)) {
+            return fail("Corrupt record for step " + std::to_string(state.step + 1));
+        }
+    }
+
+    m_state = m_initialState;
+    return true;
+}
+
+bool ReplayReader::fail(const std::string& error) {
+    m_error = error;
+    m_stepOffsets.clear();
+    m_hasResult = false;
+    return false;
+}
+
+bool ReplayReader::readHeader(Cursor& cursor) {
+    for (char expected : MAGIC) {
+        uint8_t byte;
+        if (!cursor.readByte(byte) || byte != static_cast<uint8_t>(expected)) {
+            return fail("Not a replay file");
+        }
+    }
+    uint8_t version;
+    if (!cursor.readByte(version) || version != VERSION) {
+        return fail("Unsupported replay version");
+    }
+
+    uint64_t width, height, maxSteps, numShells;
+    if (!cursor.readVarint(width) || !cursor.readVarint(height) ||
+        !cursor.readVarint(maxSteps) || !cursor.readVarint(numShells) ||
+        !cursor.readString(m_header.mapName) ||
+        !cursor.readString(m_header.player1Name) ||
+        !cursor.readString(m_header.player2Name)) {
+        return fail("Truncated replay header");
+    }
+    // Points are int, and the board is allocated from these before any cell is read
+    if (width == 0 || height == 0 || width > INT_MAX || height > INT_MAX ||
+        width > MAX_BOARD_CELLS / height) {
+        return fail("Corrupt replay header: invalid board size");
+    }
+    m_header.width = width;
+    m_header.height = height;
+    m_header.maxSteps = maxSteps;
+    m_header.numShells = numShells;
+    return true;
+}
+
+bool ReplayReader::readInitialState(Cursor& cursor) {
+    State& state = m_initialState;
+    size_t cellCount = m_header.width * m_header.height;
+    state.board = GameBoard(m_header.width, m_header.height);
+
+    size_t index = 0;
+    while (index < cellCount) {
+        uint8_t value;
+        uint64_t runLength;
+        if (!cursor.readByte(value) || !cursor.readVarint(runLength) ||
+            runLength == 0 || runLength > cellCount - index) {
+            return fail("Corrupt initial board");
+        }
+        for (uint64_t i = 0; i < runLength; ++i, ++index) {
+            if (!applyCellValue(state.board, index, value)) {
+                return fail("Corrupt initial board");
+            }
+        }
+    }
+
+    uint64_t tankCount;
+    if (!cursor.readVarint(tankCount) || tankCount > cellCount) {
+        return fail("Corrupt initial tanks");
+    }
+    for (uint64_t i = 0; i < tankCount; ++i) {
+        ReplayTankState tank;
+        uint8_t playerId;
+        uint64_t shells;
+        if (!cursor.readByte(playerId) ||
+            !readPosition(cursor, m_header, tank.position) ||
+            !readDirection(cursor, tank.direction) ||
+            !cursor.readVarint(shells)) {
+            return fail("Corrupt initial tanks");
+        }
+        tank.playerId = playerId;
+        tank.remainingShells = static_cast<int>(shells);
+        state.tanks.push_back(tank);
+    }
+
+    uint64_t shellCount;
+    if (!cursor.readVarint(shellCount) || shellCount > m_data.size()) {
+        return fail("Corrupt initial shells");
+    }
+    for (uint64_t i = 0; i < shellCount; ++i) {
+        ReplayShellState shell;
+        uint8_t playerId;
+        if (!cursor.readByte(playerId) ||
+            !readPosition(cursor, m_header, shell.position) ||
+            !readDirection(cursor, shell.direction)) {
+            return fail("Corrupt initial shells");
+        }
+        shell.playerId = playerId;
+        state.shells.push_back(shell);
+    }
+    return true;
+}
+
+bool ReplayReader::readResult(Cursor& cursor) {
+    int64_t winner;
+    uint8_t reason;
+    uint64_t rounds;
+    if (!cursor.readSignedVarint(winner) || !cursor.readByte(reason) ||
+        reason > MAX_REASON || !cursor.readVarint(rounds)) {
+        return fail("Corrupt game result");
+    }
+    m_result.winner = static_cast<int>(winner);
+    m_result.reason = static_cast<GameResult::Reason>(reason);
+    m_result.rounds = rounds;
+    m_hasResult = true;
+    return true;
+}
+
+bool ReplayReader::applyStep(Cursor& cursor, State& state) const {
+    uint8_t flags;
+    if (!cursor.readByte(flags)) {
+        return false;
+    }
+
+    state.actions.assign(state.tanks.size(), ReplayTankAction());
+    for (size_t i = 0; i < state.tanks.size(); ++i) {
+        if (state.tanks[i].destroyed) {
+            state.actions[i].dead = true;
+            continue;
+        }
+        if (!applyTankRecord(cursor, state.tanks[i], state.actions[i])) {
+            return false;
+        }
+    }
+
+    if (!applyShellRecords(cursor, flags, state)) {
+        return false;
+    }
+    if ((flags & STEP_BOARD_CHANGED) && !applyBoardChanges(cursor, state.board)) {
+        return false;
+    }
+    state.step++;
+    return true;
+}
+
+bool ReplayReader::applyTankRecord(Cursor& cursor, ReplayTankState& tank,
+                                   ReplayTankAction& action) const {
+    uint8_t actionByte;
+    if (!cursor.readByte(actionByte) || (actionByte & ACTION_MASK) > MAX_ACTION) {
+        return false;
+    }
+    action.action = static_cast<ActionRequest>(actionByte & ACTION_MASK);
+    action.success = (actionByte & ACTION_IGNORED) == 0;
+    action.killed = (actionByte & ACTION_KILLED) != 0;
+    tank.destroyed = action.killed;
+
+    if ((actionByte & ACTION_HAS_DELTA) == 0) {
+        return true;
+    }
+
+    uint8_t delta;
+    if (!cursor.readByte(delta)) {
+        return false;
+    }
+    if (delta & DELTA_POSITION) {
+        int64_t dx, dy;
+        if (!cursor.readSignedVarint(dx) || !cursor.readSignedVarint(dy)) {
+            return false;
+        }
+        tank.position = Point(wrapCoordinate(tank.position.getX() + dx, m_header.width),
+                              wrapCoordinate(tank.position.getY() + dy, m_header.height));
+    }
+    if ((delta & DELTA_DIRECTION) && !readDirection(cursor, tank.direction)) {
+        return false;
+    }
+    if (delta & DELTA_SHELLS) {
+        int64_t shellsDelta;
+        if (!cursor.readSignedVarint(shellsDelta)) {
+            return false;
+        }
+        tank.remainingShells += static_cast<int>(shellsDelta);
+    }
+    return true;
+}
+
+bool ReplayReader::applyShellRecords(Cursor& cursor, uint8_t flags,
+                                     State& state) const {
+    std::vector<ReplayShellState>& shells = state.shells;
+
+    size_t kept = 0;
+    uint8_t survivorBits = 0;
+    for (size_t i = 0; i < shells.size(); ++i) {
+        if (flags & STEP_SHELLS_REMOVED) {
+            // One bitmap byte per 8 shells, read when its first shell comes up
+            if (i % 8 == 0 && !cursor.readByte(survivorBits)) {
+                return false;
+            }
+            if ((survivorBits & (1 << (i % 8))) == 0) {
+                continue;
+            }
+        }
+        ReplayShellState shell = shells[i];
+        Point delta = getDirectionDelta(shell.direction, SHELL_STEP_DISTANCE);
+        shell.position = Point(
+            wrapCoordinate(shell.position.getX() + delta.getX(), m_header.width),
+            wrapCoordinate(shell.position.getY() + delta.getY(), m_header.height));
+        shells[kept++] = shell;
+    }
+    shells.resize(kept);
+
+    if ((flags & STEP_SHELLS_FIRED) == 0) {
+        return true;
+    }
+    uint64_t fired;
+    if (!cursor.readVarint(fired) || fired > m_data.size()) {
+        return false;
+    }
+    for (uint64_t i = 0; i < fired; ++i) {
+        ReplayShellState shell;
+        uint8_t playerId;
+        if (!cursor.readByte(playerId) ||
+            !readPosition(cursor, m_header, shell.position) ||
+            !readDirection(cursor, shell.direction)) {
+            return false;
+        }
+        shell.playerId = playerId;
+        shells.push_back(shell);
+    }
+    return true;
+}
+
+bool ReplayReader::applyBoardChanges(Cursor& cursor, GameBoard& board) const {
+    size_t cellCount = m_header.width * m_header.height;
+    uint64_t changes;
+    if (!cursor.readVarint(changes) || changes > cellCount) {
+        return false;
+    }
+    uint64_t index = 0;
+    for (uint64_t i = 0; i < changes; ++i) {
+        uint64_t gap;
+        uint8_t value;
+        if (!cursor.readVarint(gap) || !cursor.readByte(value) ||
+            gap >= cellCount - index) {
+            return false;
+        }
+        index += gap;
+        if (!applyCellValue(board, index, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReplayReader::applyCellValue(GameBoard& board, size_t index, uint8_t value) {
+    size_t width = board.getWidth();
+    int x = static_cast<int>(index % width);
+    int y = static_cast<int>(index / width);
+    auto type = static_cast<GameBoard::CellType>(value & CELL_TYPE_MASK);
+    int health = value >> CELL_HEALTH_SHIFT;
+
+    switch (type) {
+        case GameBoard::CellType::Empty:
+        case GameBoard::CellType::Mine:
+            if (health != 0) {
+                return false;
+            }
+            board.setCellType(x, y, type);
+            return true;
+        case GameBoard::CellType::Wall:
+            if (health <= 0 || health > GameBoard::WALL_STARTING_HEALTH) {
+                return false;
+            }
+            board.setCellType(x, y, type);
+            board.setWallHealth(Point(x, y), health);
+            return true;
+        default:
+            return false;
+    }
+}
+
+const std::string& ReplayReader::getError() const {
+    return m_error;
+}
+
+const ReplayHeader& ReplayReader::getHeader() const {
+    return m_header;
+}
+
+size_t ReplayReader::getStepCount() const {
+    return m_stepOffsets.size();
+}
+
+bool ReplayReader::hasResult() const {
+    return m_hasResult;
+}
+
+const ReplayResult& ReplayReader::getResult() const {
+    return m_result;
+}
+
+bool ReplayReader::seekStep(size_t step) {
+    if (step > m_stepOffsets.size()) {
+        return false;
+    }
+    if (step < m_state.step) {
+        m_state = m_initialState;
+    }
+    while (m_state.step < step) {
+        Cursor cursor(m_data, m_stepOffsets[m_state.step]);
+        if (!applyStep(cursor, m_state)) {
+            // Steps were validated on load
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ReplayReader::getCurrentStep() const {
+    return m_state.step;
+}
+
+const GameBoard& ReplayReader::getBoard() const {
+    return m_state.board;
+}
+
+const std::vector<ReplayTankState>& ReplayReader::getTanks() const {
+    return m_state.tanks;
+}
+
+const std::vector<ReplayShellState>& ReplayReader::getShells() const {
+    return m_state.shells;
+}
+
+const std::vector<ReplayTankAction>& ReplayReader::getActions() const {
+    return m_state.actions;
+}
+
+std::string ReplayReader::formatActionLog(const std::vector<ReplayTankAction>& actions) {
+    std::string line;
+    for (size_t i = 0; i < actions.size(); ++i) {
+        const ReplayTankAction& action = actions[i];
+        if (i > 0) line += ", ";
+        if (action.dead) {
+            line += "Killed";
+            continue;
+        }
+        line += actionName(action.action);
+        if (action.killed) {
+            line += " (killed)";
+        } else if (!action.success) {
+            line += " (ignored)";
+        }
+    }
+    return line;
+}
+
+} // namespace UserCommon_318835816_211314471
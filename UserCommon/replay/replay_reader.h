@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "game_board.h"
+#include "replay_format.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @class ReplayReader
+ * @brief Reads a binary replay and rebuilds the game state at any step
+ *
+ * The whole replay is validated and indexed when loaded. Seeking forward
+ * applies the step records from the current step, seeking backward
+ * restarts from the initial state.
+ */
+class ReplayReader {
+public:
+    /**
+     * @brief Loads a replay from a file
+     *
+     * @param filePath Path of the replay file
+     * @return true if the replay was loaded, false otherwise (see getError)
+     */
+    bool loadFromFile(const std::string& filePath);
+
+    /**
+     * @brief Loads a replay from encoded bytes
+     *
+     * @param data The replay bytes, as produced by ReplayWriter
+     * @return true if the replay was loaded, false otherwise (see getError)
+     */
+    bool loadFromData(std::vector<uint8_t> data);
+
+    /**
+     * @brief Gets the reason the last load failed
+     */
+    const std::string& getError() const;
+
+    /**
+     * @brief Gets the game parameters of the loaded replay
+     */
+    const ReplayHeader& getHeader() const;
+
+    /**
+     * @brief Gets the number of steps in the replay
+     */
+    size_t getStepCount() const;
+
+    /**
+     * @brief Checks if the replay was finished with a game result
+     */
+    bool hasResult() const;
+
+    /**
+     * @brief Gets the game result, valid only if hasResult() is true
+     */
+    const ReplayResult& getResult() const;
+
+    /**
+     * @brief Moves to the state after the given step
+     *
+     * @param step The step to move to, 0 is the initial state
+     * @return true if the step exists, false otherwise
+     */
+    bool seekStep(size_t step);
+
+    /**
+     * @brief Gets the step of the current state
+     */
+    size_t getCurrentStep() const;
+
+    /**
+     * @brief Gets the board of the current state
+     */
+    const GameBoard& getBoard() const;
+
+    /**
+     * @brief Gets the tanks of the current state
+     */
+    const std::vector<ReplayTankState>& getTanks() const;
+
+    /**
+     * @brief Gets the shells of the current state
+     */
+    const std::vector<ReplayShellState>& getShells() const;
+
+    /**
+     * @brief Gets the tank actions of the current step
+     *
+     * One entry per tank, empty for the initial state.
+     */
+    const std::vector<ReplayTankAction>& getActions() const;
+
+    /**
+     * @brief Formats step actions the way the game log writes them
+     *
+     * e.g. "MoveForward, Shoot (ignored), Killed"
+     *
+     * @param actions The actions of one step
+     * @return The game log line for the step
+     */
+    static std::string formatActionLog(const std::vector<ReplayTankAction>& actions);
+
+private:
+    struct State {
+        size_t step = 0;
+        GameBoard board;
+        std::vector<ReplayTankState> tanks;
+        std::vector<ReplayShellState> shells;
+        std::vector<ReplayTankAction> actions;
+    };
+
+    bool fail(const std::string& error);
+    bool readHeader(ReplayFormat::Cursor& cursor);
+    bool readInitialState(ReplayFormat::Cursor& cursor);
+    bool readResult(ReplayFormat::Cursor& cursor);
+
+    // Applies the step record at the cursor to the state
+    bool applyStep(ReplayFormat::Cursor& cursor, State& state) const;
+    bool applyTankRecord(ReplayFormat::Cursor& cursor, ReplayTankState& tank,
+                         ReplayTankAction& action) const;
+    bool applyShellRecords(ReplayFormat::Cursor& cursor, uint8_t flags,
+                           State& state) const;
+    bool applyBoardChanges(ReplayFormat::Cursor& cursor, GameBoard& board) const;
+    static bool applyCellValue(GameBoard& board, size_t index, uint8_t value);
+
+    std::vector<uint8_t> m_data;
+    std::string m_error;
+    ReplayHeader m_header;
+    ReplayResult m_result;
+    bool m_hasResult = false;
+
+    // Offset of every step record, index 0 holds step 1
+    std::vector<size_t> m_stepOffsets;
+    State m_initialState;
+    State m_state;
+};
+
+} // namespace UserCommon_318835816_211314471
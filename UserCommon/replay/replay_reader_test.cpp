@@ -0,0 +1,415 @@
+#include "gtest/gtest.h"
+#include "replay/replay_reader.h"
+#include "replay/replay_writer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace UserCommon_318835816_211314471;
+
+namespace {
+
+// Full game state of one step, used as the expected replay contents
+struct Frame {
+    GameBoard board;
+    std::vector<Tank> tanks;
+    std::vector<Shell> shells;
+    std::vector<ReplayTankAction> actions;
+};
+
+/**
+ * Drives tanks, shells and the board through random steps that exercise
+ * every kind of change the replay records, and keeps each step as a Frame.
+ */
+class RandomReplayGame {
+public:
+    RandomReplayGame(size_t width, size_t height, unsigned seed)
+        : m_rng(seed) {
+        std::vector<std::string> lines(height, std::string(width, ' '));
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                int roll = m_rng() % 10;
+                if (roll == 0) lines[y][x] = '#';
+                else if (roll == 1) lines[y][x] = '@';
+            }
+        }
+        lines[0][0] = '1';
+        lines[height - 1][width - 1] = '2';
+        lines[height / 2][width / 2] = '1';
+
+        std::vector<std::pair<int, Point>> tankPositions;
+        m_board = GameBoard(width, height);
+        m_board.initialize(lines, tankPositions);
+        for (const auto& [playerId, position] : tankPositions) {
+            m_tanks.emplace_back(playerId, position,
+                                 playerId == 1 ? Direction::Left : Direction::Right);
+        }
+    }
+
+    void step() {
+        std::vector<ReplayTankAction> actions(m_tanks.size());
+        size_t survivors = 0;
+        for (Shell& shell : m_shells) {
+            // Survivors advance two cells, the rest disappear
+            if (m_rng() % 4 == 0) {
+                continue;
+            }
+            shell.setPosition(m_board.wrapPosition(
+                shell.getPosition() + getDirectionDelta(shell.getDirection(), 2)));
+            m_shells[survivors++] = shell;
+        }
+        m_shells.erase(m_shells.begin() + survivors, m_shells.end());
+
+        for (size_t i = 0; i < m_tanks.size(); ++i) {
+            Tank& tank = m_tanks[i];
+            ReplayTankAction& action = actions[i];
+            if (tank.isDestroyed()) {
+                action.dead = true;
+                continue;
+            }
+            action.action = static_cast<ActionRequest>(m_rng() % 9);
+            action.success = m_rng() % 5 != 0;
+            if (action.success) {
+                applyAction(tank, action.action);
+            }
+            if (m_rng() % 60 == 0) {
+                tank.destroy();
+                action.killed = true;
+            }
+        }
+
+        size_t width = m_board.getWidth();
+        size_t height = m_board.getHeight();
+        if (m_rng() % 3 == 0) {
+            Point cell(m_rng() % width, m_rng() % height);
+            if (m_board.isWall(cell)) {
+                m_board.damageWall(cell);
+            } else if (m_rng() % 2 == 0) {
+                m_board.setCellType(cell, GameBoard::CellType::Wall);
+            } else {
+                m_board.setCellType(cell, GameBoard::CellType::Empty);
+            }
+        }
+
+        m_frames.push_back(Frame{m_board, m_tanks, m_shells, actions});
+    }
+
+    void applyAction(Tank& tank, ActionRequest action) {
+        switch (action) {
+            case ActionRequest::MoveForward:
+                tank.setPosition(m_board.wrapPosition(tank.getNextForwardPosition()));
+                break;
+            case ActionRequest::MoveBackward:
+                tank.setPosition(m_board.wrapPosition(tank.getNextBackwardPosition()));
+                break;
+            case ActionRequest::RotateLeft45:
+                tank.rotateLeft(false);
+                break;
+            case ActionRequest::RotateRight90:
+                tank.rotateRight(true);
+                break;
+            case ActionRequest::Shoot:
+                if (tank.getRemainingShells() > 0) {
+                    tank.decrementShells();
+                    m_shells.emplace_back(tank.getPlayerId(),
+                                          m_board.wrapPosition(tank.getNextForwardPosition()),
+                                          tank.getDirection());
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::mt19937 m_rng;
+    GameBoard m_board;
+    std::vector<Tank> m_tanks;
+    std::vector<Shell> m_shells;
+    std::vector<Frame> m_frames;
+};
+
+ReplayHeader makeHeader(const GameBoard& board, size_t maxSteps) {
+    ReplayHeader header;
+    header.width = board.getWidth();
+    header.height = board.getHeight();
+    header.maxSteps = maxSteps;
+    header.numShells = 16;
+    header.mapName = "random_map.txt";
+    header.player1Name = "Player1";
+    header.player2Name = "Player2";
+    return header;
+}
+
+// Records a random game of the given length and returns its frames
+std::vector<Frame> recordRandomGame(ReplayWriter& writer, size_t width, size_t height,
+                                    size_t steps, unsigned seed) {
+    RandomReplayGame game(width, height, seed);
+    writer.begin(makeHeader(game.m_board, steps), game.m_board, game.m_tanks, game.m_shells);
+    game.m_frames.push_back(Frame{game.m_board, game.m_tanks, game.m_shells, {}});
+    for (size_t i = 0; i < steps; ++i) {
+        game.step();
+        writer.recordStep(game.m_frames.back().actions, game.m_tanks,
+                          game.m_shells, game.m_board);
+    }
+    return game.m_frames;
+}
+
+void expectStateMatches(const ReplayReader& reader, const Frame& frame) {
+    const GameBoard& board = reader.getBoard();
+    ASSERT_EQ(board.getWidth(), frame.board.getWidth());
+    ASSERT_EQ(board.getHeight(), frame.board.getHeight());
+    for (size_t y = 0; y < board.getHeight(); ++y) {
+        for (size_t x = 0; x < board.getWidth(); ++x) {
+            Point cell(x, y);
+            ASSERT_EQ(board.getCellType(cell), frame.board.getCellType(cell)) << cell;
+            ASSERT_EQ(board.getWallHealth(cell), frame.board.getWallHealth(cell)) << cell;
+        }
+    }
+
+    ASSERT_EQ(reader.getTanks().size(), frame.tanks.size());
+    for (size_t i = 0; i < frame.tanks.size(); ++i) {
+        const ReplayTankState& tank = reader.getTanks()[i];
+        EXPECT_EQ(tank.playerId, frame.tanks[i].getPlayerId());
+        EXPECT_EQ(tank.position, frame.tanks[i].getPosition());
+        EXPECT_EQ(tank.direction, frame.tanks[i].getDirection());
+        EXPECT_EQ(tank.remainingShells, frame.tanks[i].getRemainingShells());
+        EXPECT_EQ(tank.destroyed, frame.tanks[i].isDestroyed());
+    }
+
+    ASSERT_EQ(reader.getShells().size(), frame.shells.size());
+    for (size_t i = 0; i < frame.shells.size(); ++i) {
+        const ReplayShellState& shell = reader.getShells()[i];
+        EXPECT_EQ(shell.playerId, frame.shells[i].getPlayerId());
+        EXPECT_EQ(shell.position, frame.shells[i].getPosition());
+        EXPECT_EQ(shell.direction, frame.shells[i].getDirection());
+    }
+
+    ASSERT_EQ(reader.getActions().size(), frame.actions.size());
+    for (size_t i = 0; i < frame.actions.size(); ++i) {
+        const ReplayTankAction& action = reader.getActions()[i];
+        const ReplayTankAction& expected = frame.actions[i];
+        EXPECT_EQ(action.dead, expected.dead);
+        if (expected.dead) continue;
+        EXPECT_EQ(action.action, expected.action);
+        EXPECT_EQ(action.success, expected.success);
+        EXPECT_EQ(action.killed, expected.killed);
+    }
+}
+
+} // namespace
+
+class ReplayReaderTest : public ::testing::Test {};
+
+TEST_F(ReplayReaderTest, RoundTrip_EveryStepMatchesRandomGames) {
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+        ReplayWriter writer;
+        std::vector<Frame> frames = recordRandomGame(writer, 13, 9, 150, seed);
+        ReplayResult result;
+        result.winner = 2;
+        result.reason = GameResult::ALL_TANKS_DEAD;
+        result.rounds = 150;
+        writer.finish(result);
+
+        ReplayReader reader;
+        ASSERT_TRUE(reader.loadFromData(writer.getData())) << reader.getError();
+        ASSERT_EQ(reader.getStepCount(), frames.size() - 1);
+        for (size_t step = 0; step < frames.size(); ++step) {
+            ASSERT_TRUE(reader.seekStep(step));
+            SCOPED_TRACE("seed " + std::to_string(seed) + " step " + std::to_string(step));
+            expectStateMatches(reader, frames[step]);
+            if (HasFatalFailure()) return;
+        }
+
+        ASSERT_TRUE(reader.hasResult());
+        EXPECT_EQ(reader.getResult().winner, 2);
+        EXPECT_EQ(reader.getResult().reason, GameResult::ALL_TANKS_DEAD);
+        EXPECT_EQ(reader.getResult().rounds, 150u);
+    }
+}
+
+TEST_F(ReplayReaderTest, Header_RoundTrip) {
+    ReplayWriter writer;
+    recordRandomGame(writer, 7, 5, 3, 42);
+
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromData(writer.getData())) << reader.getError();
+    EXPECT_EQ(reader.getHeader().width, 7u);
+    EXPECT_EQ(reader.getHeader().height, 5u);
+    EXPECT_EQ(reader.getHeader().maxSteps, 3u);
+    EXPECT_EQ(reader.getHeader().numShells, 16u);
+    EXPECT_EQ(reader.getHeader().mapName, "random_map.txt");
+    EXPECT_EQ(reader.getHeader().player1Name, "Player1");
+    EXPECT_EQ(reader.getHeader().player2Name, "Player2");
+}
+
+TEST_F(ReplayReaderTest, SeekStep_BackwardAndForward) {
+    ReplayWriter writer;
+    std::vector<Frame> frames = recordRandomGame(writer, 10, 10, 40, 7);
+
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromData(writer.getData())) << reader.getError();
+    EXPECT_EQ(reader.getCurrentStep(), 0u);
+
+    for (size_t step : {30u, 5u, 40u, 0u, 17u}) {
+        ASSERT_TRUE(reader.seekStep(step));
+        EXPECT_EQ(reader.getCurrentStep(), step);
+        expectStateMatches(reader, frames[step]);
+    }
+    EXPECT_FALSE(reader.seekStep(41));
+    EXPECT_EQ(reader.getCurrentStep(), 17u);
+}
+
+TEST_F(ReplayReaderTest, UnfinishedReplay_HasStepsButNoResult) {
+    ReplayWriter writer;
+    recordRandomGame(writer, 6, 6, 12, 3);
+    EXPECT_TRUE(writer.isRecording());
+    EXPECT_EQ(writer.getStepCount(), 12u);
+
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromData(writer.getData())) << reader.getError();
+    EXPECT_EQ(reader.getStepCount(), 12u);
+    EXPECT_FALSE(reader.hasResult());
+}
+
+TEST_F(ReplayReaderTest, LoadFromData_RejectsBadMagic) {
+    ReplayWriter writer;
+    recordRandomGame(writer, 6, 6, 2, 3);
+    std::vector<uint8_t> data = writer.getData();
+    data[0] = 'X';
+
+    ReplayReader reader;
+    EXPECT_FALSE(reader.loadFromData(data));
+    EXPECT_FALSE(reader.getError().empty());
+}
+
+TEST_F(ReplayReaderTest, LoadFromData_RejectsTruncatedData) {
+    ReplayWriter writer;
+    recordRandomGame(writer, 8, 8, 30, 11);
+    writer.finish(ReplayResult());
+    const std::vector<uint8_t>& full = writer.getData();
+
+    // A cut at a step boundary reads as an unfinished replay, any other
+    // cut must be reported
+    ReplayReader reader;
+    size_t rejected = 0;
+    for (size_t length = 0; length < full.size(); ++length) {
+        std::vector<uint8_t> data(full.begin(), full.begin() + length);
+        if (!reader.loadFromData(data)) {
+            rejected++;
+            EXPECT_FALSE(reader.getError().empty());
+        } else {
+            EXPECT_FALSE(reader.hasResult());
+        }
+    }
+    EXPECT_GT(rejected, 0u);
+    EXPECT_FALSE(reader.loadFromData({}));
+}
+
+TEST_F(ReplayReaderTest, LoadFromData_RejectsHugeBoardSize) {
+    auto headerWithSize = [](uint64_t width, uint64_t height) {
+        std::vector<uint8_t> data(std::begin(ReplayFormat::MAGIC), std::end(ReplayFormat::MAGIC));
+        data.push_back(ReplayFormat::VERSION);
+        ReplayFormat::writeVarint(data, width);
+        ReplayFormat::writeVarint(data, height);
+        ReplayFormat::writeVarint(data, 100);
+        ReplayFormat::writeVarint(data, 5);
+        ReplayFormat::writeString(data, "map");
+        ReplayFormat::writeString(data, "p1");
+        ReplayFormat::writeString(data, "p2");
+        // One run covering the claimed board, no tanks and no shells
+        data.push_back(0);
+        ReplayFormat::writeVarint(data, width * height);
+        ReplayFormat::writeVarint(data, 0);
+        ReplayFormat::writeVarint(data, 0);
+        return data;
+    };
+
+    ReplayReader reader;
+    for (auto [width, height] : std::vector<std::pair<uint64_t, uint64_t>>{
+             {1000000, 1000000}, {uint64_t(1) << 33, 2}, {uint64_t(1) << 32, uint64_t(1) << 32},
+             {0, 10}, {10, 0}}) {
+        EXPECT_FALSE(reader.loadFromData(headerWithSize(width, height))) << width << "x" << height;
+        EXPECT_NE(reader.getError().find("Corrupt"), std::string::npos) << reader.getError();
+    }
+
+    // A large board within the bound still loads
+    EXPECT_TRUE(reader.loadFromData(headerWithSize(4000, 3000))) << reader.getError();
+    EXPECT_EQ(reader.getHeader().width, 4000u);
+}
+
+TEST_F(ReplayReaderTest, LoadFromFile_RoundTrip) {
+    ReplayWriter writer;
+    recordRandomGame(writer, 6, 6, 10, 5);
+    writer.finish(ReplayResult());
+
+    const std::string path = "replay_reader_test.replay";
+    ASSERT_TRUE(writer.saveToFile(path));
+    ReplayReader reader;
+    EXPECT_TRUE(reader.loadFromFile(path)) << reader.getError();
+    EXPECT_EQ(reader.getStepCount(), 10u);
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(reader.loadFromFile("missing_file.replay"));
+}
+
+TEST_F(ReplayReaderTest, FormatActionLog_MatchesGameLog) {
+    std::vector<ReplayTankAction> actions(4);
+    actions[0].action = ActionRequest::MoveForward;
+    actions[1].action = ActionRequest::Shoot;
+    actions[1].success = false;
+    actions[2].action = ActionRequest::RotateLeft90;
+    actions[2].success = false;
+    actions[2].killed = true;
+    actions[3].dead = true;
+
+    EXPECT_EQ(ReplayReader::formatActionLog(actions),
+              "MoveForward, Shoot (ignored), RotateLeft90 (killed), Killed");
+    EXPECT_EQ(ReplayReader::formatActionLog({}), "");
+}
+
+TEST_F(ReplayReaderTest, Size_QuietStepsCostAboutTwoBytesPerTank) {
+    GameBoard board(50, 50);
+    std::vector<Tank> tanks = {
+        Tank(1, Point(0, 0), Direction::Left),
+        Tank(2, Point(49, 49), Direction::Right)
+    };
+    std::vector<Shell> shells;
+    std::vector<ReplayTankAction> actions(2);
+
+    ReplayWriter writer;
+    writer.begin(makeHeader(board, 10000), board, tanks, shells);
+    size_t initialSize = writer.getData().size();
+    for (int i = 0; i < 10000; ++i) {
+        writer.recordStep(actions, tanks, shells, board);
+    }
+
+    // One flags byte and one action byte per tank
+    EXPECT_EQ(writer.getData().size() - initialSize, 10000u * 3);
+}
+
+TEST_F(ReplayReaderTest, DISABLED_Benchmark_RecordAndReadLongGame) {
+    const size_t steps = 10000;
+    ReplayWriter writer;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<Frame> frames = recordRandomGame(writer, 80, 40, steps, 99);
+    writer.finish(ReplayResult());
+    ReplayReader reader;
+    ASSERT_TRUE(reader.loadFromData(writer.getData())) << reader.getError();
+    ASSERT_TRUE(reader.seekStep(steps));
+    auto end = std::chrono::high_resolution_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+
+    expectStateMatches(reader, frames.back());
+
+    // The same game as full per-step board snapshots (one byte per cell)
+    size_t snapshotBytes = steps * 80 * 40;
+    RecordProperty("replay_bytes", static_cast<int>(writer.getData().size()));
+    RecordProperty("snapshot_bytes", static_cast<int>(snapshotBytes));
+    RecordProperty("seconds", std::to_string(elapsed));
+
+    EXPECT_LT(writer.getData().size(), snapshotBytes / 100);
+}
@@ -0,0 +1,290 @@
+#include <fstream>
+
+#include "replay_writer.h"
+
+namespace UserCommon_318835816_211314471 {
+
+using namespace ReplayFormat;
+
+namespace {
+
+ReplayTankState toTankState(const Tank& tank) {
+    ReplayTankState state;
+    state.playerId = tank.getPlayerId();
+    state.position = tank.getPosition();
+    state.direction = tank.getDirection();
+    state.remainingShells = tank.getRemainingShells();
+    state.destroyed = tank.isDestroyed();
+    return state;
+}
+
+ReplayShellState toShellState(const Shell& shell) {
+    ReplayShellState state;
+    state.playerId = shell.getPlayerId();
+    state.position = shell.getPosition();
+    state.direction = shell.getDirection();
+    return state;
+}
+
+} // namespace
+
+void ReplayWriter::begin(const ReplayHeader& header,
+                         const GameBoard& board,
+                         const std::vector<Tank>& tanks,
+                         const std::vector<Shell>& shells) {
+    m_data.clear();
+    m_header = header;
+    m_stepCount = 0;
+    m_recording = true;
+
+    m_data.insert(m_data.end(), std::begin(MAGIC), std::end(MAGIC));
+    m_data.push_back(VERSION);
+    writeVarint(m_data, header.width);
+    writeVarint(m_data, header.height);
+    writeVarint(m_data, header.maxSteps);
+    writeVarint(m_data, header.numShells);
+    writeString(m_data, header.mapName);
+    writeString(m_data, header.player1Name);
+    writeString(m_data, header.player2Name);
+
+    writeInitialBoard(board);
+
+    m_tanks.clear();
+    writeVarint(m_data, tanks.size());
+    for (const Tank& tank : tanks) {
+        m_tanks.push_back(toTankState(tank));
+        m_data.push_back(static_cast<uint8_t>(tank.getPlayerId()));
+        writeVarint(m_data, tank.getPosition().getX());
+        writeVarint(m_data, tank.getPosition().getY());
+        m_data.push_back(static_cast<uint8_t>(tank.getDirection()));
+        writeVarint(m_data, tank.getRemainingShells());
+    }
+
+    m_shells.clear();
+    writeVarint(m_data, shells.size());
+    for (const Shell& shell : shells) {
+        m_shells.push_back(toShellState(shell));
+        m_data.push_back(static_cast<uint8_t>(shell.getPlayerId()));
+        writeVarint(m_data, shell.getPosition().getX());
+        writeVarint(m_data, shell.getPosition().getY());
+        m_data.push_back(static_cast<uint8_t>(shell.getDirection()));
+    }
+}
+
+void ReplayWriter::writeInitialBoard(const GameBoard& board) {
+    m_board = board;
+    m_boardRevision = board.getRevision();
+
+    size_t width = board.getWidth();
+    size_t height = board.getHeight();
+    uint8_t runValue = 0;
+    uint64_t runLength = 0;
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            uint8_t value = cellValue(board, x, y);
+            if (runLength > 0 && value != runValue) {
+                m_data.push_back(runValue);
+                writeVarint(m_data, runLength);
+                runLength = 0;
+            }
+            runValue = value;
+            runLength++;
+        }
+    }
+    if (runLength > 0) {
+        m_data.push_back(runValue);
+        writeVarint(m_data, runLength);
+    }
+}
+
+void ReplayWriter::recordStep(const std::vector<ReplayTankAction>& actions,
+                              const std::vector<Tank>& tanks,
+                              const std::vector<Shell>& shells,
+                              const GameBoard& board) {
+    if (!m_recording) {
+        return;
+    }
+
+    // The flags byte is only known once the step body is encoded
+    m_stepBuffer.clear();
+    uint8_t flags = 0;
+
+    for (size_t i = 0; i < m_tanks.size() && i < tanks.size(); ++i) {
+        if (m_tanks[i].destroyed) {
+            continue;
+        }
+        ReplayTankAction action = i < actions.size() ? actions[i] : ReplayTankAction();
+        writeTankRecord(i, action, tanks[i]);
+    }
+    writeShellRecords(shells, flags);
+    writeBoardChanges(board, flags);
+
+    m_data.push_back(flags);
+    m_data.insert(m_data.end(), m_stepBuffer.begin(), m_stepBuffer.end());
+    m_stepCount++;
+}
+
+void ReplayWriter::writeTankRecord(size_t index, const ReplayTankAction& action,
+                                   const Tank& tank) {
+    ReplayTankState& previous = m_tanks[index];
+
+    uint8_t delta = 0;
+    if (tank.getPosition() != previous.position) delta |= DELTA_POSITION;
+    if (tank.getDirection() != previous.direction) delta |= DELTA_DIRECTION;
+    if (tank.getRemainingShells() != previous.remainingShells) delta |= DELTA_SHELLS;
+
+    uint8_t actionByte = static_cast<uint8_t>(action.action) & ACTION_MASK;
+    if (!action.success) actionByte |= ACTION_IGNORED;
+    if (tank.isDestroyed()) actionByte |= ACTION_KILLED;
+    if (delta != 0) actionByte |= ACTION_HAS_DELTA;
+    m_stepBuffer.push_back(actionByte);
+
+    if (delta != 0) {
+        m_stepBuffer.push_back(delta);
+    }
+    if (delta & DELTA_POSITION) {
+        writeSignedVarint(m_stepBuffer, wrappedDelta(previous.position.getX(),
+                                                     tank.getPosition().getX(),
+                                                     m_header.width));
+        writeSignedVarint(m_stepBuffer, wrappedDelta(previous.position.getY(),
+                                                     tank.getPosition().getY(),
+                                                     m_header.height));
+    }
+    if (delta & DELTA_DIRECTION) {
+        m_stepBuffer.push_back(static_cast<uint8_t>(tank.getDirection()));
+    }
+    if (delta & DELTA_SHELLS) {
+        writeSignedVarint(m_stepBuffer,
+                          tank.getRemainingShells() - previous.remainingShells);
+    }
+
+    previous = toTankState(tank);
+}
+
+void ReplayWriter::writeShellRecords(const std::vector<Shell>& shells,
+                                     uint8_t& flags) {
+    // Shells keep their order in the game, survivors come first and newly
+    // fired ones are appended. Matching the expected survivor positions
+    // in order splits the list without needing shell identities.
+    size_t next = 0;
+    m_survivors.assign((m_shells.size() + 7) / 8, 0);
+    bool allSurvived = true;
+    for (size_t i = 0; i < m_shells.size(); ++i) {
+        ReplayShellState& shell = m_shells[i];
+        Point delta = getDirectionDelta(shell.direction, SHELL_STEP_DISTANCE);
+        Point expected(
+            wrapCoordinate(shell.position.getX() + delta.getX(), m_header.width),
+            wrapCoordinate(shell.position.getY() + delta.getY(), m_header.height));
+
+        if (next < shells.size() &&
+            shells[next].getPosition() == expected &&
+            shells[next].getDirection() == shell.direction &&
+            shells[next].getPlayerId() == shell.playerId) {
+            m_survivors[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+            next++;
+        } else {
+            allSurvived = false;
+        }
+    }
+
+    if (!allSurvived) {
+        flags |= STEP_SHELLS_REMOVED;
+        m_stepBuffer.insert(m_stepBuffer.end(), m_survivors.begin(), m_survivors.end());
+    }
+
+    if (next < shells.size()) {
+        flags |= STEP_SHELLS_FIRED;
+        writeVarint(m_stepBuffer, shells.size() - next);
+        for (size_t i = next; i < shells.size(); ++i) {
+            m_stepBuffer.push_back(static_cast<uint8_t>(shells[i].getPlayerId()));
+            writeVarint(m_stepBuffer, shells[i].getPosition().getX());
+            writeVarint(m_stepBuffer, shells[i].getPosition().getY());
+            m_stepBuffer.push_back(static_cast<uint8_t>(shells[i].getDirection()));
+        }
+    }
+
+    m_shells.clear();
+    for (const Shell& shell : shells) {
+        m_shells.push_back(toShellState(shell));
+    }
+}
+
+void ReplayWriter::writeBoardChanges(const GameBoard& board, uint8_t& flags) {
+    // The board rarely changes, skip the scan when its revision is the same
+    if (board.getRevision() == m_boardRevision) {
+        return;
+    }
+    m_boardRevision = board.getRevision();
+
+    size_t width = m_header.width;
+    size_t cellCount = width * m_header.height;
+    size_t changes = 0;
+    size_t lastIndex = 0;
+    m_changeBuffer.clear();
+    for (size_t index = 0; index < cellCount; ++index) {
+        int x = index % width;
+        int y = index / width;
+        uint8_t value = cellValue(board, x, y);
+        if (value == cellValue(m_board, x, y)) {
+            continue;
+        }
+
+        writeVarint(m_changeBuffer, index - lastIndex);
+        m_changeBuffer.push_back(value);
+        lastIndex = index;
+        changes++;
+
+        m_board.setCellType(x, y, board.getCellType(x, y));
+        m_board.setWallHealth(Point(x, y), board.getWallHealth(Point(x, y)));
+    }
+
+    if (changes > 0) {
+        flags |= STEP_BOARD_CHANGED;
+        writeVarint(m_stepBuffer, changes);
+        m_stepBuffer.insert(m_stepBuffer.end(), m_changeBuffer.begin(),
+                            m_changeBuffer.end());
+    }
+}
+
+uint8_t ReplayWriter::cellValue(const GameBoard& board, int x, int y) {
+    GameBoard::CellType type = board.getCellType(x, y);
+    uint8_t value = static_cast<uint8_t>(type);
+    if (type == GameBoard::CellType::Wall) {
+        value |= static_cast<uint8_t>(board.getWallHealth(Point(x, y)) << CELL_HEALTH_SHIFT);
+    }
+    return value;
+}
+
+void ReplayWriter::finish(const ReplayResult& result) {
+    if (!m_recording) {
+        return;
+    }
+    m_data.push_back(END_OF_STEPS);
+    writeSignedVarint(m_data, result.winner);
+    m_data.push_back(static_cast<uint8_t>(result.reason));
+    writeVarint(m_data, result.rounds);
+    m_recording = false;
+}
+
+bool ReplayWriter::saveToFile(const std::string& filePath) const {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(m_data.data()), m_data.size());
+    return file.good();
+}
+
+bool ReplayWriter::isRecording() const {
+    return m_recording;
+}
+
+size_t ReplayWriter::getStepCount() const {
+    return m_stepCount;
+}
+
+const std::vector<uint8_t>& ReplayWriter::getData() const {
+    return m_data;
+}
+
+} // namespace UserCommon_318835816_211314471
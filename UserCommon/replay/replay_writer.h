@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "game_board.h"
+#include "objects/shell.h"
+#include "objects/tank.h"
+#include "replay_format.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @class ReplayWriter
+ * @brief Records a game into the compact binary replay format
+ *
+ * The writer keeps the state of the last recorded step and only encodes
+ * what changed since then (see ReplayFormat for the layout). The bytes
+ * are kept in memory until saved.
+ */
+class ReplayWriter {
+public:
+    /**
+     * @brief Starts a new replay from the initial game state
+     *
+     * Discards anything recorded before.
+     *
+     * @param header Game parameters
+     * @param board The initial board
+     * @param tanks The initial tanks
+     * @param shells The initial shells (normally none)
+     */
+    void begin(const ReplayHeader& header,
+               const GameBoard& board,
+               const std::vector<Tank>& tanks,
+               const std::vector<Shell>& shells);
+
+    /**
+     * @brief Records the outcome of one game step
+     *
+     * @param actions The action of every tank in this step, in tank order.
+     *  Only the action and success fields are used.
+     * @param tanks The tanks after the step
+     * @param shells The shells after the step
+     * @param board The board after the step
+     */
+    void recordStep(const std::vector<ReplayTankAction>& actions,
+                    const std::vector<Tank>& tanks,
+                    const std::vector<Shell>& shells,
+                    const GameBoard& board);
+
+    /**
+     * @brief Closes the replay with the game outcome
+     *
+     * @param result The game result
+     */
+    void finish(const ReplayResult& result);
+
+    /**
+     * @brief Writes the recorded replay to a file
+     *
+     * @param filePath Path of the replay file
+     * @return true if the file was written, false otherwise
+     */
+    bool saveToFile(const std::string& filePath) const;
+
+    /**
+     * @brief Checks if a replay was started and not finished yet
+     */
+    bool isRecording() const;
+
+    /**
+     * @brief Gets the number of recorded steps
+     */
+    size_t getStepCount() const;
+
+    /**
+     * @brief Gets the encoded replay bytes
+     */
+    const std::vector<uint8_t>& getData() const;
+
+private:
+    void writeInitialBoard(const GameBoard& board);
+    void writeTankRecord(size_t index, const ReplayTankAction& action,
+                         const Tank& tank);
+    void writeShellRecords(const std::vector<Shell>& shells, uint8_t& flags);
+    void writeBoardChanges(const GameBoard& board, uint8_t& flags);
+
+    // Encodes the cell at a position as a cell value byte
+    static uint8_t cellValue(const GameBoard& board, int x, int y);
+
+    std::vector<uint8_t> m_data;
+    ReplayHeader m_header;
+    size_t m_stepCount = 0;
+    bool m_recording = false;
+
+    // State as of the last recorded step
+    std::vector<ReplayTankState> m_tanks;
+    std::vector<ReplayShellState> m_shells;
+    GameBoard m_board;
+    uint64_t m_boardRevision = 0;
+
+    // Per-step scratch buffers, kept to avoid reallocation
+    std::vector<uint8_t> m_stepBuffer;
+    std::vector<uint8_t> m_survivors;
+    std::vector<uint8_t> m_changeBuffer;
+};
+
+} // namespace UserCommon_318835816_211314471
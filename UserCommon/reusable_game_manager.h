@@ -0,0 +1,28 @@
+#pragma once
+
+#include "common/AbstractGameManager.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @class ReusableGameManager
+ * @brief Game manager that can be reset and run again.
+ *
+ * AbstractGameManager only promises one run per instance. Managers that
+ * implement this extension can be kept by the simulator and reused for the
+ * next match, keeping the buffers of their last game. Managers from other
+ * implementations do not derive from this class and are created anew for
+ * every match.
+ */
+class ReusableGameManager : public AbstractGameManager {
+public:
+    /**
+     * @brief Forgets the last game so run can be called again
+     *
+     * Releases the players and tank algorithms of the last game. Allocated
+     * buffers may be kept for the next game.
+     */
+    virtual void reset() = 0;
+};
+
+} // namespace UserCommon_318835816_211314471
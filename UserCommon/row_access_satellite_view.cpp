@@ -0,0 +1,21 @@
+#include <cstring>
+
+#include "row_access_satellite_view.h"
+
+namespace UserCommon_318835816_211314471 {
+
+void RowAccessSatelliteView::copyRow(const SatelliteView& view, size_t y, size_t width, char* out) {
+    const auto* rows = dynamic_cast<const RowAccessSatelliteView*>(&view);
+    if (rows && y < rows->getHeight() && width <= rows->getWidth()) {
+        const char* row = rows->getRow(y);
+        if (row) {
+            std::memcpy(out, row, width);
+            return;
+        }
+    }
+    for (size_t x = 0; x < width; ++x) {
+        out[x] = view.getObjectAt(x, y);
+    }
+}
+
+} // namespace UserCommon_318835816_211314471
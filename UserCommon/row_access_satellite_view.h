@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+#include "common/SatelliteView.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @class RowAccessSatelliteView
+ * @brief Satellite view that can also hand out whole rows of the board.
+ *
+ * SatelliteView only offers one virtual call per cell. Views that keep their
+ * objects in contiguous rows implement this extension, and readers copy a
+ * row at a time instead. Readers must still accept any SatelliteView: views
+ * from other implementations do not derive from this class, and copyRow
+ * falls back to getObjectAt for them.
+ */
+class RowAccessSatelliteView : public SatelliteView {
+public:
+    /**
+     * @brief Gets the number of columns in each row
+     */
+    virtual size_t getWidth() const = 0;
+
+    /**
+     * @brief Gets the number of rows
+     */
+    virtual size_t getHeight() const = 0;
+
+    /**
+     * @brief Gets a row of the board
+     *
+     * @param y The row to get
+     * @return getWidth() characters, the same as getObjectAt(x, y) returns,
+     *  or nullptr if the row has no stored data
+     */
+    virtual const char* getRow(size_t y) const = 0;
+
+    /**
+     * @brief Copies the first cells of a row from any satellite view
+     *
+     * Uses getRow when the view supports it and covers the requested
+     * cells, otherwise calls getObjectAt for each cell.
+     *
+     * @param view The view to read
+     * @param y The row to read
+     * @param width Number of cells to copy
+     * @param out Destination for width characters
+     */
+    static void copyRow(const SatelliteView& view, size_t y, size_t width, char* out);
+};
+
+} // namespace UserCommon_318835816_211314471
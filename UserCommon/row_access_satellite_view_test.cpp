@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+#include "row_access_satellite_view.h"
+#include "satellite_view_impl.h"
+#include "game_board.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace UserCommon_318835816_211314471;
+
+namespace {
+
+// A view that only implements the base interface
+class CellOnlyView : public SatelliteView {
+public:
+    CellOnlyView(std::vector<std::string> rows) : m_rows(std::move(rows)) {}
+
+    char getObjectAt(size_t x, size_t y) const override {
+        if (y >= m_rows.size() || x >= m_rows[y].size()) {
+            return '&';
+        }
+        return m_rows[y][x];
+    }
+
+private:
+    std::vector<std::string> m_rows;
+};
+
+SatelliteViewImpl makeView(const std::vector<std::string>& boardLines, const Point& currentTank) {
+    GameBoard board(boardLines[0].size(), boardLines.size());
+    std::vector<std::pair<int, Point>> tankPositions;
+    board.initialize(boardLines, tankPositions);
+    std::vector<Tank> tanks;
+    std::vector<Shell> shells;
+    return SatelliteViewImpl(board, tanks, shells, currentTank);
+}
+
+} // namespace
+
+TEST(RowAccessSatelliteViewTest, CopyRowMatchesGetObjectAt) {
+    SatelliteViewImpl view = makeView({"#@ ", "   ", " # "}, Point(2, 1));
+
+    for (size_t y = 0; y < 3; ++y) {
+        std::string row(3, '?');
+        RowAccessSatelliteView::copyRow(view, y, row.size(), row.data());
+        for (size_t x = 0; x < 3; ++x) {
+            EXPECT_EQ(row[x], view.getObjectAt(x, y));
+        }
+    }
+    EXPECT_EQ(std::string(view.getRow(1), 3), "  %");
+}
+
+TEST(RowAccessSatelliteViewTest, CopyRowFallsBackForPlainViews) {
+    CellOnlyView view({"#1", "@"});
+    std::string row(2, '?');
+
+    RowAccessSatelliteView::copyRow(view, 0, row.size(), row.data());
+    EXPECT_EQ(row, "#1");
+    RowAccessSatelliteView::copyRow(view, 1, row.size(), row.data());
+    EXPECT_EQ(row, "@&");
+}
+
+TEST(RowAccessSatelliteViewTest, CopyRowOutsideViewReturnsOutOfBounds) {
+    SatelliteViewImpl view = makeView({"##", "##"}, Point(0, 0));
+    EXPECT_EQ(view.getRow(2), nullptr);
+
+    std::string row(3, '?');
+    RowAccessSatelliteView::copyRow(view, 0, row.size(), row.data());
+    EXPECT_EQ(row, "%#&");
+    RowAccessSatelliteView::copyRow(view, 2, row.size(), row.data());
+    EXPECT_EQ(row, "&&&");
+}
+
+TEST(RowAccessSatelliteViewTest, DISABLED_Benchmark_ReadWholeView) {
+    const size_t size = 1000;
+    std::vector<std::string> boardLines(size, std::string(size, ' '));
+    for (size_t i = 0; i < size; ++i) {
+        boardLines[i][(i * 7) % size] = '#';
+    }
+    SatelliteViewImpl view = makeView(boardLines, Point(0, 0));
+    const SatelliteView& base = view;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::string> perCell(size, std::string(size, ' '));
+    for (size_t y = 0; y < size; ++y) {
+        for (size_t x = 0; x < size; ++x) {
+            perCell[y][x] = base.getObjectAt(x, y);
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    std::vector<std::string> perRow(size, std::string(size, ' '));
+    for (size_t y = 0; y < size; ++y) {
+        RowAccessSatelliteView::copyRow(base, y, size, perRow[y].data());
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double cellTime = std::chrono::duration<double>(middle - start).count();
+    double rowTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("per_cell_ms", std::to_string(cellTime * 1000));
+    RecordProperty("per_row_ms", std::to_string(rowTime * 1000));
+
+    EXPECT_EQ(perCell, perRow);
+}
@@ -1,5 +1,6 @@
 #include <cstddef>
 #include <iostream>
+#include <utility>
 
 #include "satellite_view_impl.h"
 
@@ -14,50 +15,78 @@ constexpr char TANK_CHARS[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'}; //
 constexpr char CURRENT_TANK_CHAR = '%';
 constexpr char OUT_OF_BOARD_CHAR = '&';
 
+SatelliteViewImpl::SatelliteViewImpl(std::shared_ptr<const RenderedBoard> rendered,
+    const Point& currentTankPos)
+    : m_rendered(std::move(rendered)),
+      m_width(m_rendered->width), m_height(m_rendered->height),
+      m_currentX(0), m_currentY(m_height) {
+    markCurrentTank(currentTankPos);
+}
+
 SatelliteViewImpl::SatelliteViewImpl(const GameBoard& board,
     const std::vector<Tank>& tanks,
     const std::vector<Shell>& shells,
     const Point& currentTankPos)
-    : m_width(board.getWidth()), m_height(board.getHeight()) {
-    populateBoardData(board, tanks, shells, currentTankPos, true);
-}
+    : SatelliteViewImpl(render(board, tanks, shells), currentTankPos) {}
 
 SatelliteViewImpl::SatelliteViewImpl(const GameBoard& board,
     const std::vector<Tank>& tanks,
     const std::vector<Shell>& shells)
-    : m_width(board.getWidth()), m_height(board.getHeight()) {
-    populateBoardData(board, tanks, shells, Point(-1, -1), false);
-}
+    : SatelliteViewImpl(render(board, tanks, shells), Point(-1, -1)) {}
 
 char SatelliteViewImpl::getObjectAt(size_t x, size_t y) const {
     if (x >= m_width || y >= m_height) {
         return OUT_OF_BOARD_CHAR;
     }
-    return m_boardData[y][x];
+    if (y == m_currentY && x == m_currentX) {
+        return CURRENT_TANK_CHAR;
+    }
+    return m_rendered->cells[y * m_width + x];
 }
 
-void SatelliteViewImpl::populateBoardData(const GameBoard& board,
-                                          const std::vector<Tank>& tanks,
-                                          const std::vector<Shell>& shells,
-                                          const Point& currentTankPos,
-                                          bool hasCurrentTank) {
-    // Initialize board data with correct dimensions
-    m_boardData.resize(m_height, std::vector<char>(m_width, EMPTY_CHAR));
-    
+size_t SatelliteViewImpl::getWidth() const {
+    return m_width;
+}
+
+size_t SatelliteViewImpl::getHeight() const {
+    return m_height;
+}
+
+const char* SatelliteViewImpl::getRow(size_t y) const {
+    if (y >= m_height) {
+        return nullptr;
+    }
+    if (y == m_currentY) {
+        return m_currentRow.data();
+    }
+    return m_rendered->cells.data() + y * m_width;
+}
+
+std::shared_ptr<const SatelliteViewImpl::RenderedBoard> SatelliteViewImpl::render(
+    const GameBoard& board,
+    const std::vector<Tank>& tanks,
+    const std::vector<Shell>& shells) {
+    auto rendered = std::make_shared<RenderedBoard>();
+    const size_t width = board.getWidth();
+    const size_t height = board.getHeight();
+    rendered->width = width;
+    rendered->height = height;
+    rendered->cells.assign(width * height, EMPTY_CHAR);
+    std::vector<char>& cells = rendered->cells;
+
     // First, populate the board with walls and mines
-    for (size_t y = 0; y < m_height; ++y) {
-        for (size_t x = 0; x < m_width; ++x) {
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
             GameBoard::CellType cellType = board.getCellType(x, y);
             switch (cellType) {
                 case GameBoard::CellType::Wall:
-                    m_boardData[y][x] = WALL_CHAR;
+                    cells[y * width + x] = WALL_CHAR;
                     break;
                 case GameBoard::CellType::Mine:
-                    m_boardData[y][x] = MINE_CHAR;
+                    cells[y * width + x] = MINE_CHAR;
                     break;
                 case GameBoard::CellType::Empty:
                 default:
-                    m_boardData[y][x] = EMPTY_CHAR;
                     break;
             }
         }
@@ -68,9 +97,9 @@ void SatelliteViewImpl::populateBoardData(const GameBoard& board,
         if (shell.isDestroyed()) continue;
         int shell_x = shell.getPosition().getX();
         int shell_y = shell.getPosition().getY();
-        if (shell_x >= 0 && shell_x < static_cast<int>(m_width) && 
-            shell_y >= 0 && shell_y < static_cast<int>(m_height)) {
-            m_boardData[shell_y][shell_x] = SHELL_CHAR;
+        if (shell_x >= 0 && shell_x < static_cast<int>(width) && 
+            shell_y >= 0 && shell_y < static_cast<int>(height)) {
+            cells[shell_y * width + shell_x] = SHELL_CHAR;
         }
     }
     
@@ -79,24 +108,29 @@ void SatelliteViewImpl::populateBoardData(const GameBoard& board,
         if (tank.isDestroyed()) continue;
         int tank_x = tank.getPosition().getX();
         int tank_y = tank.getPosition().getY();
-        if (tank_x >= 0 && tank_x < static_cast<int>(m_width) && 
-            tank_y >= 0 && tank_y < static_cast<int>(m_height)) {
+        if (tank_x >= 0 && tank_x < static_cast<int>(width) && 
+            tank_y >= 0 && tank_y < static_cast<int>(height)) {
             int playerId = tank.getPlayerId();
             if (playerId >= 1 && playerId <= 9) {
-                m_boardData[tank_y][tank_x] = TANK_CHARS[playerId - 1];
+                cells[tank_y * width + tank_x] = TANK_CHARS[playerId - 1];
             }
         }
     }
-    
-    // Mark the current tank position with '%' only if we have a current tank
-    if (hasCurrentTank) {
-        int current_x = currentTankPos.getX();
-        int current_y = currentTankPos.getY();
-        if (current_x >= 0 && current_x < static_cast<int>(m_width) && 
-            current_y >= 0 && current_y < static_cast<int>(m_height)) {
-            m_boardData[current_y][current_x] = CURRENT_TANK_CHAR;
-        }
+    return rendered;
+}
+
+void SatelliteViewImpl::markCurrentTank(const Point& currentTankPos) {
+    int current_x = currentTankPos.getX();
+    int current_y = currentTankPos.getY();
+    if (current_x < 0 || current_x >= static_cast<int>(m_width) ||
+        current_y < 0 || current_y >= static_cast<int>(m_height)) {
+        return;
     }
+    m_currentX = static_cast<size_t>(current_x);
+    m_currentY = static_cast<size_t>(current_y);
+    const char* row = m_rendered->cells.data() + m_currentY * m_width;
+    m_currentRow.assign(row, row + m_width);
+    m_currentRow[m_currentX] = CURRENT_TANK_CHAR;
 }
 
-} // namespace UserCommon_318835816_211314471 
\ No newline at end of file
+} // namespace UserCommon_318835816_211314471
@@ -1,12 +1,13 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "game_board.h"
 #include "objects/shell.h"
 #include "objects/tank.h"
 #include "utils/point.h"
-#include "SatelliteView.h"
+#include "row_access_satellite_view.h"
 
 namespace UserCommon_318835816_211314471 {
 
@@ -16,9 +17,41 @@ namespace UserCommon_318835816_211314471 {
  *
  * This class exposes the current state of the board, tanks, and shells as characters for algorithms.
  * It does not allow modification and does not expose references to underlying objects.
+ * Rows can be read whole through RowAccessSatelliteView.
+ *
+ * The board is rendered once into a shared RenderedBoard. Views of the same
+ * state for different tanks share that rendering and only keep their own
+ * copy of the row holding the '%' current tank marker.
  */
-class SatelliteViewImpl : public SatelliteView {
+class SatelliteViewImpl : public RowAccessSatelliteView {
 public:
+    /**
+     * @brief Board, shells and tanks rendered as characters, row by row
+     */
+    struct RenderedBoard {
+        size_t width = 0;
+        size_t height = 0;
+        std::vector<char> cells; // width * height characters
+    };
+
+    /**
+     * @brief Renders game state for sharing between several views
+     * @param board Reference to the game board
+     * @param tanks Reference to a vector of tanks (const)
+     * @param shells Reference to a vector of shells (const)
+     * @return The rendered state, without any current tank marking
+     */
+    static std::shared_ptr<const RenderedBoard> render(const GameBoard& board,
+                                                       const std::vector<Tank>& tanks,
+                                                       const std::vector<Shell>& shells);
+
+    /**
+     * @brief Constructs a SatelliteViewImpl over already rendered state
+     * @param rendered The shared rendering to view
+     * @param currentTankPos The position of the current tank (to be marked with '%')
+     */
+    SatelliteViewImpl(std::shared_ptr<const RenderedBoard> rendered, const Point& currentTankPos);
+
     /**
      * @brief Constructs a SatelliteViewImpl
      * @param board Reference to the game board
@@ -49,24 +82,23 @@ public:
      */
     char getObjectAt(size_t x, size_t y) const override;
 
+    size_t getWidth() const override;
+    size_t getHeight() const override;
+    const char* getRow(size_t y) const override;
+
 private:
     /**
-     * @brief Populates the board data structure from game state
-     * @param board Reference to the game board
-     * @param tanks Reference to a vector of tanks (const)
-     * @param shells Reference to a vector of shells (const)
-     * @param currentTankPos The position of the current tank (optional)
-     * @param hasCurrentTank Whether to mark current tank with '%'
+     * @brief Marks the current tank position with '%' if it is on the board
+     * @param currentTankPos The position of the current tank
      */
-    void populateBoardData(const GameBoard& board,
-                          const std::vector<Tank>& tanks,
-                          const std::vector<Shell>& shells,
-                          const Point& currentTankPos,
-                          bool hasCurrentTank);
+    void markCurrentTank(const Point& currentTankPos);
 
-    std::vector<std::vector<char>> m_boardData; // Owns the game state data
+    std::shared_ptr<const RenderedBoard> m_rendered;
     size_t m_width;
     size_t m_height;
+    size_t m_currentX; // Current tank column, only valid if m_currentY < m_height
+    size_t m_currentY; // Current tank row, m_height if no tank is marked
+    std::vector<char> m_currentRow; // Copy of row m_currentY with the marker
 };
 
-} // namespace UserCommon_318835816_211314471 
\ No newline at end of file
+} // namespace UserCommon_318835816_211314471 
@@ -4,6 +4,7 @@
 #include "objects/tank.h"
 #include "objects/shell.h"
 #include "utils/point.h"
+#include <chrono>
 #include <vector>
 #include <string>
 
@@ -138,4 +139,78 @@ TEST(SatelliteViewImplTest, DestroyedShellOverMineReturnsMine) {
     SatelliteViewImpl view(board, tanks, shells, currentTankPos);
     // Should return mine character, not shell
     EXPECT_EQ(view.getObjectAt(0, 0), '@');
-} 
\ No newline at end of file
+} 
+TEST(SatelliteViewImplTest, ViewsShareOneRendering) {
+    std::vector<std::string> boardLines = {
+        "#  ",
+        " 1 ",
+        "  2"
+    };
+    GameBoard board(3, 3);
+    std::vector<std::pair<int, Point>> tankPositions;
+    board.initialize(boardLines, tankPositions);
+    std::vector<Tank> tanks = {
+        Tank(1, Point(1, 1), Direction::Left),
+        Tank(2, Point(2, 2), Direction::Right)
+    };
+    std::vector<Shell> shells;
+
+    auto rendered = SatelliteViewImpl::render(board, tanks, shells);
+    SatelliteViewImpl first(rendered, Point(1, 1));
+    SatelliteViewImpl second(rendered, Point(2, 2));
+
+    // Each view marks only its own tank, the shared rendering is unchanged
+    EXPECT_EQ(first.getObjectAt(1, 1), '%');
+    EXPECT_EQ(first.getObjectAt(2, 2), '2');
+    EXPECT_EQ(second.getObjectAt(1, 1), '1');
+    EXPECT_EQ(second.getObjectAt(2, 2), '%');
+    EXPECT_EQ(std::string(first.getRow(1), 3), " % ");
+    EXPECT_EQ(std::string(second.getRow(1), 3), " 1 ");
+    EXPECT_EQ(first.getRow(0), second.getRow(0));
+    EXPECT_EQ(std::string(rendered->cells.begin(), rendered->cells.end()), "#   1   2");
+}
+
+TEST(SatelliteViewImplTest, DISABLED_Benchmark_ManyTanksOneStep) {
+    const size_t size = 500;
+    const int tankCount = 16;
+    const int steps = 10;
+    std::vector<std::string> boardLines(size, std::string(size, ' '));
+    for (size_t i = 0; i < size; ++i) {
+        boardLines[i][(i * 7) % size] = '#';
+    }
+    GameBoard board(size, size);
+    std::vector<std::pair<int, Point>> tankPositions;
+    board.initialize(boardLines, tankPositions);
+    std::vector<Tank> tanks;
+    for (int i = 0; i < tankCount; ++i) {
+        tanks.emplace_back(i % 2 + 1, Point(i * 3 + 1, i * 5 + 2), Direction::Up);
+    }
+    std::vector<Shell> shells;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t separateMarks = 0;
+    for (int step = 0; step < steps; ++step) {
+        for (const auto& tank : tanks) {
+            SatelliteViewImpl view(board, tanks, shells, tank.getPosition());
+            separateMarks += view.getObjectAt(tank.getPosition().getX(), tank.getPosition().getY()) == '%';
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    size_t sharedMarks = 0;
+    for (int step = 0; step < steps; ++step) {
+        auto rendered = SatelliteViewImpl::render(board, tanks, shells);
+        for (const auto& tank : tanks) {
+            SatelliteViewImpl view(rendered, tank.getPosition());
+            sharedMarks += view.getObjectAt(tank.getPosition().getX(), tank.getPosition().getY()) == '%';
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double separateTime = std::chrono::duration<double>(middle - start).count();
+    double sharedTime = std::chrono::duration<double>(end - middle).count();
+    RecordProperty("per_view_ms", std::to_string(separateTime * 1000));
+    RecordProperty("shared_ms", std::to_string(sharedTime * 1000));
+
+    EXPECT_EQ(separateMarks, static_cast<size_t>(steps * tankCount));
+    EXPECT_EQ(sharedMarks, separateMarks);
+}
@@ -36,13 +36,45 @@ static constexpr Direction ALL_DIRECTIONS[] = {
   Direction::Down, Direction::DownLeft, Direction::Left, Direction::UpLeft
 };
 
+/**
+ * @brief Number of directions, the size of the lookup tables below.
+ */
+static constexpr int DIRECTION_COUNT = 8;
+
+/**
+ * @brief Per-direction x and y step, indexed by the Direction value.
+ *
+ * Hot loops index these directly instead of calling getDirectionDelta.
+ */
+static constexpr int DIRECTION_DELTA_X[DIRECTION_COUNT] = {0, 1, 1, 1, 0, -1, -1, -1};
+static constexpr int DIRECTION_DELTA_Y[DIRECTION_COUNT] = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+/**
+ * @brief Per-direction name, indexed by the Direction value.
+ */
+static constexpr const char* DIRECTION_NAMES[DIRECTION_COUNT] = {
+  "Up", "UpRight", "Right", "DownRight", "Down", "DownLeft", "Left", "UpLeft"
+};
+
+/**
+ * @brief Checks that a value is one of the 8 directions.
+ *
+ * @param direction The direction to check
+ * @return true if the direction can index the lookup tables
+ */
+constexpr bool isValidDirection(Direction direction) {
+  return static_cast<unsigned>(direction) < static_cast<unsigned>(DIRECTION_COUNT);
+}
+
 /**
  * @brief Converts a Direction enum value to its string representation.
  * 
  * @param direction The direction to convert
  * @return String representation of the direction (e.g., "Up", "UpRight", etc.)
  */
-std::string directionToString(Direction direction);
+inline std::string directionToString(Direction direction) {
+  return isValidDirection(direction) ? DIRECTION_NAMES[static_cast<int>(direction)] : "Unknown";
+}
 
 /**
  * @brief Rotates a direction counter-clockwise.
@@ -52,7 +84,10 @@ std::string directionToString(Direction direction);
  *  degrees (1/8 turn)
  * @return The new direction after rotation
  */
-Direction getRotateLeftDirection(Direction direction, bool quarterTurn = false);
+constexpr Direction getRotateLeftDirection(Direction direction, bool quarterTurn = false) {
+  // Directions are ordered clockwise, so rotating is modular arithmetic on the value
+  return static_cast<Direction>((static_cast<int>(direction) + (quarterTurn ? 6 : 7)) % DIRECTION_COUNT);
+}
 
 /**
  * @brief Rotates a direction clockwise.
@@ -62,7 +97,9 @@ Direction getRotateLeftDirection(Direction direction, bool quarterTurn = false);
  *  degrees (1/8 turn)
  * @return The new direction after rotation
  */
-Direction getRotateRightDirection(Direction direction, bool quarterTurn = false);
+constexpr Direction getRotateRightDirection(Direction direction, bool quarterTurn = false) {
+  return static_cast<Direction>((static_cast<int>(direction) + (quarterTurn ? 2 : 1)) % DIRECTION_COUNT);
+}
 
 /**
  * @brief Gets the delta movement Point for a given direction.
@@ -71,7 +108,13 @@ Direction getRotateRightDirection(Direction direction, bool quarterTurn = false)
  * @param magnitude The magnitude of movement (default 1)
  * @return A Point representing the delta movement in x,y coordinates
  */
-Point getDirectionDelta(Direction direction, int magnitude = 1);
+constexpr Point getDirectionDelta(Direction direction, int magnitude = 1) {
+  if (!isValidDirection(direction)) {
+    return Point(0, 0);
+  }
+  const int index = static_cast<int>(direction);
+  return Point(DIRECTION_DELTA_X[index] * magnitude, DIRECTION_DELTA_Y[index] * magnitude);
+}
 
 /**
  * @brief Calculates the direction needed to move from one point to another
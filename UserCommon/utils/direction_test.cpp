@@ -185,3 +185,21 @@ TEST(DirectionTest, GetDirectionToPoint_NonAdjacentPoints) {
       EXPECT_FALSE(result.has_value());
   }
 }
+
+TEST(DirectionTest, EvaluatedAtCompileTime) {
+    static_assert(getDirectionDelta(Direction::DownLeft) == Point(-1, 1));
+    static_assert(getDirectionDelta(Direction::Right, 3) == Point(3, 0));
+    static_assert(getRotateLeftDirection(Direction::Up) == Direction::UpLeft);
+    static_assert(getRotateRightDirection(Direction::Left, true) == Direction::Up);
+    SUCCEED();
+}
+
+TEST(DirectionTest, TablesMatchDirectionDelta) {
+    for (const Direction& dir : ALL_DIRECTIONS) {
+        const int index = static_cast<int>(dir);
+        EXPECT_EQ(Point(DIRECTION_DELTA_X[index], DIRECTION_DELTA_Y[index]), getDirectionDelta(dir));
+        EXPECT_EQ(directionToString(dir), DIRECTION_NAMES[index]);
+    }
+    EXPECT_EQ(directionToString(static_cast<Direction>(8)), "Unknown");
+    EXPECT_EQ(getDirectionDelta(static_cast<Direction>(8)), Point(0, 0));
+}
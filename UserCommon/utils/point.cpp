@@ -4,32 +4,6 @@
 
 namespace UserCommon_318835816_211314471 {
 
-Point::Point() : m_x(0), m_y(0) {}
-Point::Point(int x, int y) : m_x(x), m_y(y) {}
-
-bool Point::operator==(const Point& other) const {
-    return m_x == other.m_x && m_y == other.m_y;
-}
-
-bool Point::operator!=(const Point& other) const {
-    return !(*this == other);
-}
-
-Point Point::operator+(const Point& other) const {
-    return Point(m_x + other.m_x, m_y + other.m_y);
-}
-
-Point Point::operator-(const Point& other) const {
-    return Point(m_x - other.m_x, m_y - other.m_y);
-}
-
-bool Point::operator<(const Point& other) const {
-  if (m_x != other.m_x) {
-      return m_x < other.m_x;
-  }
-  return m_y < other.m_y;
-}
-
 std::string Point::toString() const {
   return "(" + std::to_string(m_x) + "," + std::to_string(m_y) + ")";
 }
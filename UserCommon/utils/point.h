@@ -20,7 +20,7 @@ public:
      * 
      * Initializes x and y to zero.
      */
-    Point();
+    constexpr Point() : m_x(0), m_y(0) {}
 
     /**
      * @brief Constructs a point with specific coordinates
@@ -28,18 +28,28 @@ public:
      * @param x The x-coordinate
      * @param y The y-coordinate
      */
-    Point(int x, int y);
+    constexpr Point(int x, int y) : m_x(x), m_y(y) {}
     
     // Getters
-    int getX() const { return m_x; }
-    int getY() const { return m_y; }
+    constexpr int getX() const { return m_x; }
+    constexpr int getY() const { return m_y; }
     
-    // Operators
-    bool operator==(const Point& other) const;
-    bool operator!=(const Point& other) const;
-    Point operator+(const Point& other) const;
-    Point operator-(const Point& other) const;
-    bool operator<(const Point& other) const;
+    // Operators, inline since they run in every board walk
+    constexpr bool operator==(const Point& other) const {
+        return m_x == other.m_x && m_y == other.m_y;
+    }
+    constexpr bool operator!=(const Point& other) const {
+        return !(*this == other);
+    }
+    constexpr Point operator+(const Point& other) const {
+        return Point(m_x + other.m_x, m_y + other.m_y);
+    }
+    constexpr Point operator-(const Point& other) const {
+        return Point(m_x - other.m_x, m_y - other.m_y);
+    }
+    constexpr bool operator<(const Point& other) const {
+        return m_x != other.m_x ? m_x < other.m_x : m_y < other.m_y;
+    }
 
     /**
      * @brief Converts the point to a string representation
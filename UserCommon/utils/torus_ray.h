@@ -0,0 +1,87 @@
+#pragma once
+
+#include "direction.h"
+#include "point.h"
+
+namespace UserCommon_318835816_211314471 {
+
+/**
+ * @brief Wraps one coordinate onto [0, size).
+ *
+ * Values at most one board length off the board, which is all a step of
+ * one cell can produce, are wrapped with a conditional add or subtract.
+ * Anything further out falls back to a modulo.
+ *
+ * @param value The coordinate to wrap
+ * @param size The board length along the coordinate, greater than zero
+ * @return The coordinate in [0, size)
+ */
+constexpr int wrapAxis(int value, int size) {
+  if (value < 0) {
+    value += size;
+  } else if (value >= size) {
+    value -= size;
+  }
+  if (static_cast<unsigned>(value) >= static_cast<unsigned>(size)) {
+    value %= size;
+    if (value < 0) {
+      value += size;
+    }
+  }
+  return value;
+}
+
+/**
+ * @class TorusRay
+ * @brief Walks a ray across a wrapping board one cell at a time.
+ *
+ * The ray starts on the board and every step moves one cell in its
+ * direction, so wrapping back onto the board only takes a comparison per
+ * axis and never a modulo. Used by loops that follow shells or lines of
+ * sight cell by cell.
+ */
+class TorusRay {
+public:
+  /**
+   * @brief Starts a ray
+   * @param start The first cell, must be on the board
+   * @param direction The direction to walk in
+   * @param width The board width, greater than zero
+   * @param height The board height, greater than zero
+   */
+  constexpr TorusRay(const Point& start, Direction direction, int width, int height)
+      : m_x(start.getX()), m_y(start.getY()),
+        m_dx(DIRECTION_DELTA_X[static_cast<int>(direction)]),
+        m_dy(DIRECTION_DELTA_Y[static_cast<int>(direction)]),
+        m_width(width), m_height(height) {}
+
+  constexpr Point operator*() const { return Point(m_x, m_y); }
+  constexpr int getX() const { return m_x; }
+  constexpr int getY() const { return m_y; }
+
+  /**
+   * @brief Gets the row-major index of the current cell
+   */
+  constexpr int getIndex() const { return m_y * m_width + m_x; }
+
+  /**
+   * @brief Moves to the next cell of the ray
+   */
+  constexpr TorusRay& operator++() {
+    m_x += m_dx;
+    m_y += m_dy;
+    m_x = m_x < 0 ? m_x + m_width : (m_x >= m_width ? m_x - m_width : m_x);
+    m_y = m_y < 0 ? m_y + m_height : (m_y >= m_height ? m_y - m_height : m_y);
+    return *this;
+  }
+
+private:
+  int m_x;
+  int m_y;
+  int m_dx;
+  int m_dy;
+  int m_width;
+  int m_height;
+};
+
+} // namespace UserCommon_318835816_211314471
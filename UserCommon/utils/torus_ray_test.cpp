@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+#include "utils/torus_ray.h"
+
+using namespace UserCommon_318835816_211314471;
+
+TEST(TorusRayTest, WrapAxis) {
+    EXPECT_EQ(wrapAxis(0, 5), 0);
+    EXPECT_EQ(wrapAxis(4, 5), 4);
+    EXPECT_EQ(wrapAxis(-1, 5), 4);
+    EXPECT_EQ(wrapAxis(5, 5), 0);
+    // Beyond one board length falls back to a modulo
+    EXPECT_EQ(wrapAxis(12, 5), 2);
+    EXPECT_EQ(wrapAxis(-7, 5), 3);
+    EXPECT_EQ(wrapAxis(-10, 5), 0);
+    static_assert(wrapAxis(-1, 3) == 2);
+}
+
+TEST(TorusRayTest, WalksAcrossEdges) {
+    TorusRay ray(Point(3, 0), Direction::UpRight, 4, 3);
+    EXPECT_EQ(*ray, Point(3, 0));
+    EXPECT_EQ(*++ray, Point(0, 2));
+    EXPECT_EQ(ray.getIndex(), 8);
+    EXPECT_EQ(*++ray, Point(1, 1));
+    EXPECT_EQ(*++ray, Point(2, 0));
+}
+
+TEST(TorusRayTest, ReturnsToStartAfterFullLoop) {
+    TorusRay ray(Point(1, 2), Direction::Left, 5, 4);
+    for (int step = 0; step < 5; ++step) {
+        ++ray;
+    }
+    EXPECT_EQ(*ray, Point(1, 2));
+}
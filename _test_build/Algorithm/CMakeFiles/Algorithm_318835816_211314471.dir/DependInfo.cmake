@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Algorithm/basic_player.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/basic_player.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/basic_player.cpp.o.d"
+  "/root/repo/Algorithm/basic_tank_algorithm.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/basic_tank_algorithm.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/basic_tank_algorithm.cpp.o.d"
+  "/root/repo/Algorithm/battle_info_impl.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/battle_info_impl.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/battle_info_impl.cpp.o.d"
+  "/root/repo/Algorithm/distance_field.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/distance_field.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/distance_field.cpp.o.d"
+  "/root/repo/Algorithm/incremental_path_planner.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/incremental_path_planner.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/incremental_path_planner.cpp.o.d"
+  "/root/repo/Algorithm/line_of_sight_table.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/line_of_sight_table.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/line_of_sight_table.cpp.o.d"
+  "/root/repo/Algorithm/offensive_battle_info.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_battle_info.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_battle_info.cpp.o.d"
+  "/root/repo/Algorithm/offensive_player.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_player.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_player.cpp.o.d"
+  "/root/repo/Algorithm/offensive_tank_algorithm.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_tank_algorithm.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/offensive_tank_algorithm.cpp.o.d"
+  "/root/repo/Algorithm/path_finder.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/path_finder.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/path_finder.cpp.o.d"
+  "/root/repo/Algorithm/shared_game_board.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/shared_game_board.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/shared_game_board.cpp.o.d"
+  "/root/repo/Algorithm/shell_danger_map.cpp" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/shell_danger_map.cpp.o" "gcc" "Algorithm/CMakeFiles/Algorithm_318835816_211314471.dir/shell_danger_map.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
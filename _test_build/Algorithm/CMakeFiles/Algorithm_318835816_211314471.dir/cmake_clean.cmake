@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "/root/repo/Algorithm/Algorithm_318835816_211314471.pdb"
+  "/root/repo/Algorithm/Algorithm_318835816_211314471.so"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/basic_player.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/basic_player.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/basic_tank_algorithm.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/basic_tank_algorithm.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/battle_info_impl.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/battle_info_impl.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/distance_field.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/distance_field.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/incremental_path_planner.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/incremental_path_planner.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/line_of_sight_table.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/line_of_sight_table.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_battle_info.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_battle_info.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_player.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_player.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_tank_algorithm.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/offensive_tank_algorithm.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/path_finder.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/path_finder.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/shared_game_board.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/shared_game_board.cpp.o.d"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/shell_danger_map.cpp.o"
+  "CMakeFiles/Algorithm_318835816_211314471.dir/shell_danger_map.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Algorithm_318835816_211314471.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Algorithm/basic_player.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_player.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_player.cpp.o.d"
+  "/root/repo/Algorithm/basic_player_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_player_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_player_test.cpp.o.d"
+  "/root/repo/Algorithm/basic_tank_algorithm.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_tank_algorithm.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_tank_algorithm.cpp.o.d"
+  "/root/repo/Algorithm/basic_tank_algorithm_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_tank_algorithm_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/basic_tank_algorithm_test.cpp.o.d"
+  "/root/repo/Algorithm/battle_info_impl.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/battle_info_impl.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/battle_info_impl.cpp.o.d"
+  "/root/repo/Algorithm/battle_info_impl_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/battle_info_impl_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/battle_info_impl_test.cpp.o.d"
+  "/root/repo/Algorithm/distance_field.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/distance_field.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/distance_field.cpp.o.d"
+  "/root/repo/Algorithm/distance_field_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/distance_field_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/distance_field_test.cpp.o.d"
+  "/root/repo/Algorithm/incremental_path_planner.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/incremental_path_planner.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/incremental_path_planner.cpp.o.d"
+  "/root/repo/Algorithm/incremental_path_planner_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/incremental_path_planner_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/incremental_path_planner_test.cpp.o.d"
+  "/root/repo/Algorithm/line_of_sight_table.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/line_of_sight_table.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/line_of_sight_table.cpp.o.d"
+  "/root/repo/Algorithm/line_of_sight_table_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/line_of_sight_table_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/line_of_sight_table_test.cpp.o.d"
+  "/root/repo/Algorithm/offensive_battle_info.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_battle_info.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_battle_info.cpp.o.d"
+  "/root/repo/Algorithm/offensive_battle_info_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_battle_info_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_battle_info_test.cpp.o.d"
+  "/root/repo/Algorithm/offensive_player.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_player.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_player.cpp.o.d"
+  "/root/repo/Algorithm/offensive_player_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_player_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_player_test.cpp.o.d"
+  "/root/repo/Algorithm/offensive_tank_algorithm.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm.cpp.o.d"
+  "/root/repo/Algorithm/offensive_tank_algorithm_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm_test.cpp.o.d"
+  "/root/repo/Algorithm/path_finder.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/path_finder.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/path_finder.cpp.o.d"
+  "/root/repo/Algorithm/path_finder_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/path_finder_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/path_finder_test.cpp.o.d"
+  "/root/repo/Algorithm/shared_game_board.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/shared_game_board.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/shared_game_board.cpp.o.d"
+  "/root/repo/Algorithm/shared_game_board_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/shared_game_board_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/shared_game_board_test.cpp.o.d"
+  "/root/repo/Algorithm/shell_danger_map.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/shell_danger_map.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/shell_danger_map.cpp.o.d"
+  "/root/repo/Algorithm/shell_danger_map_test.cpp" "Algorithm/CMakeFiles/algorithm_tests.dir/shell_danger_map_test.cpp.o" "gcc" "Algorithm/CMakeFiles/algorithm_tests.dir/shell_danger_map_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,58 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/tests/algorithm_tests"
+  "/root/repo/build/tests/algorithm_tests.pdb"
+  "CMakeFiles/algorithm_tests.dir/basic_player.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/basic_player.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/basic_player_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/basic_player_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/basic_tank_algorithm.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/basic_tank_algorithm.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/basic_tank_algorithm_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/basic_tank_algorithm_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/battle_info_impl.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/battle_info_impl.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/battle_info_impl_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/battle_info_impl_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/distance_field.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/distance_field.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/distance_field_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/distance_field_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/incremental_path_planner.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/incremental_path_planner.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/incremental_path_planner_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/incremental_path_planner_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/line_of_sight_table.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/line_of_sight_table.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/line_of_sight_table_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/line_of_sight_table_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_battle_info.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_battle_info.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_battle_info_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_battle_info_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_player.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_player.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_player_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_player_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/offensive_tank_algorithm_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/path_finder.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/path_finder.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/path_finder_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/path_finder_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/shared_game_board.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/shared_game_board.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/shared_game_board_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/shared_game_board_test.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/shell_danger_map.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/shell_danger_map.cpp.o.d"
+  "CMakeFiles/algorithm_tests.dir/shell_danger_map_test.cpp.o"
+  "CMakeFiles/algorithm_tests.dir/shell_danger_map_test.cpp.o.d"
+  "algorithm_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/algorithm_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
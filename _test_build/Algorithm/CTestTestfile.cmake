@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Algorithm
+# Build directory: /root/repo/_test_build/Algorithm
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/Algorithm/algorithm_tests[1]_include.cmake")
+add_test(AlgorithmTests "/root/repo/build/tests/algorithm_tests")
+set_tests_properties(AlgorithmTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Algorithm/CMakeLists.txt;59;add_test;/root/repo/Algorithm/CMakeLists.txt;0;")
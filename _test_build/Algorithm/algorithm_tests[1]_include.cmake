@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/Algorithm/algorithm_tests[1]_tests.cmake")
+  include("/root/repo/_test_build/Algorithm/algorithm_tests[1]_tests.cmake")
+else()
+  add_test(algorithm_tests_NOT_BUILT algorithm_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,249 @@
+add_test([=[BasicPlayerTest.PopulatesBoardCellTypes]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.PopulatesBoardCellTypes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.PopulatesBoardCellTypes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicPlayerTest.PopulatesTankAndShellPositions]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.PopulatesTankAndShellPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.PopulatesTankAndShellPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicPlayerTest.UpdateTankWithBattleInfoCallsAlgorithm]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.UpdateTankWithBattleInfoCallsAlgorithm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.UpdateTankWithBattleInfoCallsAlgorithm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicPlayerTest.PopulatesOwnTankPosition]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.PopulatesOwnTankPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.PopulatesOwnTankPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicPlayerTest.NoOwnTankPositionIfNotPresent]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.NoOwnTankPositionIfNotPresent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.NoOwnTankPositionIfNotPresent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicPlayerTest.PassesGameShellsToBattleInfo]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicPlayerTest.PassesGameShellsToBattleInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicPlayerTest.PassesGameShellsToBattleInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateBattleInfo_UpdatesGameBoardAndObjects]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateBattleInfo_UpdatesGameBoardAndObjects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateBattleInfo_UpdatesGameBoardAndObjects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetLineOfSightDirection_DirectLine]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetLineOfSightDirection_DirectLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetLineOfSightDirection_DirectLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetLineOfSightDirection_BlockedLine]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetLineOfSightDirection_BlockedLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetLineOfSightDirection_BlockedLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_CorrectDirections]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_CorrectDirections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_CorrectDirections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBlocking]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBlocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBlocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_FriendlyTankBlocking]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_FriendlyTankBlocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_FriendlyTankBlocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankNotInPath]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankNotInPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankNotInPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankAtDestination]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankAtDestination]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankAtDestination]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBehindDestination]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBehindDestination]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBehindDestination]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_NoShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_NoShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_NoShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightAndClose]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightAndClose]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightAndClose]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightButTooFar]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightButTooFar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightButTooFar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellBlockedByWall]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_ShellBlockedByWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_ShellBlockedByWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_MultipleShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_MultipleShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_MultipleShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_NoShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_NoShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_NoShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightAndClose]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightAndClose]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightAndClose]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightButTooFar]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightButTooFar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightButTooFar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByWall]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_MultipleShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_MultipleShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_MultipleShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_SafePosition]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_SafePosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_SafePosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_Wall]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_Wall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_Wall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_Mine]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_Mine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_Mine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_EnemyTank]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_EnemyTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_EnemyTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_FriendlyTank]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_FriendlyTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_FriendlyTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsPositionSafe_ShellDanger]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsPositionSafe_ShellDanger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsPositionSafe_ShellDanger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafePositions_AllSafe]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafePositions_AllSafe]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafePositions_AllSafe]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafePositions_SomeWalls]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafePositions_SomeWalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafePositions_SomeWalls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafePositions_SomeMines]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafePositions_SomeMines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafePositions_SomeMines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafePositions_SomeTanks]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafePositions_SomeTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafePositions_SomeTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafePositions_ShellDanger]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafePositions_ShellDanger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafePositions_ShellDanger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafeMoveOption_AlreadySafe]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafeMoveOption_AlreadySafe]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafeMoveOption_AlreadySafe]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafeMoveOption_Forward]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafeMoveOption_Forward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafeMoveOption_Forward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafeMoveOption_RotateLeft]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafeMoveOption_RotateLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafeMoveOption_RotateLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafeMoveOption_RotateRight]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafeMoveOption_RotateRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafeMoveOption_RotateRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetSafeMoveOptions_Multiple]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetSafeMoveOptions_Multiple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetSafeMoveOptions_Multiple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetActionToSafePosition_Forward]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetActionToSafePosition_Forward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetActionToSafePosition_Forward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetActionToSafePosition_MinimalRotation]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetActionToSafePosition_MinimalRotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetActionToSafePosition_MinimalRotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetActionToSafePosition_NoSafe]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetActionToSafePosition_NoSafe]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetActionToSafePosition_NoSafe]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetActionToSafePosition_ChooseSafeFromShell]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetActionToSafePosition_ChooseSafeFromShell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetActionToSafePosition_ChooseSafeFromShell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyInCurrentDirection]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CanShootEnemy_EnemyInCurrentDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyInCurrentDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyNotInCurrentDirection]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CanShootEnemy_EnemyNotInCurrentDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyNotInCurrentDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyBlockedByWall]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CanShootEnemy_EnemyBlockedByWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CanShootEnemy_EnemyBlockedByWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CanShootEnemy_MultipleEnemies_OneInDirection]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CanShootEnemy_MultipleEnemies_OneInDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CanShootEnemy_MultipleEnemies_OneInDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.CanShootEnemy_NoEnemies]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.CanShootEnemy_NoEnemies]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.CanShootEnemy_NoEnemies]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateState_MoveForward]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateState_MoveForward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateState_MoveForward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateState_RotateLeft90]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateState_RotateLeft90]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateState_RotateLeft90]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateState_RotateRight90]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateState_RotateRight90]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateState_RotateRight90]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateState_Shoot]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateState_Shoot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateState_Shoot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateBattleInfo_FirstUpdateSetsGameShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateBattleInfo_FirstUpdateSetsGameShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateBattleInfo_FirstUpdateSetsGameShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.UpdateState_DoNothing]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.UpdateState_DoNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.UpdateState_DoNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_NoRotation]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_NoRotation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_NoRotation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_45DegreeRight]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_45DegreeRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_45DegreeRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_45DegreeLeft]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_45DegreeLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_45DegreeLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_90DegreeRight]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_90DegreeRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_90DegreeRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_90DegreeLeft]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_90DegreeLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_90DegreeLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetRotationToDirection_FallbackShortest]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetRotationToDirection_FallbackShortest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetRotationToDirection_FallbackShortest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsTankAtPosition_EnemyTank]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsTankAtPosition_EnemyTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsTankAtPosition_EnemyTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsTankAtPosition_FriendlyTank]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsTankAtPosition_FriendlyTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsTankAtPosition_FriendlyTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsTankAtPosition_NoTanks]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsTankAtPosition_NoTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsTankAtPosition_NoTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.GetLineOfSightDirection_TankBlocking]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.GetLineOfSightDirection_TankBlocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.GetLineOfSightDirection_TankBlocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByTank]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.Constructor_InitializesBoard]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.Constructor_InitializesBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.Constructor_InitializesBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.SetAndGetCellType]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.SetAndGetCellType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.SetAndGetCellType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.AddAndGetEnemyTankPositions]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.AddAndGetEnemyTankPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.AddAndGetEnemyTankPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.AddAndGetFriendlyTankPositions]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.AddAndGetFriendlyTankPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.AddAndGetFriendlyTankPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.AddAndGetShellPositions]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.AddAndGetShellPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.AddAndGetShellPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.Clear_ResetsState]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.Clear_ResetsState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.Clear_ResetsState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.SetAndGetOwnTankPosition]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.SetAndGetOwnTankPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.SetAndGetOwnTankPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BattleInfoImplTest.OwnTankPositionPersistsAfterClear]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=BattleInfoImplTest.OwnTankPositionPersistsAfterClear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BattleInfoImplTest.OwnTankPositionPersistsAfterClear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistanceFieldTest.MeasuresToNearestSource]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=DistanceFieldTest.MeasuresToNearestSource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistanceFieldTest.MeasuresToNearestSource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistanceFieldTest.WallsAndMinesBlock]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=DistanceFieldTest.WallsAndMinesBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistanceFieldTest.WallsAndMinesBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistanceFieldTest.DownhillPrefersFacingDirectionAndRespectsFilter]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=DistanceFieldTest.DownhillPrefersFacingDirectionAndRespectsFilter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistanceFieldTest.DownhillPrefersFacingDirectionAndRespectsFilter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DistanceFieldTest.Benchmark_TeamPlanning]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=DistanceFieldTest.DISABLED_Benchmark_TeamPlanning]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DistanceFieldTest.Benchmark_TeamPlanning]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[DistanceFieldTest.Benchmark_TeamPlanning]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalPathPlannerTest.FindPath_ShortestOnStaticBoard]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=IncrementalPathPlannerTest.FindPath_ShortestOnStaticBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalPathPlannerTest.FindPath_ShortestOnStaticBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalPathPlannerTest.FindPath_RepairsWhenWallDisappears]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=IncrementalPathPlannerTest.FindPath_RepairsWhenWallDisappears]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalPathPlannerTest.FindPath_RepairsWhenWallDisappears]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalPathPlannerTest.FindPath_FirstStepFilterFallsBackToSearch]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=IncrementalPathPlannerTest.FindPath_FirstStepFilterFallsBackToSearch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalPathPlannerTest.FindPath_FirstStepFilterFallsBackToSearch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalPathPlannerTest.FindPath_MatchesSearchLengthsWhileEverythingMoves]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=IncrementalPathPlannerTest.FindPath_MatchesSearchLengthsWhileEverythingMoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalPathPlannerTest.FindPath_MatchesSearchLengthsWhileEverythingMoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalPathPlannerTest.Benchmark_ChasingWanderingTarget]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=IncrementalPathPlannerTest.DISABLED_Benchmark_ChasingWanderingTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalPathPlannerTest.Benchmark_ChasingWanderingTarget]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[IncrementalPathPlannerTest.Benchmark_ChasingWanderingTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineOfSightTableTest.WallsAndTanksBlock]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=LineOfSightTableTest.WallsAndTanksBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LineOfSightTableTest.WallsAndTanksBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineOfSightTableTest.RebuildFollowsNewBoard]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=LineOfSightTableTest.RebuildFollowsNewBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LineOfSightTableTest.RebuildFollowsNewBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineOfSightTableTest.MatchesWalkOnRandomBoards]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=LineOfSightTableTest.MatchesWalkOnRandomBoards]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LineOfSightTableTest.MatchesWalkOnRandomBoards]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineOfSightTableTest.Benchmark_QueriesOnLargeBoard]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=LineOfSightTableTest.DISABLED_Benchmark_QueriesOnLargeBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LineOfSightTableTest.Benchmark_QueriesOnLargeBoard]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[LineOfSightTableTest.Benchmark_QueriesOnLargeBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveBattleInfoTest.ConstructorInitializesBase]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveBattleInfoTest.ConstructorInitializesBase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveBattleInfoTest.ConstructorInitializesBase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveBattleInfoTest.TargetTankPositionSetGetClear]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveBattleInfoTest.TargetTankPositionSetGetClear]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveBattleInfoTest.TargetTankPositionSetGetClear]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveBattleInfoTest.DefaultTargetTankPositionIsNullopt]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveBattleInfoTest.DefaultTargetTankPositionIsNullopt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveBattleInfoTest.DefaultTargetTankPositionIsNullopt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.Construction]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.Construction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.Construction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.UpdateTankWithBattleInfoSetsTarget]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.UpdateTankWithBattleInfoSetsTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.UpdateTankWithBattleInfoSetsTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.KeepsTrackingTargetIfItMoves]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.KeepsTrackingTargetIfItMoves]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.KeepsTrackingTargetIfItMoves]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.ChoosesClosestTankAfterTargetDestroyed]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.ChoosesClosestTankAfterTargetDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.ChoosesClosestTankAfterTargetDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.ChoosesClosestOfMultipleTanksAfterTargetDestroyed]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.ChoosesClosestOfMultipleTanksAfterTargetDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.ChoosesClosestOfMultipleTanksAfterTargetDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensivePlayerTest.SharesDistanceFieldUntilEnemiesMove]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensivePlayerTest.SharesDistanceFieldUntilEnemiesMove]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensivePlayerTest.SharesDistanceFieldUntilEnemiesMove]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.UpdateBattleInfo_SetsAndClearsTarget]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.UpdateBattleInfo_SetsAndClearsTarget]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.UpdateBattleInfo_SetsAndClearsTarget]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.UpdateBattleInfo_FromPlayerSetsGameShells]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.UpdateBattleInfo_FromPlayerSetsGameShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.UpdateBattleInfo_FromPlayerSetsGameShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.TurnToShootAction_RotatesCorrectly]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.TurnToShootAction_RotatesCorrectly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.TurnToShootAction_RotatesCorrectly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.FindPathBFS_FindsShortestPath]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.FindPathBFS_FindsShortestPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.FindPathBFS_FindsShortestPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.FollowCurrentPath_MoveForward]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.FollowCurrentPath_MoveForward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.FollowCurrentPath_MoveForward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority1_UpdateBattleInfo]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority1_UpdateBattleInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority1_UpdateBattleInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority2_AvoidDanger]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority2_AvoidDanger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority2_AvoidDanger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority3_ShootIfPossible]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority3_ShootIfPossible]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority3_ShootIfPossible]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority4_TurnToShoot]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority4_TurnToShoot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority4_TurnToShoot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority5_ChaseWithBFS]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority5_ChaseWithBFS]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority5_ChaseWithBFS]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OffensiveTankAlgorithmTest.GetAction_Priority5_FollowsSharedDistanceField]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=OffensiveTankAlgorithmTest.GetAction_Priority5_FollowsSharedDistanceField]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OffensiveTankAlgorithmTest.GetAction_Priority5_FollowsSharedDistanceField]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathFinderTest.FindPath_ShortestAroundWalls]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=PathFinderTest.FindPath_ShortestAroundWalls]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathFinderTest.FindPath_ShortestAroundWalls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathFinderTest.FindPath_AvoidsMinesAndUnreachable]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=PathFinderTest.FindPath_AvoidsMinesAndUnreachable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathFinderTest.FindPath_AvoidsMinesAndUnreachable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathFinderTest.FindPath_FirstStepFilterOnlyAppliesNextToStart]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=PathFinderTest.FindPath_FirstStepFilterOnlyAppliesNextToStart]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathFinderTest.FindPath_FirstStepFilterOnlyAppliesNextToStart]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathFinderTest.FindPath_MatchesReferenceAcrossReusedSearches]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=PathFinderTest.FindPath_MatchesReferenceAcrossReusedSearches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathFinderTest.FindPath_MatchesReferenceAcrossReusedSearches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PathFinderTest.Benchmark_ReplansPerSecond]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=PathFinderTest.DISABLED_Benchmark_ReplansPerSecond]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PathFinderTest.Benchmark_ReplansPerSecond]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[PathFinderTest.Benchmark_ReplansPerSecond]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedGameBoardTest.CopiesShareUntilEdited]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=SharedGameBoardTest.CopiesShareUntilEdited]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedGameBoardTest.CopiesShareUntilEdited]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedGameBoardTest.SoleOwnerEditsInPlace]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=SharedGameBoardTest.SoleOwnerEditsInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedGameBoardTest.SoleOwnerEditsInPlace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedGameBoardTest.BattleInfoKeepsSharingUnchangedBoard]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=SharedGameBoardTest.BattleInfoKeepsSharingUnchangedBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedGameBoardTest.BattleInfoKeepsSharingUnchangedBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SharedGameBoardTest.Benchmark_RefreshManyTanks]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=SharedGameBoardTest.DISABLED_Benchmark_RefreshManyTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SharedGameBoardTest.Benchmark_RefreshManyTanks]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[SharedGameBoardTest.Benchmark_RefreshManyTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellDangerMapTest.StepsAlongEachDirection]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=ShellDangerMapTest.StepsAlongEachDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellDangerMapTest.StepsAlongEachDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellDangerMapTest.WallsAndTanksStopTheShell]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=ShellDangerMapTest.WallsAndTanksStopTheShell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellDangerMapTest.WallsAndTanksStopTheShell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellDangerMapTest.MatchesPerQueryWalkOnRandomBoards]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=ShellDangerMapTest.MatchesPerQueryWalkOnRandomBoards]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellDangerMapTest.MatchesPerQueryWalkOnRandomBoards]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellDangerMapTest.Benchmark_SafetyQueries]=]  /root/repo/build/tests/algorithm_tests [==[--gtest_filter=ShellDangerMapTest.DISABLED_Benchmark_SafetyQueries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellDangerMapTest.Benchmark_SafetyQueries]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[ShellDangerMapTest.Benchmark_SafetyQueries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Algorithm SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  algorithm_tests_TESTS BasicPlayerTest.PopulatesBoardCellTypes BasicPlayerTest.PopulatesTankAndShellPositions BasicPlayerTest.UpdateTankWithBattleInfoCallsAlgorithm BasicPlayerTest.PopulatesOwnTankPosition BasicPlayerTest.NoOwnTankPositionIfNotPresent BasicPlayerTest.PassesGameShellsToBattleInfo BasicTankAlgorithmTest.UpdateBattleInfo_UpdatesGameBoardAndObjects BasicTankAlgorithmTest.GetLineOfSightDirection_DirectLine BasicTankAlgorithmTest.GetLineOfSightDirection_BlockedLine BasicTankAlgorithmTest.CheckLineOfSightInDirection_CorrectDirections BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBlocking BasicTankAlgorithmTest.CheckLineOfSightInDirection_FriendlyTankBlocking BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankNotInPath BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankAtDestination BasicTankAlgorithmTest.CheckLineOfSightInDirection_TankBehindDestination BasicTankAlgorithmTest.IsInDangerFromShells_NoShells BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightAndClose BasicTankAlgorithmTest.IsInDangerFromShells_ShellWithLineOfSightButTooFar BasicTankAlgorithmTest.IsInDangerFromShells_ShellBlockedByWall BasicTankAlgorithmTest.IsInDangerFromShells_MultipleShells BasicTankAlgorithmTest.IsInDangerFromShells_Point_NoShells BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightAndClose BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellWithLineOfSightButTooFar BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByWall BasicTankAlgorithmTest.IsInDangerFromShells_Point_MultipleShells BasicTankAlgorithmTest.IsPositionSafe_SafePosition BasicTankAlgorithmTest.IsPositionSafe_Wall BasicTankAlgorithmTest.IsPositionSafe_Mine BasicTankAlgorithmTest.IsPositionSafe_EnemyTank BasicTankAlgorithmTest.IsPositionSafe_FriendlyTank BasicTankAlgorithmTest.IsPositionSafe_ShellDanger BasicTankAlgorithmTest.GetSafePositions_AllSafe BasicTankAlgorithmTest.GetSafePositions_SomeWalls BasicTankAlgorithmTest.GetSafePositions_SomeMines BasicTankAlgorithmTest.GetSafePositions_SomeTanks BasicTankAlgorithmTest.GetSafePositions_ShellDanger BasicTankAlgorithmTest.GetSafeMoveOption_AlreadySafe BasicTankAlgorithmTest.GetSafeMoveOption_Forward BasicTankAlgorithmTest.GetSafeMoveOption_RotateLeft BasicTankAlgorithmTest.GetSafeMoveOption_RotateRight BasicTankAlgorithmTest.GetSafeMoveOptions_Multiple BasicTankAlgorithmTest.GetActionToSafePosition_Forward BasicTankAlgorithmTest.GetActionToSafePosition_MinimalRotation BasicTankAlgorithmTest.GetActionToSafePosition_NoSafe BasicTankAlgorithmTest.GetActionToSafePosition_ChooseSafeFromShell BasicTankAlgorithmTest.CanShootEnemy_EnemyInCurrentDirection BasicTankAlgorithmTest.CanShootEnemy_EnemyNotInCurrentDirection BasicTankAlgorithmTest.CanShootEnemy_EnemyBlockedByWall BasicTankAlgorithmTest.CanShootEnemy_MultipleEnemies_OneInDirection BasicTankAlgorithmTest.CanShootEnemy_NoEnemies BasicTankAlgorithmTest.UpdateState_MoveForward BasicTankAlgorithmTest.UpdateState_RotateLeft90 BasicTankAlgorithmTest.UpdateState_RotateRight90 BasicTankAlgorithmTest.UpdateState_Shoot BasicTankAlgorithmTest.UpdateBattleInfo_FirstUpdateSetsGameShells BasicTankAlgorithmTest.UpdateState_DoNothing BasicTankAlgorithmTest.GetRotationToDirection_NoRotation BasicTankAlgorithmTest.GetRotationToDirection_45DegreeRight BasicTankAlgorithmTest.GetRotationToDirection_45DegreeLeft BasicTankAlgorithmTest.GetRotationToDirection_90DegreeRight BasicTankAlgorithmTest.GetRotationToDirection_90DegreeLeft BasicTankAlgorithmTest.GetRotationToDirection_FallbackShortest BasicTankAlgorithmTest.IsTankAtPosition_EnemyTank BasicTankAlgorithmTest.IsTankAtPosition_FriendlyTank BasicTankAlgorithmTest.IsTankAtPosition_NoTanks BasicTankAlgorithmTest.GetLineOfSightDirection_TankBlocking BasicTankAlgorithmTest.IsInDangerFromShells_Point_ShellBlockedByTank BattleInfoImplTest.Constructor_InitializesBoard BattleInfoImplTest.SetAndGetCellType BattleInfoImplTest.AddAndGetEnemyTankPositions BattleInfoImplTest.AddAndGetFriendlyTankPositions BattleInfoImplTest.AddAndGetShellPositions BattleInfoImplTest.Clear_ResetsState BattleInfoImplTest.SetAndGetOwnTankPosition BattleInfoImplTest.OwnTankPositionPersistsAfterClear DistanceFieldTest.MeasuresToNearestSource DistanceFieldTest.WallsAndMinesBlock DistanceFieldTest.DownhillPrefersFacingDirectionAndRespectsFilter DistanceFieldTest.Benchmark_TeamPlanning IncrementalPathPlannerTest.FindPath_ShortestOnStaticBoard IncrementalPathPlannerTest.FindPath_RepairsWhenWallDisappears IncrementalPathPlannerTest.FindPath_FirstStepFilterFallsBackToSearch IncrementalPathPlannerTest.FindPath_MatchesSearchLengthsWhileEverythingMoves IncrementalPathPlannerTest.Benchmark_ChasingWanderingTarget LineOfSightTableTest.WallsAndTanksBlock LineOfSightTableTest.RebuildFollowsNewBoard LineOfSightTableTest.MatchesWalkOnRandomBoards LineOfSightTableTest.Benchmark_QueriesOnLargeBoard OffensiveBattleInfoTest.ConstructorInitializesBase OffensiveBattleInfoTest.TargetTankPositionSetGetClear OffensiveBattleInfoTest.DefaultTargetTankPositionIsNullopt OffensivePlayerTest.Construction OffensivePlayerTest.UpdateTankWithBattleInfoSetsTarget OffensivePlayerTest.KeepsTrackingTargetIfItMoves OffensivePlayerTest.ChoosesClosestTankAfterTargetDestroyed OffensivePlayerTest.ChoosesClosestOfMultipleTanksAfterTargetDestroyed OffensivePlayerTest.SharesDistanceFieldUntilEnemiesMove OffensiveTankAlgorithmTest.UpdateBattleInfo_SetsAndClearsTarget OffensiveTankAlgorithmTest.UpdateBattleInfo_FromPlayerSetsGameShells OffensiveTankAlgorithmTest.TurnToShootAction_RotatesCorrectly OffensiveTankAlgorithmTest.FindPathBFS_FindsShortestPath OffensiveTankAlgorithmTest.FollowCurrentPath_MoveForward OffensiveTankAlgorithmTest.GetAction_Priority1_UpdateBattleInfo OffensiveTankAlgorithmTest.GetAction_Priority2_AvoidDanger OffensiveTankAlgorithmTest.GetAction_Priority3_ShootIfPossible OffensiveTankAlgorithmTest.GetAction_Priority4_TurnToShoot OffensiveTankAlgorithmTest.GetAction_Priority5_ChaseWithBFS OffensiveTankAlgorithmTest.GetAction_Priority5_FollowsSharedDistanceField PathFinderTest.FindPath_ShortestAroundWalls PathFinderTest.FindPath_AvoidsMinesAndUnreachable PathFinderTest.FindPath_FirstStepFilterOnlyAppliesNextToStart PathFinderTest.FindPath_MatchesReferenceAcrossReusedSearches PathFinderTest.Benchmark_ReplansPerSecond SharedGameBoardTest.CopiesShareUntilEdited SharedGameBoardTest.SoleOwnerEditsInPlace SharedGameBoardTest.BattleInfoKeepsSharingUnchangedBoard SharedGameBoardTest.Benchmark_RefreshManyTanks ShellDangerMapTest.StepsAlongEachDirection ShellDangerMapTest.WallsAndTanksStopTheShell ShellDangerMapTest.MatchesPerQueryWalkOnRandomBoards ShellDangerMapTest.Benchmark_SafetyQueries)
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UserCommon/bonus/board_generator.cpp" "CMakeFiles/UserCommon.dir/UserCommon/bonus/board_generator.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/bonus/board_generator.cpp.o.d"
+  "/root/repo/UserCommon/compiled_map.cpp" "CMakeFiles/UserCommon.dir/UserCommon/compiled_map.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/compiled_map.cpp.o.d"
+  "/root/repo/UserCommon/game_board.cpp" "CMakeFiles/UserCommon.dir/UserCommon/game_board.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/game_board.cpp.o.d"
+  "/root/repo/UserCommon/objects/game_object.cpp" "CMakeFiles/UserCommon.dir/UserCommon/objects/game_object.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/objects/game_object.cpp.o.d"
+  "/root/repo/UserCommon/objects/shell.cpp" "CMakeFiles/UserCommon.dir/UserCommon/objects/shell.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/objects/shell.cpp.o.d"
+  "/root/repo/UserCommon/objects/tank.cpp" "CMakeFiles/UserCommon.dir/UserCommon/objects/tank.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/objects/tank.cpp.o.d"
+  "/root/repo/UserCommon/replay/replay_format.cpp" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_format.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_format.cpp.o.d"
+  "/root/repo/UserCommon/replay/replay_reader.cpp" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_reader.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_reader.cpp.o.d"
+  "/root/repo/UserCommon/replay/replay_writer.cpp" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_writer.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_writer.cpp.o.d"
+  "/root/repo/UserCommon/row_access_satellite_view.cpp" "CMakeFiles/UserCommon.dir/UserCommon/row_access_satellite_view.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/row_access_satellite_view.cpp.o.d"
+  "/root/repo/UserCommon/satellite_view_impl.cpp" "CMakeFiles/UserCommon.dir/UserCommon/satellite_view_impl.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/satellite_view_impl.cpp.o.d"
+  "/root/repo/UserCommon/utils/direction.cpp" "CMakeFiles/UserCommon.dir/UserCommon/utils/direction.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/utils/direction.cpp.o.d"
+  "/root/repo/UserCommon/utils/midpoint.cpp" "CMakeFiles/UserCommon.dir/UserCommon/utils/midpoint.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/utils/midpoint.cpp.o.d"
+  "/root/repo/UserCommon/utils/point.cpp" "CMakeFiles/UserCommon.dir/UserCommon/utils/point.cpp.o" "gcc" "CMakeFiles/UserCommon.dir/UserCommon/utils/point.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/libUserCommon.a"
+  "/root/repo/build/libUserCommon.pdb"
+  "CMakeFiles/UserCommon.dir/UserCommon/bonus/board_generator.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/bonus/board_generator.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/compiled_map.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/compiled_map.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/game_board.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/game_board.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/game_object.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/game_object.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/shell.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/shell.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/tank.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/objects/tank.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_format.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_format.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_reader.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_reader.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_writer.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/replay/replay_writer.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/row_access_satellite_view.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/row_access_satellite_view.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/satellite_view_impl.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/satellite_view_impl.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/direction.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/direction.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/midpoint.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/midpoint.cpp.o.d"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/point.cpp.o"
+  "CMakeFiles/UserCommon.dir/UserCommon/utils/point.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UserCommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/UserCommon/bonus/board_generator_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/bonus/board_generator_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/bonus/board_generator_test.cpp.o.d"
+  "/root/repo/UserCommon/compiled_map_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/compiled_map_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/compiled_map_test.cpp.o.d"
+  "/root/repo/UserCommon/game_board_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/game_board_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/game_board_test.cpp.o.d"
+  "/root/repo/UserCommon/objects/game_object_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/game_object_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/game_object_test.cpp.o.d"
+  "/root/repo/UserCommon/objects/shell_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/shell_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/shell_test.cpp.o.d"
+  "/root/repo/UserCommon/objects/tank_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/tank_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/objects/tank_test.cpp.o.d"
+  "/root/repo/UserCommon/replay/replay_format_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_format_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_format_test.cpp.o.d"
+  "/root/repo/UserCommon/replay/replay_reader_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_reader_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_reader_test.cpp.o.d"
+  "/root/repo/UserCommon/row_access_satellite_view_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/row_access_satellite_view_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/row_access_satellite_view_test.cpp.o.d"
+  "/root/repo/UserCommon/satellite_view_impl_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/satellite_view_impl_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/satellite_view_impl_test.cpp.o.d"
+  "/root/repo/UserCommon/utils/direction_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/direction_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/direction_test.cpp.o.d"
+  "/root/repo/UserCommon/utils/midpoint_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/midpoint_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/midpoint_test.cpp.o.d"
+  "/root/repo/UserCommon/utils/point_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/point_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/point_test.cpp.o.d"
+  "/root/repo/UserCommon/utils/torus_ray_test.cpp" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/torus_ray_test.cpp.o" "gcc" "CMakeFiles/usercommon_tests.dir/UserCommon/utils/torus_ray_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/tests/usercommon_tests"
+  "/root/repo/build/tests/usercommon_tests.pdb"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/bonus/board_generator_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/bonus/board_generator_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/compiled_map_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/compiled_map_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/game_board_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/game_board_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/game_object_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/game_object_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/shell_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/shell_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/tank_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/objects/tank_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_format_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_format_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_reader_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/replay/replay_reader_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/row_access_satellite_view_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/row_access_satellite_view_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/satellite_view_impl_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/satellite_view_impl_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/direction_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/direction_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/midpoint_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/midpoint_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/point_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/point_test.cpp.o.d"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/torus_ray_test.cpp.o"
+  "CMakeFiles/usercommon_tests.dir/UserCommon/utils/torus_ray_test.cpp.o.d"
+  "usercommon_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/usercommon_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_test_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/usercommon_tests[1]_include.cmake")
+add_test(UserCommonTests "/root/repo/build/tests/usercommon_tests")
+set_tests_properties(UserCommonTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;136;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_deps/googletest-build")
+subdirs("Algorithm")
+subdirs("GameManager")
+subdirs("Simulator")
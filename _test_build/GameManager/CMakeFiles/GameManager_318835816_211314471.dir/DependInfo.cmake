@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/GameManager/collision_handler.cpp" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/collision_handler.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/collision_handler.cpp.o.d"
+  "/root/repo/GameManager/game_manager.cpp" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/game_manager.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/game_manager.cpp.o.d"
+  "/root/repo/GameManager/game_replayer.cpp" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/game_replayer.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_318835816_211314471.dir/game_replayer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/GameManager/GameManager_318835816_211314471.pdb"
+  "/root/repo/GameManager/GameManager_318835816_211314471.so"
+  "CMakeFiles/GameManager_318835816_211314471.dir/collision_handler.cpp.o"
+  "CMakeFiles/GameManager_318835816_211314471.dir/collision_handler.cpp.o.d"
+  "CMakeFiles/GameManager_318835816_211314471.dir/game_manager.cpp.o"
+  "CMakeFiles/GameManager_318835816_211314471.dir/game_manager.cpp.o.d"
+  "CMakeFiles/GameManager_318835816_211314471.dir/game_replayer.cpp.o"
+  "CMakeFiles/GameManager_318835816_211314471.dir/game_replayer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GameManager_318835816_211314471.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/GameManager/collision_handler.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/collision_handler.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/collision_handler.cpp.o.d"
+  "/root/repo/GameManager/collision_handler_test.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/collision_handler_test.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/collision_handler_test.cpp.o.d"
+  "/root/repo/GameManager/game_manager.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/game_manager.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/game_manager.cpp.o.d"
+  "/root/repo/GameManager/game_manager_test.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/game_manager_test.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/game_manager_test.cpp.o.d"
+  "/root/repo/GameManager/game_replayer.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/game_replayer.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/game_replayer.cpp.o.d"
+  "/root/repo/GameManager/game_replayer_test.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/game_replayer_test.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/game_replayer_test.cpp.o.d"
+  "/root/repo/GameManager/test/helpers/file_test_helper.cpp" "GameManager/CMakeFiles/GameManager_tests.dir/test/helpers/file_test_helper.cpp.o" "gcc" "GameManager/CMakeFiles/GameManager_tests.dir/test/helpers/file_test_helper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
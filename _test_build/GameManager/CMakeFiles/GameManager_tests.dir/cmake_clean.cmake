@@ -0,0 +1,24 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/tests/GameManager_tests"
+  "/root/repo/build/tests/GameManager_tests.pdb"
+  "CMakeFiles/GameManager_tests.dir/collision_handler.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/collision_handler.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/collision_handler_test.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/collision_handler_test.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/game_manager.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/game_manager.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/game_manager_test.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/game_manager_test.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/game_replayer.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/game_replayer.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/game_replayer_test.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/game_replayer_test.cpp.o.d"
+  "CMakeFiles/GameManager_tests.dir/test/helpers/file_test_helper.cpp.o"
+  "CMakeFiles/GameManager_tests.dir/test/helpers/file_test_helper.cpp.o.d"
+  "GameManager_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GameManager_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/GameManager
+# Build directory: /root/repo/_test_build/GameManager
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/GameManager/GameManager_tests[1]_include.cmake")
+add_test(GameManager_tests "/root/repo/build/tests/GameManager_tests")
+set_tests_properties(GameManager_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/GameManager/CMakeLists.txt;100;add_test;/root/repo/GameManager/CMakeLists.txt;0;")
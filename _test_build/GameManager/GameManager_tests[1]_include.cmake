@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/GameManager/GameManager_tests[1]_tests.cmake")
+  include("/root/repo/_test_build/GameManager/GameManager_tests[1]_tests.cmake")
+else()
+  add_test(GameManager_tests_NOT_BUILT GameManager_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,199 @@
+add_test([=[CollisionHandlerTest.DetectPathCollisions_ShellsSwap_ExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPathCollisions_ShellsSwap_ExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPathCollisions_ShellsSwap_ExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPathCollisions_NoIntersection_NoExplosion]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPathCollisions_NoIntersection_NoExplosion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPathCollisions_NoIntersection_NoExplosion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPathCollisions_TanksSwap_ExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPathCollisions_TanksSwap_ExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPathCollisions_TanksSwap_ExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingShell]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingShell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingShell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingTank]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ApplyPositionExplosion_DestroysTankAndRemovesMine]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ApplyPositionExplosion_DestroysTankAndRemovesMine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ApplyPositionExplosion_DestroysTankAndRemovesMine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ApplyPositionExplosion_DestroysShell]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ApplyPositionExplosion_DestroysShell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ApplyPositionExplosion_DestroysShell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPositionCollision_TankTankCollision_ExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPositionCollision_TankTankCollision_ExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPositionCollision_TankTankCollision_ExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPositionCollision_TankShellCollision_ExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPositionCollision_TankShellCollision_ExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPositionCollision_TankShellCollision_ExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPositionCollision_NoCollision_NoExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPositionCollision_NoCollision_NoExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPositionCollision_NoCollision_NoExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ShellWallCollision_OneHit_ExplosionLoggedWallSurvives]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ShellWallCollision_OneHit_ExplosionLoggedWallSurvives]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ShellWallCollision_OneHit_ExplosionLoggedWallSurvives]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ShellWallCollision_TwoHits_WallDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ShellWallCollision_TwoHits_WallDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ShellWallCollision_TwoHits_WallDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.TankMineCollision_DestroyedAndMineRemoved]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.TankMineCollision_DestroyedAndMineRemoved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.TankMineCollision_DestroyedAndMineRemoved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.TankMineCollision_NoMine_NoExplosion]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.TankMineCollision_NoMine_NoExplosion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.TankMineCollision_NoMine_NoExplosion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellShellPositionCollision_BothDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellShellPositionCollision_BothDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellShellPositionCollision_BothDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_TankTankPositionCollision_BothDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_TankTankPositionCollision_BothDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_TankTankPositionCollision_BothDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellWallOneHit_WallSurvives]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellWallOneHit_WallSurvives]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellWallOneHit_WallSurvives]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellWallThreeHits_WallDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellWallThreeHits_WallDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellWallThreeHits_WallDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellsCrossMidpoint_AllDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellsCrossMidpoint_AllDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellsCrossMidpoint_AllDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_TankStepsOnMine_DestroyedAndCleared]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_TankStepsOnMine_DestroyedAndCleared]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_TankStepsOnMine_DestroyedAndCleared]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellHitsTank_BothDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellHitsTank_BothDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellHitsTank_BothDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_TankShellPathCross_BothDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_TankShellPathCross_BothDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_TankShellPathCross_BothDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_NoCollisions_AllSurvive]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_NoCollisions_AllSurvive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_NoCollisions_AllSurvive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_MixedCollisions_AllHandledCorrectly]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_MixedCollisions_AllHandledCorrectly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_MixedCollisions_AllHandledCorrectly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_ShellHitsMine_ShellSurvivesMineUnaffected]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_ShellHitsMine_ShellSurvivesMineUnaffected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_ShellHitsMine_ShellSurvivesMineUnaffected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_WraparoundShellPathCrossing_BothDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_WraparoundShellPathCrossing_BothDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_WraparoundShellPathCrossing_BothDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_WraparoundX_CollisionMidpointCorrect]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_WraparoundX_CollisionMidpointCorrect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_WraparoundX_CollisionMidpointCorrect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_WraparoundY_CollisionMidpointCorrect]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_WraparoundY_CollisionMidpointCorrect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_WraparoundY_CollisionMidpointCorrect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Resolve_WraparoundCornerDiagonal_CollisionMidpointCorrect]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.Resolve_WraparoundCornerDiagonal_CollisionMidpointCorrect]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Resolve_WraparoundCornerDiagonal_CollisionMidpointCorrect]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPathCrossings_PathsCross_ExplosionLogged]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPathCrossings_PathsCross_ExplosionLogged]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPathCrossings_PathsCross_ExplosionLogged]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.DetectPathCrossings_NonAdjacentPaths_NoExplosion]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DetectPathCrossings_NonAdjacentPaths_NoExplosion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.DetectPathCrossings_NonAdjacentPaths_NoExplosion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.ResolveAll_MatchesReferenceOnRandomGames]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.ResolveAll_MatchesReferenceOnRandomGames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.ResolveAll_MatchesReferenceOnRandomGames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CollisionHandlerTest.Benchmark_ResolveAll_ManyShells]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=CollisionHandlerTest.DISABLED_Benchmark_ResolveAll_ManyShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CollisionHandlerTest.Benchmark_ResolveAll_ManyShells]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[CollisionHandlerTest.Benchmark_ResolveAll_ManyShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Constructor_VerboseFlagTrue]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Constructor_VerboseFlagTrue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Constructor_VerboseFlagTrue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Constructor_VerboseFlagFalse]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Constructor_VerboseFlagFalse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Constructor_VerboseFlagFalse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.GenerateOutputFilePath_BasicPlayerNames]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.GenerateOutputFilePath_BasicPlayerNames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.GenerateOutputFilePath_BasicPlayerNames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.GenerateOutputFilePath_MangledNames]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.GenerateOutputFilePath_MangledNames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.GenerateOutputFilePath_MangledNames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.GenerateOutputFilePath_UniqueTimestamps]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.GenerateOutputFilePath_UniqueTimestamps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.GenerateOutputFilePath_UniqueTimestamps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CleanFilename_ValidName]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CleanFilename_ValidName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CleanFilename_ValidName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CleanFilename_InvalidCharacters]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CleanFilename_InvalidCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CleanFilename_InvalidCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CleanFilename_AllInvalidCharacters]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CleanFilename_AllInvalidCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CleanFilename_AllInvalidCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CleanFilename_EmptyString]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CleanFilename_EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CleanFilename_EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CreateTanks_CreatesTanksAtCorrectPositions]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CreateTanks_CreatesTanksAtCorrectPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CreateTanks_CreatesTanksAtCorrectPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CreateTankAlgorithms_AssociatesAlgorithmsWithTanks]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CreateTankAlgorithms_AssociatesAlgorithmsWithTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CreateTankAlgorithms_AssociatesAlgorithmsWithTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.RemoveDestroyedShells_RemovesOnlyDestroyed]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.RemoveDestroyedShells_RemovesOnlyDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.RemoveDestroyedShells_RemovesOnlyDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.MoveShellsOnce_MovesAllShellsCorrectly]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.MoveShellsOnce_MovesAllShellsCorrectly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.MoveShellsOnce_MovesAllShellsCorrectly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_MoveForward_Success]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_MoveForward_Success]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_MoveForward_Success]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_MoveForward_BlockedByWall]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_MoveForward_BlockedByWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_MoveForward_BlockedByWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_RotateLeft45_UpdatesDirection]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_RotateLeft45_UpdatesDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_RotateLeft45_UpdatesDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_Shoot_Success]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_Shoot_Success]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_Shoot_Success]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_Shoot_FailsOnCooldown]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_Shoot_FailsOnCooldown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_Shoot_FailsOnCooldown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_GetBattleInfo_DoesNotCrash]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_GetBattleInfo_DoesNotCrash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_GetBattleInfo_DoesNotCrash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_DoNothing_OnlyStateUpdated]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_DoNothing_OnlyStateUpdated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_DoNothing_OnlyStateUpdated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ApplyAction_DestroyedTank_NoAction]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ApplyAction_DestroyedTank_NoAction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ApplyAction_DestroyedTank_NoAction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_AllValidActions]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_AllValidActions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_AllValidActions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_SomeActionsIgnored]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_SomeActionsIgnored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_SomeActionsIgnored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_KilledThisStep]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_KilledThisStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_KilledThisStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_AlreadyDead]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_AlreadyDead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_AlreadyDead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_KilledAndIgnored]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_KilledAndIgnored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_KilledAndIgnored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_MultipleKilled]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_MultipleKilled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_MultipleKilled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_AllKilled]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_AllKilled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_AllKilled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_AllDoNothing]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_AllDoNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_AllDoNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_MixedKilledIgnoredValid]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_MixedKilledIgnoredValid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_MixedKilledIgnoredValid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.LogAction_OrderMatchesTanksOnBoard]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.LogAction_OrderMatchesTanksOnBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.LogAction_OrderMatchesTanksOnBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_Player1Wins]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_Player1Wins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_Player1Wins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_Player2Wins]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_Player2Wins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_Player2Wins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_TieZeroTanks]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_TieZeroTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_TieZeroTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_TieMaxSteps]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_TieMaxSteps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_TieMaxSteps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_GameContinues]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_GameContinues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_GameContinues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_TieZeroShellsForExactly40Steps]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_TieZeroShellsForExactly40Steps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_TieZeroShellsForExactly40Steps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.CheckGameOver_ZeroShellsButStillRemaining39Steps]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.CheckGameOver_ZeroShellsButStillRemaining39Steps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.CheckGameOver_ZeroShellsButStillRemaining39Steps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_OneTankMoves_UpdatesPositionAndLogs]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_OneTankMoves_UpdatesPositionAndLogs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_OneTankMoves_UpdatesPositionAndLogs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_NotVerbose_DoesNotLog]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_NotVerbose_DoesNotLog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_NotVerbose_DoesNotLog]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_OneTankShoots_AddsShellAndLogs]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_OneTankShoots_AddsShellAndLogs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_OneTankShoots_AddsShellAndLogs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_TankOnCooldown_ShootIgnoredAndLogs]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_TankOnCooldown_ShootIgnoredAndLogs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_TankOnCooldown_ShootIgnoredAndLogs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_TankKilledThisStep_LogsKilledThisStep]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_TankKilledThisStep_LogsKilledThisStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_TankKilledThisStep_LogsKilledThisStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_AlreadyDeadTank_LogsKilled]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_AlreadyDeadTank_LogsKilled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_AlreadyDeadTank_LogsKilled]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_MixedActions_LogsAllScenarios]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_MixedActions_LogsAllScenarios]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_MixedActions_LogsAllScenarios]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_AllShellsDestroyed_RemovesShells]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_AllShellsDestroyed_RemovesShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_AllShellsDestroyed_RemovesShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_MoveBackward_OnlyMovesOnThirdStep]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_MoveBackward_OnlyMovesOnThirdStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_MoveBackward_OnlyMovesOnThirdStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_MoveForward_cancelMoveBackward]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_MoveForward_cancelMoveBackward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_MoveForward_cancelMoveBackward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_Shoot_CooldownResetsAfter4Steps]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_Shoot_CooldownResetsAfter4Steps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_Shoot_CooldownResetsAfter4Steps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_Shoot_CannotShootMoreThanMaxShells]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_Shoot_CannotShootMoreThanMaxShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_Shoot_CannotShootMoreThanMaxShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.ProcessStep_GetBattleInfoIgnoredDuringBackwardMovement]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.ProcessStep_GetBattleInfoIgnoredDuringBackwardMovement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.ProcessStep_GetBattleInfoIgnoredDuringBackwardMovement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_DoesNotExceedMaximumSteps_Integration]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_DoesNotExceedMaximumSteps_Integration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_DoesNotExceedMaximumSteps_Integration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_AfterResetMatchesFreshManager]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_AfterResetMatchesFreshManager]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_AfterResetMatchesFreshManager]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Benchmark_ResetComparedToNewManager]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.DISABLED_Benchmark_ResetComparedToNewManager]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Benchmark_ResetComparedToNewManager]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[GameManagerTest.Benchmark_ResetComparedToNewManager]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_TieAfter40StepsWithZeroShells_Integration]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_TieAfter40StepsWithZeroShells_Integration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_TieAfter40StepsWithZeroShells_Integration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_VerboseFalse_NoFileOutput]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_VerboseFalse_NoFileOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_VerboseFalse_NoFileOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_VerboseTrue_CreatesFileOutput]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_VerboseTrue_CreatesFileOutput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_VerboseTrue_CreatesFileOutput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Run_VerboseTrue_ReplayMatchesGameLog]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.Run_VerboseTrue_ReplayMatchesGameLog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Run_VerboseTrue_ReplayMatchesGameLog]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerTest.Benchmark_ProcessStepThroughput_LargeMap]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameManagerTest.DISABLED_Benchmark_ProcessStepThroughput_LargeMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerTest.Benchmark_ProcessStepThroughput_LargeMap]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[GameManagerTest.Benchmark_ProcessStepThroughput_LargeMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameReplayerTest.SeekStep_MatchesRecordedGameAtEveryStep]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameReplayerTest.SeekStep_MatchesRecordedGameAtEveryStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameReplayerTest.SeekStep_MatchesRecordedGameAtEveryStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameReplayerTest.SeekStep_BackwardUsesKeyframes]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameReplayerTest.SeekStep_BackwardUsesKeyframes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameReplayerTest.SeekStep_BackwardUsesKeyframes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameReplayerTest.Load_FailsWithoutReplay]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameReplayerTest.Load_FailsWithoutReplay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameReplayerTest.Load_FailsWithoutReplay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameReplayerTest.Benchmark_SeekLateStep]=]  /root/repo/build/tests/GameManager_tests [==[--gtest_filter=GameReplayerTest.DISABLED_Benchmark_SeekLateStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameReplayerTest.Benchmark_SeekLateStep]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[GameReplayerTest.Benchmark_SeekLateStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/GameManager SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  GameManager_tests_TESTS CollisionHandlerTest.DetectPathCollisions_ShellsSwap_ExplosionLogged CollisionHandlerTest.DetectPathCollisions_NoIntersection_NoExplosion CollisionHandlerTest.DetectPathCollisions_TanksSwap_ExplosionLogged CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingShell CollisionHandlerTest.ApplyPathExplosion_DestroysCrossingTank CollisionHandlerTest.ApplyPositionExplosion_DestroysTankAndRemovesMine CollisionHandlerTest.ApplyPositionExplosion_DestroysShell CollisionHandlerTest.DetectPositionCollision_TankTankCollision_ExplosionLogged CollisionHandlerTest.DetectPositionCollision_TankShellCollision_ExplosionLogged CollisionHandlerTest.DetectPositionCollision_NoCollision_NoExplosionLogged CollisionHandlerTest.ShellWallCollision_OneHit_ExplosionLoggedWallSurvives CollisionHandlerTest.ShellWallCollision_TwoHits_WallDestroyed CollisionHandlerTest.TankMineCollision_DestroyedAndMineRemoved CollisionHandlerTest.TankMineCollision_NoMine_NoExplosion CollisionHandlerTest.Resolve_ShellShellPositionCollision_BothDestroyed CollisionHandlerTest.Resolve_TankTankPositionCollision_BothDestroyed CollisionHandlerTest.Resolve_ShellWallOneHit_WallSurvives CollisionHandlerTest.Resolve_ShellWallThreeHits_WallDestroyed CollisionHandlerTest.Resolve_ShellsCrossMidpoint_AllDestroyed CollisionHandlerTest.Resolve_TankStepsOnMine_DestroyedAndCleared CollisionHandlerTest.Resolve_ShellHitsTank_BothDestroyed CollisionHandlerTest.Resolve_TankShellPathCross_BothDestroyed CollisionHandlerTest.Resolve_NoCollisions_AllSurvive CollisionHandlerTest.Resolve_MixedCollisions_AllHandledCorrectly CollisionHandlerTest.Resolve_ShellHitsMine_ShellSurvivesMineUnaffected CollisionHandlerTest.Resolve_WraparoundShellPathCrossing_BothDestroyed CollisionHandlerTest.Resolve_WraparoundX_CollisionMidpointCorrect CollisionHandlerTest.Resolve_WraparoundY_CollisionMidpointCorrect CollisionHandlerTest.Resolve_WraparoundCornerDiagonal_CollisionMidpointCorrect CollisionHandlerTest.DetectPathCrossings_PathsCross_ExplosionLogged CollisionHandlerTest.DetectPathCrossings_NonAdjacentPaths_NoExplosion CollisionHandlerTest.ResolveAll_MatchesReferenceOnRandomGames CollisionHandlerTest.Benchmark_ResolveAll_ManyShells GameManagerTest.Constructor_VerboseFlagTrue GameManagerTest.Constructor_VerboseFlagFalse GameManagerTest.GenerateOutputFilePath_BasicPlayerNames GameManagerTest.GenerateOutputFilePath_MangledNames GameManagerTest.GenerateOutputFilePath_UniqueTimestamps GameManagerTest.CleanFilename_ValidName GameManagerTest.CleanFilename_InvalidCharacters GameManagerTest.CleanFilename_AllInvalidCharacters GameManagerTest.CleanFilename_EmptyString GameManagerTest.CreateTanks_CreatesTanksAtCorrectPositions GameManagerTest.CreateTankAlgorithms_AssociatesAlgorithmsWithTanks GameManagerTest.RemoveDestroyedShells_RemovesOnlyDestroyed GameManagerTest.MoveShellsOnce_MovesAllShellsCorrectly GameManagerTest.ApplyAction_MoveForward_Success GameManagerTest.ApplyAction_MoveForward_BlockedByWall GameManagerTest.ApplyAction_RotateLeft45_UpdatesDirection GameManagerTest.ApplyAction_Shoot_Success GameManagerTest.ApplyAction_Shoot_FailsOnCooldown GameManagerTest.ApplyAction_GetBattleInfo_DoesNotCrash GameManagerTest.ApplyAction_DoNothing_OnlyStateUpdated GameManagerTest.ApplyAction_DestroyedTank_NoAction GameManagerTest.LogAction_AllValidActions GameManagerTest.LogAction_SomeActionsIgnored GameManagerTest.LogAction_KilledThisStep GameManagerTest.LogAction_AlreadyDead GameManagerTest.LogAction_KilledAndIgnored GameManagerTest.LogAction_MultipleKilled GameManagerTest.LogAction_AllKilled GameManagerTest.LogAction_AllDoNothing GameManagerTest.LogAction_MixedKilledIgnoredValid GameManagerTest.LogAction_OrderMatchesTanksOnBoard GameManagerTest.CheckGameOver_Player1Wins GameManagerTest.CheckGameOver_Player2Wins GameManagerTest.CheckGameOver_TieZeroTanks GameManagerTest.CheckGameOver_TieMaxSteps GameManagerTest.CheckGameOver_GameContinues GameManagerTest.CheckGameOver_TieZeroShellsForExactly40Steps GameManagerTest.CheckGameOver_ZeroShellsButStillRemaining39Steps GameManagerTest.ProcessStep_OneTankMoves_UpdatesPositionAndLogs GameManagerTest.ProcessStep_NotVerbose_DoesNotLog GameManagerTest.ProcessStep_OneTankShoots_AddsShellAndLogs GameManagerTest.ProcessStep_ShellHitsTank_TankDestroyedAndLogKilled GameManagerTest.ProcessStep_TankOnCooldown_ShootIgnoredAndLogs GameManagerTest.ProcessStep_TankKilledThisStep_LogsKilledThisStep GameManagerTest.ProcessStep_AlreadyDeadTank_LogsKilled GameManagerTest.ProcessStep_MixedActions_LogsAllScenarios GameManagerTest.ProcessStep_AllShellsDestroyed_RemovesShells GameManagerTest.ProcessStep_MoveBackward_OnlyMovesOnThirdStep GameManagerTest.ProcessStep_MoveForward_cancelMoveBackward GameManagerTest.ProcessStep_Shoot_CooldownResetsAfter4Steps GameManagerTest.ProcessStep_Shoot_CannotShootMoreThanMaxShells GameManagerTest.ProcessStep_GetBattleInfoIgnoredDuringBackwardMovement GameManagerTest.Run_DoesNotExceedMaximumSteps_Integration GameManagerTest.Run_AfterResetMatchesFreshManager GameManagerTest.Benchmark_ResetComparedToNewManager GameManagerTest.Run_TieAfter40StepsWithZeroShells_Integration GameManagerTest.Run_VerboseFalse_NoFileOutput GameManagerTest.Run_VerboseTrue_CreatesFileOutput GameManagerTest.Run_VerboseTrue_ReplayMatchesGameLog GameManagerTest.Benchmark_ProcessStepThroughput_LargeMap GameReplayerTest.SeekStep_MatchesRecordedGameAtEveryStep GameReplayerTest.SeekStep_BackwardUsesKeyframes GameReplayerTest.Load_FailsWithoutReplay GameReplayerTest.Benchmark_SeekLateStep)
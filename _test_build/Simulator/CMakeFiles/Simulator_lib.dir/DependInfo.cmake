@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Simulator/game_modes/base_game_mode.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/base_game_mode.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/base_game_mode.cpp.o.d"
+  "/root/repo/Simulator/game_modes/basic_game_mode.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/basic_game_mode.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/basic_game_mode.cpp.o.d"
+  "/root/repo/Simulator/game_modes/comparative_runner.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/comparative_runner.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/comparative_runner.cpp.o.d"
+  "/root/repo/Simulator/game_modes/competitive_runner.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/competitive_runner.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/game_modes/competitive_runner.cpp.o.d"
+  "/root/repo/Simulator/game_runner.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/game_runner.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/game_runner.cpp.o.d"
+  "/root/repo/Simulator/registration/AlgorithmRegistrar.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/registration/AlgorithmRegistrar.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/registration/AlgorithmRegistrar.cpp.o.d"
+  "/root/repo/Simulator/registration/GameManagerRegistrar.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistrar.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistrar.cpp.o.d"
+  "/root/repo/Simulator/registration/GameManagerRegistration.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistration.cpp.o.d"
+  "/root/repo/Simulator/registration/PlayerRegistration.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/registration/PlayerRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/registration/PlayerRegistration.cpp.o.d"
+  "/root/repo/Simulator/registration/TankAlgorithmRegistration.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/registration/TankAlgorithmRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/registration/TankAlgorithmRegistration.cpp.o.d"
+  "/root/repo/Simulator/utils/command_line_parser.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/command_line_parser.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/command_line_parser.cpp.o.d"
+  "/root/repo/Simulator/utils/error_collector.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/error_collector.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/error_collector.cpp.o.d"
+  "/root/repo/Simulator/utils/file_enumerator.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_enumerator.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_enumerator.cpp.o.d"
+  "/root/repo/Simulator/utils/file_loader.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_loader.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_loader.cpp.o.d"
+  "/root/repo/Simulator/utils/file_satellite_view.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_satellite_view.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/file_satellite_view.cpp.o.d"
+  "/root/repo/Simulator/utils/game_manager_pool.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/game_manager_pool.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/game_manager_pool.cpp.o.d"
+  "/root/repo/Simulator/utils/library_manager.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/library_manager.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/library_manager.cpp.o.d"
+  "/root/repo/Simulator/utils/library_validator.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/library_validator.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/library_validator.cpp.o.d"
+  "/root/repo/Simulator/utils/map_cache.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/map_cache.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/map_cache.cpp.o.d"
+  "/root/repo/Simulator/utils/mapped_file.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/mapped_file.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/mapped_file.cpp.o.d"
+  "/root/repo/Simulator/utils/match_scheduler.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/match_scheduler.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/match_scheduler.cpp.o.d"
+  "/root/repo/Simulator/utils/output_generator.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/output_generator.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/output_generator.cpp.o.d"
+  "/root/repo/Simulator/utils/process_sandbox.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/process_sandbox.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/process_sandbox.cpp.o.d"
+  "/root/repo/Simulator/utils/thread_pool.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/thread_pool.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/thread_pool.cpp.o.d"
+  "/root/repo/Simulator/utils/work_stealing_thread_pool.cpp" "Simulator/CMakeFiles/Simulator_lib.dir/utils/work_stealing_thread_pool.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_lib.dir/utils/work_stealing_thread_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/Simulator/libSimulator_lib.a"
+  "/root/repo/build/Simulator/libSimulator_lib.pdb"
+  "CMakeFiles/Simulator_lib.dir/game_modes/base_game_mode.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/game_modes/base_game_mode.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/game_modes/basic_game_mode.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/game_modes/basic_game_mode.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/game_modes/comparative_runner.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/game_modes/comparative_runner.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/game_modes/competitive_runner.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/game_modes/competitive_runner.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/game_runner.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/game_runner.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/registration/AlgorithmRegistrar.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/registration/AlgorithmRegistrar.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistrar.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistrar.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistration.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/registration/GameManagerRegistration.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/registration/PlayerRegistration.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/registration/PlayerRegistration.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/registration/TankAlgorithmRegistration.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/registration/TankAlgorithmRegistration.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/command_line_parser.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/command_line_parser.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/error_collector.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/error_collector.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/file_enumerator.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/file_enumerator.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/file_loader.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/file_loader.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/file_satellite_view.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/file_satellite_view.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/game_manager_pool.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/game_manager_pool.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/library_manager.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/library_manager.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/library_validator.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/library_validator.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/map_cache.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/map_cache.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/mapped_file.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/mapped_file.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/match_scheduler.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/match_scheduler.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/output_generator.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/output_generator.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/process_sandbox.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/process_sandbox.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/thread_pool.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/thread_pool.cpp.o.d"
+  "CMakeFiles/Simulator_lib.dir/utils/work_stealing_thread_pool.cpp.o"
+  "CMakeFiles/Simulator_lib.dir/utils/work_stealing_thread_pool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Simulator_lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
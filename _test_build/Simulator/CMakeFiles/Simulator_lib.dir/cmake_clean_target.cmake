@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/Simulator/libSimulator_lib.a"
+)
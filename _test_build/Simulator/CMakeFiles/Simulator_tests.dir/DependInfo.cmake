@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Simulator/game_modes/base_game_mode_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/game_modes/base_game_mode_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/game_modes/base_game_mode_test.cpp.o.d"
+  "/root/repo/Simulator/game_runner_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/game_runner_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/game_runner_test.cpp.o.d"
+  "/root/repo/Simulator/registration/AlgorithmRegistrar_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/registration/AlgorithmRegistrar_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/registration/AlgorithmRegistrar_test.cpp.o.d"
+  "/root/repo/Simulator/registration/GameManagerRegistrar_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/registration/GameManagerRegistrar_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/registration/GameManagerRegistrar_test.cpp.o.d"
+  "/root/repo/Simulator/registration/PlayerRegistration_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/registration/PlayerRegistration_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/registration/PlayerRegistration_test.cpp.o.d"
+  "/root/repo/Simulator/registration/TankAlgorithmRegistration_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/registration/TankAlgorithmRegistration_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/registration/TankAlgorithmRegistration_test.cpp.o.d"
+  "/root/repo/Simulator/test/helpers/board_info_test_helpers_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/test/helpers/board_info_test_helpers_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/test/helpers/board_info_test_helpers_test.cpp.o.d"
+  "/root/repo/Simulator/test/helpers/registrar_test_helpers_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/test/helpers/registrar_test_helpers_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/test/helpers/registrar_test_helpers_test.cpp.o.d"
+  "/root/repo/Simulator/test/integration/RegistrationIntegration_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/test/integration/RegistrationIntegration_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/test/integration/RegistrationIntegration_test.cpp.o.d"
+  "/root/repo/Simulator/utils/command_line_parser_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/command_line_parser_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/command_line_parser_test.cpp.o.d"
+  "/root/repo/Simulator/utils/error_collector_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/error_collector_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/error_collector_test.cpp.o.d"
+  "/root/repo/Simulator/utils/file_enumerator_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_enumerator_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_enumerator_test.cpp.o.d"
+  "/root/repo/Simulator/utils/file_loader_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_loader_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_loader_test.cpp.o.d"
+  "/root/repo/Simulator/utils/file_satellite_view_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_satellite_view_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/file_satellite_view_test.cpp.o.d"
+  "/root/repo/Simulator/utils/game_manager_pool_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/game_manager_pool_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/game_manager_pool_test.cpp.o.d"
+  "/root/repo/Simulator/utils/library_manager_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/library_manager_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/library_manager_test.cpp.o.d"
+  "/root/repo/Simulator/utils/library_validator_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/library_validator_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/library_validator_test.cpp.o.d"
+  "/root/repo/Simulator/utils/map_cache_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/map_cache_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/map_cache_test.cpp.o.d"
+  "/root/repo/Simulator/utils/match_scheduler_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/match_scheduler_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/match_scheduler_test.cpp.o.d"
+  "/root/repo/Simulator/utils/output_generator_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/output_generator_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/output_generator_test.cpp.o.d"
+  "/root/repo/Simulator/utils/process_sandbox_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/process_sandbox_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/process_sandbox_test.cpp.o.d"
+  "/root/repo/Simulator/utils/thread_pool_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/thread_pool_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/thread_pool_test.cpp.o.d"
+  "/root/repo/Simulator/utils/work_stealing_thread_pool_test.cpp" "Simulator/CMakeFiles/Simulator_tests.dir/utils/work_stealing_thread_pool_test.cpp.o" "gcc" "Simulator/CMakeFiles/Simulator_tests.dir/utils/work_stealing_thread_pool_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/Simulator/CMakeFiles/Simulator_lib.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,56 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/tests/Simulator_tests"
+  "/root/repo/build/tests/Simulator_tests.pdb"
+  "CMakeFiles/Simulator_tests.dir/game_modes/base_game_mode_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/game_modes/base_game_mode_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/game_runner_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/game_runner_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/registration/AlgorithmRegistrar_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/registration/AlgorithmRegistrar_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/registration/GameManagerRegistrar_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/registration/GameManagerRegistrar_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/registration/PlayerRegistration_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/registration/PlayerRegistration_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/registration/TankAlgorithmRegistration_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/registration/TankAlgorithmRegistration_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/test/helpers/board_info_test_helpers_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/test/helpers/board_info_test_helpers_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/test/helpers/registrar_test_helpers_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/test/helpers/registrar_test_helpers_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/test/integration/RegistrationIntegration_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/test/integration/RegistrationIntegration_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/command_line_parser_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/command_line_parser_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/error_collector_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/error_collector_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/file_enumerator_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/file_enumerator_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/file_loader_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/file_loader_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/file_satellite_view_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/file_satellite_view_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/game_manager_pool_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/game_manager_pool_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/library_manager_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/library_manager_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/library_validator_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/library_validator_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/map_cache_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/map_cache_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/match_scheduler_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/match_scheduler_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/output_generator_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/output_generator_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/process_sandbox_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/process_sandbox_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/thread_pool_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/thread_pool_test.cpp.o.d"
+  "CMakeFiles/Simulator_tests.dir/utils/work_stealing_thread_pool_test.cpp.o"
+  "CMakeFiles/Simulator_tests.dir/utils/work_stealing_thread_pool_test.cpp.o.d"
+  "Simulator_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Simulator_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
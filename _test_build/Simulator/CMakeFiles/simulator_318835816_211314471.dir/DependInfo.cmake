@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Simulator/main.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/main.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/main.cpp.o.d"
+  "/root/repo/Simulator/registration/AlgorithmRegistrar.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/AlgorithmRegistrar.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/AlgorithmRegistrar.cpp.o.d"
+  "/root/repo/Simulator/registration/GameManagerRegistrar.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistrar.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistrar.cpp.o.d"
+  "/root/repo/Simulator/registration/GameManagerRegistration.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistration.cpp.o.d"
+  "/root/repo/Simulator/registration/PlayerRegistration.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/PlayerRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/PlayerRegistration.cpp.o.d"
+  "/root/repo/Simulator/registration/TankAlgorithmRegistration.cpp" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/TankAlgorithmRegistration.cpp.o" "gcc" "Simulator/CMakeFiles/simulator_318835816_211314471.dir/registration/TankAlgorithmRegistration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/Simulator/CMakeFiles/Simulator_lib.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/UserCommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
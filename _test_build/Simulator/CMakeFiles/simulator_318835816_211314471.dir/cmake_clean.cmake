@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "/root/repo/Simulator/simulator_318835816_211314471"
+  "/root/repo/Simulator/simulator_318835816_211314471.pdb"
+  "CMakeFiles/simulator_318835816_211314471.dir/main.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/main.cpp.o.d"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/AlgorithmRegistrar.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/AlgorithmRegistrar.cpp.o.d"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistrar.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistrar.cpp.o.d"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistration.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/GameManagerRegistration.cpp.o.d"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/PlayerRegistration.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/PlayerRegistration.cpp.o.d"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/TankAlgorithmRegistration.cpp.o"
+  "CMakeFiles/simulator_318835816_211314471.dir/registration/TankAlgorithmRegistration.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simulator_318835816_211314471.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
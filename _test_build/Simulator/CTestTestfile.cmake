@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Simulator
+# Build directory: /root/repo/_test_build/Simulator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_test_build/Simulator/Simulator_tests[1]_include.cmake")
+add_test(Simulator_tests "/root/repo/build/tests/Simulator_tests")
+set_tests_properties(Simulator_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/Simulator/CMakeLists.txt;88;add_test;/root/repo/Simulator/CMakeLists.txt;0;")
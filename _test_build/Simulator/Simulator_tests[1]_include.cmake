@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/Simulator/Simulator_tests[1]_tests.cmake")
+  include("/root/repo/_test_build/Simulator/Simulator_tests[1]_tests.cmake")
+else()
+  add_test(Simulator_tests_NOT_BUILT Simulator_tests_NOT_BUILT)
+endif()
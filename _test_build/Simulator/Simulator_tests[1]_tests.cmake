@@ -0,0 +1,597 @@
+add_test([=[BaseGameModeTest.ConstructorInitializesLibraryManager]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ConstructorInitializesLibraryManager]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ConstructorInitializesLibraryManager]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteSuccessfulFlow]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteSuccessfulFlow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteSuccessfulFlow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteWithVerboseFalse]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteWithVerboseFalse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteWithVerboseFalse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteFailsOnLoadLibraries]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteFailsOnLoadLibraries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteFailsOnLoadLibraries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteFailsOnLoadMap]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteFailsOnLoadMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteFailsOnLoadMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteHandlesException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteHandlesException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteHandlesException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ExecuteFailsOnEmptyMapFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ExecuteFailsOnEmptyMapFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ExecuteFailsOnEmptyMapFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.CreateErrorResult]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.CreateErrorResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.CreateErrorResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.GenerateTimestamp]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.GenerateTimestamp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.GenerateTimestamp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.GenerateTimestampWithMilliseconds]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.GenerateTimestampWithMilliseconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.GenerateTimestampWithMilliseconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.EnumerateFilesWithSoExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.EnumerateFilesWithSoExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.EnumerateFilesWithSoExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.EnumerateFilesWithTxtExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.EnumerateFilesWithTxtExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.EnumerateFilesWithTxtExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.EnumerateFilesWithUnsupportedExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.EnumerateFilesWithUnsupportedExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.EnumerateFilesWithUnsupportedExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ValidateLibraryGameManager]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ValidateLibraryGameManager]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ValidateLibraryGameManager]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ValidateLibraryAlgorithm]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ValidateLibraryAlgorithm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ValidateLibraryAlgorithm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.ValidateLibraryUnknownType]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.ValidateLibraryUnknownType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.ValidateLibraryUnknownType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BaseGameModeTest.CleanupMethod]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BaseGameModeTest.CleanupMethod]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BaseGameModeTest.CleanupMethod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.RegistrarsStartEmpty]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.RegistrarsStartEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.RegistrarsStartEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.SuccessfulGameExecution]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.SuccessfulGameExecution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.SuccessfulGameExecution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.VerboseModeHandling]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.VerboseModeHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.VerboseModeHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.ValidBoardInfoProcessing]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.ValidBoardInfoProcessing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.ValidBoardInfoProcessing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.SameAlgorithmBothPlayers]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.SameAlgorithmBothPlayers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.SameAlgorithmBothPlayers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.NullSatelliteView]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.NullSatelliteView]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.NullSatelliteView]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.GameManagerNotFound]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.GameManagerNotFound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.GameManagerNotFound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.Algorithm1NotFound]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.Algorithm1NotFound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.Algorithm1NotFound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.Algorithm2NotFound]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.Algorithm2NotFound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.Algorithm2NotFound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.IncompleteAlgorithm1]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.IncompleteAlgorithm1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.IncompleteAlgorithm1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.IncompleteAlgorithm2]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.IncompleteAlgorithm2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.IncompleteAlgorithm2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.EmptyRegistrars]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.EmptyRegistrars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.EmptyRegistrars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.MultipleGameExecutionWithSameBoardInfo]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.MultipleGameExecutionWithSameBoardInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.MultipleGameExecutionWithSameBoardInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.RealRegistrarIntegrationPattern]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.RealRegistrarIntegrationPattern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.RealRegistrarIntegrationPattern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.ValidateCleanupBetweenTests]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.ValidateCleanupBetweenTests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.ValidateCleanupBetweenTests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameRunnerTest.DifferentBoardSizes]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameRunnerTest.DifferentBoardSizes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameRunnerTest.DifferentBoardSizes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.GetSingleton]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.GetSingleton]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.GetSingleton]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.CreateAlgorithmFactoryEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.CreateAlgorithmFactoryEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.CreateAlgorithmFactoryEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.AddPlayerFactoryToLastEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.AddPlayerFactoryToLastEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.AddPlayerFactoryToLastEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.AddTankAlgorithmFactoryToLastEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.AddTankAlgorithmFactoryToLastEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.AddTankAlgorithmFactoryToLastEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.ValidateLastRegistration_Complete]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.ValidateLastRegistration_Complete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.ValidateLastRegistration_Complete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.ValidateLastRegistration_Incomplete_ThrowsException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.ValidateLastRegistration_Incomplete_ThrowsException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.ValidateLastRegistration_Incomplete_ThrowsException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.ValidateLastRegistration_NoEntry_ThrowsException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.ValidateLastRegistration_NoEntry_ThrowsException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.ValidateLastRegistration_NoEntry_ThrowsException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.AddFactoryToEmptyRegistrar_ThrowsException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.AddFactoryToEmptyRegistrar_ThrowsException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.AddFactoryToEmptyRegistrar_ThrowsException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.RemoveLast]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.RemoveLast]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.RemoveLast]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AlgorithmRegistrarTest.IteratorSupport]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=AlgorithmRegistrarTest.IteratorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AlgorithmRegistrarTest.IteratorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.SingletonBehavior]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.SingletonBehavior]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.SingletonBehavior]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.CreateGameManagerEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.CreateGameManagerEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.CreateGameManagerEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.CreateAndAddFactory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.CreateAndAddFactory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.CreateAndAddFactory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.ValidationFailsWithoutFactory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.ValidationFailsWithoutFactory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.ValidationFailsWithoutFactory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.ValidationFailsWithEmptyName]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.ValidationFailsWithEmptyName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.ValidationFailsWithEmptyName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.ExceptionContainsCorrectInfo]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.ExceptionContainsCorrectInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.ExceptionContainsCorrectInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.FindByName]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.FindByName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.FindByName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.CreateGameManagerInstance]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.CreateGameManagerInstance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.CreateGameManagerInstance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.CreateGameManagerInstanceWithoutVerbose]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.CreateGameManagerInstanceWithoutVerbose]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.CreateGameManagerInstanceWithoutVerbose]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.RemoveLastEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.RemoveLastEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.RemoveLastEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.IteratorSupport]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.IteratorSupport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.IteratorSupport]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.ClearRegistrar]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.ClearRegistrar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.ClearRegistrar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerRegistrarTest.GameManagerEntryHasFactory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerRegistrarTest.GameManagerEntryHasFactory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerRegistrarTest.GameManagerEntryHasFactory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlayerRegistrationTest.PlayerRegistration_AddsFactoryToRegistrar]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=PlayerRegistrationTest.PlayerRegistration_AddsFactoryToRegistrar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlayerRegistrationTest.PlayerRegistration_AddsFactoryToRegistrar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlayerRegistrationTest.PlayerRegistration_NoEntry_ThrowsException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=PlayerRegistrationTest.PlayerRegistration_NoEntry_ThrowsException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlayerRegistrationTest.PlayerRegistration_NoEntry_ThrowsException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PlayerRegistrationTest.RegisterPlayerMacro_CreatesRegistration]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=PlayerRegistrationTest.RegisterPlayerMacro_CreatesRegistration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PlayerRegistrationTest.RegisterPlayerMacro_CreatesRegistration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankAlgorithmRegistrationTest.TankAlgorithmRegistration_AddsFactoryToRegistrar]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=TankAlgorithmRegistrationTest.TankAlgorithmRegistration_AddsFactoryToRegistrar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankAlgorithmRegistrationTest.TankAlgorithmRegistration_AddsFactoryToRegistrar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankAlgorithmRegistrationTest.TankAlgorithmRegistration_NoEntry_ThrowsException]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=TankAlgorithmRegistrationTest.TankAlgorithmRegistration_NoEntry_ThrowsException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankAlgorithmRegistrationTest.TankAlgorithmRegistration_NoEntry_ThrowsException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankAlgorithmRegistrationTest.RegisterTankAlgorithmMacro_CreatesRegistration]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=TankAlgorithmRegistrationTest.RegisterTankAlgorithmMacro_CreatesRegistration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankAlgorithmRegistrationTest.RegisterTankAlgorithmMacro_CreatesRegistration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardInfoTestHelpersTest.CreateValidBoardInfo]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BoardInfoTestHelpersTest.CreateValidBoardInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardInfoTestHelpersTest.CreateValidBoardInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardInfoTestHelpersTest.CreateInvalidBoardInfo]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BoardInfoTestHelpersTest.CreateInvalidBoardInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardInfoTestHelpersTest.CreateInvalidBoardInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardInfoTestHelpersTest.CreateCustomBoardInfo]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=BoardInfoTestHelpersTest.CreateCustomBoardInfo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardInfoTestHelpersTest.CreateCustomBoardInfo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.ClearAllRegistrars]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.ClearAllRegistrars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.ClearAllRegistrars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.SetupMockRegistrars]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.SetupMockRegistrars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.SetupMockRegistrars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.SetupIncompleteAlgorithm]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.SetupIncompleteAlgorithm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.SetupIncompleteAlgorithm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.SetupGameManagerRegistrar]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.SetupGameManagerRegistrar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.SetupGameManagerRegistrar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.SetupCompleteAlgorithm]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.SetupCompleteAlgorithm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.SetupCompleteAlgorithm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrarTestHelpersTest.RegistrarsStartEmpty]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrarTestHelpersTest.RegistrarsStartEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrarTestHelpersTest.RegistrarsStartEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.SuccessfulRegistration]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.SuccessfulRegistration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.SuccessfulRegistration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.FailedRegistration_IncompleteEntry]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.FailedRegistration_IncompleteEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.FailedRegistration_IncompleteEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.MultipleSuccessfulRegistrations]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.MultipleSuccessfulRegistrations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.MultipleSuccessfulRegistrations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.MixedRegistrations_SuccessAndFailure]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.MixedRegistrations_SuccessAndFailure]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.MixedRegistrations_SuccessAndFailure]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.RegistrationOrder_PlayerFirst]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.RegistrationOrder_PlayerFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.RegistrationOrder_PlayerFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegistrationIntegrationTest.RegistrationOrder_TankAlgorithmFirst]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=RegistrationIntegrationTest.RegistrationOrder_TankAlgorithmFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegistrationIntegrationTest.RegistrationOrder_TankAlgorithmFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_ValidArguments]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_ValidArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_ValidArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_WithVerbose]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_WithVerbose]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_WithVerbose]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_DifferentOrder]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_DifferentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_DifferentOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_NumThreads_ShouldFail]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_NumThreads_ShouldFail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_NumThreads_ShouldFail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_MissingFlag]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_MissingFlag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_MissingFlag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_MissingParameters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_MissingParameters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_MissingParameters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_UnsupportedParameter]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_UnsupportedParameter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_UnsupportedParameter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_PositionalArgument_ShouldFail]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_PositionalArgument_ShouldFail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_PositionalArgument_ShouldFail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ComparativeMode_ValidArguments]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ComparativeMode_ValidArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ComparativeMode_ValidArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ComparativeMode_DifferentOrder]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ComparativeMode_DifferentOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ComparativeMode_DifferentOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ComparativeMode_MissingRequired]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ComparativeMode_MissingRequired]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ComparativeMode_MissingRequired]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_ValidArguments]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_ValidArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_ValidArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_MissingRequired]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_MissingRequired]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_MissingRequired]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_MatchHistory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_MatchHistory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_MatchHistory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_MapCache]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_MapCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_MapCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_SandboxWithLimits]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_SandboxWithLimits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_SandboxWithLimits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_LimitsRequireSandbox]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_LimitsRequireSandbox]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_LimitsRequireSandbox]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_InvalidLimit]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_InvalidLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_InvalidLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionMode_ReuseGameManagers]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionMode_ReuseGameManagers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionMode_ReuseGameManagers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_ReuseGameManagersUnsupported]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_ReuseGameManagersUnsupported]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_ReuseGameManagersUnsupported]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicMode_SandboxUnsupported]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicMode_SandboxUnsupported]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicMode_SandboxUnsupported]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ComparativeMode_MatchHistoryUnsupported]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ComparativeMode_MatchHistoryUnsupported]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ComparativeMode_MatchHistoryUnsupported]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.KeyValueParsing_NoSpacesAroundEquals]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.KeyValueParsing_NoSpacesAroundEquals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.KeyValueParsing_NoSpacesAroundEquals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.KeyValueParsing_EmptyKey]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.KeyValueParsing_EmptyKey]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.KeyValueParsing_EmptyKey]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.KeyValueParsing_EmptyValue]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.KeyValueParsing_EmptyValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.KeyValueParsing_EmptyValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.KeyValueParsing_NoEquals]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.KeyValueParsing_NoEquals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.KeyValueParsing_NoEquals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.NumThreads_ValidPositive]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.NumThreads_ValidPositive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.NumThreads_ValidPositive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.NumThreads_Zero]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.NumThreads_Zero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.NumThreads_Zero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.NumThreads_Negative]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.NumThreads_Negative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.NumThreads_Negative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.NumThreads_InvalidNumber]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.NumThreads_InvalidNumber]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.NumThreads_InvalidNumber]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ModeConflict_BasicAndComparative]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ModeConflict_BasicAndComparative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ModeConflict_BasicAndComparative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ModeConflict_AllThreeFlags]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ModeConflict_AllThreeFlags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ModeConflict_AllThreeFlags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.NoModeFlag_WithKeyValueParams]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.NoModeFlag_WithKeyValueParams]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.NoModeFlag_WithKeyValueParams]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.VerboseFlag_SingleDashOnly]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.VerboseFlag_SingleDashOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.VerboseFlag_SingleDashOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.VerboseFlag_DoubleDash_ShouldFail]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.VerboseFlag_DoubleDash_ShouldFail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.VerboseFlag_DoubleDash_ShouldFail]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.BasicModeAccessors_WrongMode]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.BasicModeAccessors_WrongMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.BasicModeAccessors_WrongMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ComparativeModeAccessors_WrongMode]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ComparativeModeAccessors_WrongMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ComparativeModeAccessors_WrongMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.CompetitionModeAccessors_WrongMode]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.CompetitionModeAccessors_WrongMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.CompetitionModeAccessors_WrongMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.GenerateUsage]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.GenerateUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.GenerateUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.ResetFunctionality]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.ResetFunctionality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.ResetFunctionality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.EmptyArguments]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.EmptyArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.EmptyArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.OnlyModeFlag]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.OnlyModeFlag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.OnlyModeFlag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CommandLineParserTest.UnknownFlag]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=CommandLineParserTest.UnknownFlag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CommandLineParserTest.UnknownFlag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.ConstructorInitializesEmpty]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.ConstructorInitializesEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.ConstructorInitializesEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.AddMapWarningsStoresErrors]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.AddMapWarningsStoresErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.AddMapWarningsStoresErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.AddMultipleMapWarnings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.AddMultipleMapWarnings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.AddMultipleMapWarnings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.SaveToFileWithNoErrors]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.SaveToFileWithNoErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.SaveToFileWithNoErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.SaveToFileWithErrors]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.SaveToFileWithErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.SaveToFileWithErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.ClearRemovesAllErrors]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.ClearRemovesAllErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.ClearRemovesAllErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.FormatMapWarningWithSpecialCharacters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.FormatMapWarningWithSpecialCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.FormatMapWarningWithSpecialCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.FormatMapWarningWithEmptyStrings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.FormatMapWarningWithEmptyStrings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.FormatMapWarningWithEmptyStrings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.SaveToFilePreservesOrder]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.SaveToFilePreservesOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.SaveToFilePreservesOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.GetAllErrorsReturnsConstReference]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.GetAllErrorsReturnsConstReference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.GetAllErrorsReturnsConstReference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.AddMapErrorStoresError]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.AddMapErrorStoresError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.AddMapErrorStoresError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.AddMapWarningStoresWarning]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.AddMapWarningStoresWarning]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.AddMapWarningStoresWarning]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.MixedErrorsAndWarnings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.MixedErrorsAndWarnings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.MixedErrorsAndWarnings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.ClearResetsCounters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.ClearResetsCounters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.ClearResetsCounters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.ErrorCountWithMultipleWarnings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.ErrorCountWithMultipleWarnings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.ErrorCountWithMultipleWarnings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ErrorCollectorTest.AddAllAppendsInOrder]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ErrorCollectorTest.AddAllAppendsInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ErrorCollectorTest.AddAllAppendsInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.EnumerateSoFiles_ValidDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.EnumerateSoFiles_ValidDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.EnumerateSoFiles_ValidDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.EnumerateSoFiles_NonexistentDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.EnumerateSoFiles_NonexistentDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.EnumerateSoFiles_NonexistentDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.EnumerateSoFiles_EmptyDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.EnumerateSoFiles_EmptyDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.EnumerateSoFiles_EmptyDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.EnumerateMapFiles_ValidDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.EnumerateMapFiles_ValidDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.EnumerateMapFiles_ValidDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.IsValidDirectory_ValidDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.IsValidDirectory_ValidDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.IsValidDirectory_ValidDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.IsValidDirectory_NonexistentDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.IsValidDirectory_NonexistentDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.IsValidDirectory_NonexistentDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.IsValidDirectory_EmptyPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.IsValidDirectory_EmptyPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.IsValidDirectory_EmptyPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.IsValidDirectory_FileAsDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.IsValidDirectory_FileAsDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.IsValidDirectory_FileAsDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.ErrorHandling_ThreadLocal]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.ErrorHandling_ThreadLocal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.ErrorHandling_ThreadLocal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileEnumeratorTest.EnumerateFiles_DoesNotIncludeNestedDirectories]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileEnumeratorTest.EnumerateFiles_DoesNotIncludeNestedDirectories]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileEnumeratorTest.EnumerateFiles_DoesNotIncludeNestedDirectories]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_NonexistentFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_NonexistentFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_NonexistentFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_EmptyFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_EmptyFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_EmptyFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_ValidFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_ValidFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_ValidFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_InvalidRows]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_InvalidRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_InvalidRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_MissingHeaderLine]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_MissingHeaderLine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_MissingHeaderLine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_ExtraWhitespace]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_ExtraWhitespace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_ExtraWhitespace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_OnlyHeaders]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_OnlyHeaders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_OnlyHeaders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_TrailingWhitespace]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_TrailingWhitespace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_TrailingWhitespace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_LeadingWhitespace]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_LeadingWhitespace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_LeadingWhitespace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_NegativeMaxSteps]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_NegativeMaxSteps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_NegativeMaxSteps]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_NegativeNumShells]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_NegativeNumShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_NegativeNumShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardFile_NegativeCols]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardFile_NegativeCols]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardFile_NegativeCols]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_ValidFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_ValidFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_ValidFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_NonexistentFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_NonexistentFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_NonexistentFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_EmptyFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_EmptyFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_EmptyFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_ComplexBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_ComplexBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_ComplexBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.BoardInfoValidation_ValidBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.BoardInfoValidation_ValidBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.BoardInfoValidation_ValidBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.BoardInfoValidation_InvalidBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.BoardInfoValidation_InvalidBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.BoardInfoValidation_InvalidBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.BoardInfoValidation_BoardWithWarnings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.BoardInfoValidation_BoardWithWarnings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.BoardInfoValidation_BoardWithWarnings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.BoardInfoValidation_NullSatelliteView]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.BoardInfoValidation_NullSatelliteView]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.BoardInfoValidation_NullSatelliteView]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_LastLineWithoutNewline]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_LastLineWithoutNewline]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_LastLineWithoutNewline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.LoadBoardWithSatelliteView_RecoversRowsOnRead]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.LoadBoardWithSatelliteView_RecoversRowsOnRead]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.LoadBoardWithSatelliteView_RecoversRowsOnRead]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileLoaderTest.Benchmark_MappedComparedToCopiedLoad]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileLoaderTest.DISABLED_Benchmark_MappedComparedToCopiedLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileLoaderTest.Benchmark_MappedComparedToCopiedLoad]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[FileLoaderTest.Benchmark_MappedComparedToCopiedLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.BasicConstruction]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.BasicConstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.BasicConstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.OutOfBoundsAccess]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.OutOfBoundsAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.OutOfBoundsAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.EmptyBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.EmptyBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.EmptyBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.VariableLengthRows]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.VariableLengthRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.VariableLengthRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.InvalidCharacterHandling]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.InvalidCharacterHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.InvalidCharacterHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.AllValidCharacters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.AllValidCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.AllValidCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.OutOfBoundsCharacterHandling]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.OutOfBoundsCharacterHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.OutOfBoundsCharacterHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.BoardDimensionsVsStringLength]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.BoardDimensionsVsStringLength]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.BoardDimensionsVsStringLength]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationDefaultState]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationDefaultState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationDefaultState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationEmptyBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationEmptyBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationEmptyBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationWithVariousBoards]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationWithVariousBoards]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationWithVariousBoards]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationNoTanksError]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationNoTanksError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationNoTanksError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationZeroDimensionsError]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationZeroDimensionsError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationZeroDimensionsError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationShortRowsRecovery]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationShortRowsRecovery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationShortRowsRecovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationMissingRowsRecovery]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationMissingRowsRecovery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationMissingRowsRecovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationExtraRowsRecovery]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationExtraRowsRecovery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationExtraRowsRecovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationLongRowsRecovery]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationLongRowsRecovery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationLongRowsRecovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.ValidationMultipleInvalidCharacters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.ValidationMultipleInvalidCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.ValidationMultipleInvalidCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.RowAccess]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.RowAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.RowAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileSatelliteViewTest.CompiledMapIsSharedAndRecovered]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=FileSatelliteViewTest.CompiledMapIsSharedAndRecovered]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FileSatelliteViewTest.CompiledMapIsSharedAndRecovered]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerPoolTest.ReusableManagerIsResetAndReused]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerPoolTest.ReusableManagerIsResetAndReused]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerPoolTest.ReusableManagerIsResetAndReused]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerPoolTest.OtherManagersAreNotKept]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerPoolTest.OtherManagersAreNotKept]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerPoolTest.OtherManagersAreNotKept]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameManagerPoolTest.ClearDestroysIdleManagers]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=GameManagerPoolTest.ClearDestroysIdleManagers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameManagerPoolTest.ClearDestroysIdleManagers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.SingletonPattern]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.SingletonPattern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.SingletonPattern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadValidLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadValidLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadValidLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadNonExistentLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadNonExistentLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadNonExistentLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadEmptyPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadEmptyPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadEmptyPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadDuplicateLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadDuplicateLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadDuplicateLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadMultipleLibraries]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadMultipleLibraries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadMultipleLibraries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.UnloadAllLibraries]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.UnloadAllLibraries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.UnloadAllLibraries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.ErrorClearingBetweenOperations]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.ErrorClearingBetweenOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.ErrorClearingBetweenOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryManagerTest.LoadInvalidSharedLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryManagerTest.LoadInvalidSharedLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryManagerTest.LoadInvalidSharedLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_DefaultConstructor]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_PathConstructor]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_PathConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_PathConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_PathConstructor_ComplexPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_PathConstructor_ComplexPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_PathConstructor_ComplexPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_PathConstructor_WindowsPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_PathConstructor_WindowsPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_PathConstructor_WindowsPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_PathConstructor_NoExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_PathConstructor_NoExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_PathConstructor_NoExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_IsReady]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_IsReady]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_IsReady]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.IsValidLibraryFile_ValidFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.IsValidLibraryFile_ValidFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.IsValidLibraryFile_ValidFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.IsValidLibraryFile_NonexistentFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.IsValidLibraryFile_NonexistentFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.IsValidLibraryFile_NonexistentFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.IsValidLibraryFile_EmptyPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.IsValidLibraryFile_EmptyPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.IsValidLibraryFile_EmptyPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.IsValidLibraryFile_WrongExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.IsValidLibraryFile_WrongExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.IsValidLibraryFile_WrongExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.IsValidLibraryFile_Directory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.IsValidLibraryFile_Directory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.IsValidLibraryFile_Directory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ValidateAlgorithm_InvalidFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ValidateAlgorithm_InvalidFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ValidateAlgorithm_InvalidFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ValidateAlgorithm_WrongExtension]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ValidateAlgorithm_WrongExtension]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ValidateAlgorithm_WrongExtension]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ValidateAlgorithm_ValidFileButInvalidLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ValidateAlgorithm_ValidFileButInvalidLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ValidateAlgorithm_ValidFileButInvalidLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ValidateGameManager_InvalidFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ValidateGameManager_InvalidFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ValidateGameManager_InvalidFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ValidateGameManager_ValidFileButInvalidLibrary]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ValidateGameManager_ValidFileButInvalidLibrary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ValidateGameManager_ValidFileButInvalidLibrary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ErrorHandling_ThreadLocal]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ErrorHandling_ThreadLocal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ErrorHandling_ThreadLocal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.ErrorHandling_ClearOnSuccess]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.ErrorHandling_ClearOnSuccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.ErrorHandling_ClearOnSuccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.Cleanup_NoErrors]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.Cleanup_NoErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.Cleanup_NoErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LibraryValidatorTest.LibraryInfo_NameExtraction_EdgeCases]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=LibraryValidatorTest.LibraryInfo_NameExtraction_EdgeCases]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LibraryValidatorTest.LibraryInfo_NameExtraction_EdgeCases]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.StoredBoardLoadsBackWithWarnings]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.StoredBoardLoadsBackWithWarnings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.StoredBoardLoadsBackWithWarnings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.ChangedMapIsNotLoaded]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.ChangedMapIsNotLoaded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.ChangedMapIsNotLoaded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.MapChangedDuringParseIsNotStored]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.MapChangedDuringParseIsNotStored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.MapChangedDuringParseIsNotStored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.DamagedCountsAreAMiss]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.DamagedCountsAreAMiss]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.DamagedCountsAreAMiss]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.InvalidBoardIsNotStored]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.InvalidBoardIsNotStored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.InvalidBoardIsNotStored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MapCacheTest.Benchmark_ParseComparedToCacheHit]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MapCacheTest.DISABLED_Benchmark_ParseComparedToCacheHit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MapCacheTest.Benchmark_ParseComparedToCacheHit]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[MapCacheTest.Benchmark_ParseComparedToCacheHit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.EstimateCost_GrowsWithBoardStepsAndTanks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.EstimateCost_GrowsWithBoardStepsAndTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.EstimateCost_GrowsWithBoardStepsAndTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.Schedule_WithoutHistorySortsByCost]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.Schedule_WithoutHistorySortsByCost]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.Schedule_WithoutHistorySortsByCost]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.Schedule_UsesHistoryBeforeCost]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.Schedule_UsesHistoryBeforeCost]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.Schedule_UsesHistoryBeforeCost]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.LoadHistory_MissingFile]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.LoadHistory_MissingFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.LoadHistory_MissingFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.SaveReport_MergesWithHistory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.SaveReport_MergesWithHistory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.SaveReport_MergesWithHistory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.SaveReport_KeepsNamesWithSpaces]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.SaveReport_KeepsNamesWithSpaces]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.SaveReport_KeepsNamesWithSpaces]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.SaveReport_SkipsNamesWithTabs]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.SaveReport_SkipsNamesWithTabs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.SaveReport_SkipsNamesWithTabs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchSchedulerTest.Benchmark_LongestFirstMakespan]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=MatchSchedulerTest.DISABLED_Benchmark_LongestFirstMakespan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchSchedulerTest.Benchmark_LongestFirstMakespan]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[MatchSchedulerTest.Benchmark_LongestFirstMakespan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.GenerateTimestamp_BasicFormat]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.GenerateTimestamp_BasicFormat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.GenerateTimestamp_BasicFormat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.GenerateTimestamp_WithMilliseconds]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.GenerateTimestamp_WithMilliseconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.GenerateTimestamp_WithMilliseconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.GenerateTimestamp_Uniqueness]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.GenerateTimestamp_Uniqueness]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.GenerateTimestamp_Uniqueness]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.WriteToFile_Success]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.WriteToFile_Success]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.WriteToFile_Success]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.WriteToFile_NonexistentDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.WriteToFile_NonexistentDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.WriteToFile_NonexistentDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.WriteToFile_InvalidPath]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.WriteToFile_InvalidPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.WriteToFile_InvalidPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.FormatGameResult_Winner]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.FormatGameResult_Winner]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.FormatGameResult_Winner]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.FormatGameResult_Tie]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.FormatGameResult_Tie]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.FormatGameResult_Tie]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.FormatGameResult_ZeroShells]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.FormatGameResult_ZeroShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.FormatGameResult_ZeroShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.FormatGameState_SmallBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.FormatGameState_SmallBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.FormatGameState_SmallBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.FormatGameState_LargerBoard]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.FormatGameState_LargerBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.FormatGameState_LargerBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.CreateOutputPath_BasicUsage]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.CreateOutputPath_BasicUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.CreateOutputPath_BasicUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.CreateOutputPath_WithDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.CreateOutputPath_WithDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.CreateOutputPath_WithDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.CreateOutputPath_WithMilliseconds]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.CreateOutputPath_WithMilliseconds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.CreateOutputPath_WithMilliseconds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.CreateOutputPath_EmptyDirectory]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.CreateOutputPath_EmptyDirectory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.CreateOutputPath_EmptyDirectory]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.ErrorHandling_ThreadLocal]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.ErrorHandling_ThreadLocal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.ErrorHandling_ThreadLocal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.WriteToFile_ClearsPreviousError]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.WriteToFile_ClearsPreviousError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.WriteToFile_ClearsPreviousError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.EnsureDirectoryExists_DeepNesting]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.EnsureDirectoryExists_DeepNesting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.EnsureDirectoryExists_DeepNesting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OutputGeneratorTest.WriteToFile_FilePermissions]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=OutputGeneratorTest.WriteToFile_FilePermissions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OutputGeneratorTest.WriteToFile_FilePermissions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_ReturnsResultsByIndex]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_ReturnsResultsByIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_ReturnsResultsByIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_ReusesWarmWorkers]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_ReusesWarmWorkers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_ReusesWarmWorkers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_CrashOnlyFailsItsMatch]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_CrashOnlyFailsItsMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_CrashOnlyFailsItsMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_ExceptionFailsMatch]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_ExceptionFailsMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_ExceptionFailsMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_CpuLimitStopsEndlessMatch]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_CpuLimitStopsEndlessMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_CpuLimitStopsEndlessMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_WallLimitStopsSleepingMatch]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_WallLimitStopsSleepingMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_WallLimitStopsSleepingMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_WallLimitStopsBlockedMatchUnderCpuLimit]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_WallLimitStopsBlockedMatchUnderCpuLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_WallLimitStopsBlockedMatchUnderCpuLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.RunMatches_MemoryLimitStopsMemoryBlowup]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.RunMatches_MemoryLimitStopsMemoryBlowup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.RunMatches_MemoryLimitStopsMemoryBlowup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProcessSandboxTest.Benchmark_ComparedToInProcess]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ProcessSandboxTest.DISABLED_Benchmark_ComparedToInProcess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProcessSandboxTest.Benchmark_ComparedToInProcess]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[ProcessSandboxTest.Benchmark_ComparedToInProcess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ConstructorWithDefaultThreads]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ConstructorWithDefaultThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ConstructorWithDefaultThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ConstructorWithSpecificThreads]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ConstructorWithSpecificThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ConstructorWithSpecificThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.SingleThreadedMode]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.SingleThreadedMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.SingleThreadedMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.MultiThreadedMode]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.MultiThreadedMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.MultiThreadedMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ThreadCountNeverEquals2]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ThreadCountNeverEquals2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ThreadCountNeverEquals2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ConstructorWithZeroThreads]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ConstructorWithZeroThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ConstructorWithZeroThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.SimpleTaskExecution]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.SimpleTaskExecution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.SimpleTaskExecution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.SingleThreadedExecution]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.SingleThreadedExecution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.SingleThreadedExecution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.MultipleTaskExecution]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.MultipleTaskExecution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.MultipleTaskExecution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TaskWithParameters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.TaskWithParameters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TaskWithParameters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TasksExecuteInParallel]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.TasksExecuteInParallel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TasksExecuteInParallel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.WaitForAllTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.WaitForAllTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.WaitForAllTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ExceptionHandling]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ExceptionHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ExceptionHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TaskQueueGrowth]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.TaskQueueGrowth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TaskQueueGrowth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ThreadSafety]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ThreadSafety]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ThreadSafety]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ShutdownPreventsNewTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.ShutdownPreventsNewTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ShutdownPreventsNewTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.DestructorWaitsForTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.DestructorWaitsForTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.DestructorWaitsForTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.LargeNumberOfTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.LargeNumberOfTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.LargeNumberOfTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TaskReturnValues]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.TaskReturnValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TaskReturnValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.StressTest]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=ThreadPoolTest.StressTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.StressTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.ThreadCounts]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.ThreadCounts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.ThreadCounts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.SingleThreadedRunsOnCallerThread]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.SingleThreadedRunsOnCallerThread]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.SingleThreadedRunsOnCallerThread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.TaskReturnValuesAndParameters]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.TaskReturnValuesAndParameters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.TaskReturnValuesAndParameters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.MoveOnlyArguments]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.MoveOnlyArguments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.MoveOnlyArguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.ExceptionReachesFuture]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.ExceptionReachesFuture]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.ExceptionReachesFuture]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.WaitForAllSubmittedTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.WaitForAllSubmittedTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.WaitForAllSubmittedTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.TasksSubmittedFromTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.TasksSubmittedFromTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.TasksSubmittedFromTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.IdleWorkersStealQueuedTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.IdleWorkersStealQueuedTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.IdleWorkersStealQueuedTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.ShutdownPreventsNewTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.ShutdownPreventsNewTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.ShutdownPreventsNewTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.DestructorRunsQueuedTasks]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.DestructorRunsQueuedTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.DestructorRunsQueuedTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.Benchmark_ComparedToThreadPool]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.DISABLED_Benchmark_ComparedToThreadPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.Benchmark_ComparedToThreadPool]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[WorkStealingThreadPoolTest.Benchmark_ComparedToThreadPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WorkStealingThreadPoolTest.Benchmark_SubmitBarrierComparedToFutures]=]  /root/repo/build/tests/Simulator_tests [==[--gtest_filter=WorkStealingThreadPoolTest.DISABLED_Benchmark_SubmitBarrierComparedToFutures]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WorkStealingThreadPoolTest.Benchmark_SubmitBarrierComparedToFutures]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[WorkStealingThreadPoolTest.Benchmark_SubmitBarrierComparedToFutures]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build/Simulator SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  Simulator_tests_TESTS BaseGameModeTest.ConstructorInitializesLibraryManager BaseGameModeTest.ExecuteSuccessfulFlow BaseGameModeTest.ExecuteWithVerboseFalse BaseGameModeTest.ExecuteFailsOnLoadLibraries BaseGameModeTest.ExecuteFailsOnLoadMap BaseGameModeTest.ExecuteHandlesException BaseGameModeTest.ExecuteFailsOnEmptyMapFile BaseGameModeTest.CreateErrorResult BaseGameModeTest.GenerateTimestamp BaseGameModeTest.GenerateTimestampWithMilliseconds BaseGameModeTest.EnumerateFilesWithSoExtension BaseGameModeTest.EnumerateFilesWithTxtExtension BaseGameModeTest.EnumerateFilesWithUnsupportedExtension BaseGameModeTest.ValidateLibraryGameManager BaseGameModeTest.ValidateLibraryAlgorithm BaseGameModeTest.ValidateLibraryUnknownType BaseGameModeTest.CleanupMethod GameRunnerTest.RegistrarsStartEmpty GameRunnerTest.SuccessfulGameExecution GameRunnerTest.VerboseModeHandling GameRunnerTest.ValidBoardInfoProcessing GameRunnerTest.SameAlgorithmBothPlayers GameRunnerTest.NullSatelliteView GameRunnerTest.GameManagerNotFound GameRunnerTest.Algorithm1NotFound GameRunnerTest.Algorithm2NotFound GameRunnerTest.IncompleteAlgorithm1 GameRunnerTest.IncompleteAlgorithm2 GameRunnerTest.EmptyRegistrars GameRunnerTest.MultipleGameExecutionWithSameBoardInfo GameRunnerTest.RealRegistrarIntegrationPattern GameRunnerTest.ValidateCleanupBetweenTests GameRunnerTest.DifferentBoardSizes AlgorithmRegistrarTest.GetSingleton AlgorithmRegistrarTest.CreateAlgorithmFactoryEntry AlgorithmRegistrarTest.AddPlayerFactoryToLastEntry AlgorithmRegistrarTest.AddTankAlgorithmFactoryToLastEntry AlgorithmRegistrarTest.ValidateLastRegistration_Complete AlgorithmRegistrarTest.ValidateLastRegistration_Incomplete_ThrowsException AlgorithmRegistrarTest.ValidateLastRegistration_NoEntry_ThrowsException AlgorithmRegistrarTest.AddFactoryToEmptyRegistrar_ThrowsException AlgorithmRegistrarTest.RemoveLast AlgorithmRegistrarTest.IteratorSupport GameManagerRegistrarTest.SingletonBehavior GameManagerRegistrarTest.CreateGameManagerEntry GameManagerRegistrarTest.CreateAndAddFactory GameManagerRegistrarTest.ValidationFailsWithoutFactory GameManagerRegistrarTest.ValidationFailsWithEmptyName GameManagerRegistrarTest.ExceptionContainsCorrectInfo GameManagerRegistrarTest.FindByName GameManagerRegistrarTest.CreateGameManagerInstance GameManagerRegistrarTest.CreateGameManagerInstanceWithoutVerbose GameManagerRegistrarTest.RemoveLastEntry GameManagerRegistrarTest.IteratorSupport GameManagerRegistrarTest.ClearRegistrar GameManagerRegistrarTest.GameManagerEntryHasFactory PlayerRegistrationTest.PlayerRegistration_AddsFactoryToRegistrar PlayerRegistrationTest.PlayerRegistration_NoEntry_ThrowsException PlayerRegistrationTest.RegisterPlayerMacro_CreatesRegistration TankAlgorithmRegistrationTest.TankAlgorithmRegistration_AddsFactoryToRegistrar TankAlgorithmRegistrationTest.TankAlgorithmRegistration_NoEntry_ThrowsException TankAlgorithmRegistrationTest.RegisterTankAlgorithmMacro_CreatesRegistration BoardInfoTestHelpersTest.CreateValidBoardInfo BoardInfoTestHelpersTest.CreateInvalidBoardInfo BoardInfoTestHelpersTest.CreateCustomBoardInfo RegistrarTestHelpersTest.ClearAllRegistrars RegistrarTestHelpersTest.SetupMockRegistrars RegistrarTestHelpersTest.SetupIncompleteAlgorithm RegistrarTestHelpersTest.SetupGameManagerRegistrar RegistrarTestHelpersTest.SetupCompleteAlgorithm RegistrarTestHelpersTest.RegistrarsStartEmpty RegistrationIntegrationTest.SuccessfulRegistration RegistrationIntegrationTest.FailedRegistration_IncompleteEntry RegistrationIntegrationTest.MultipleSuccessfulRegistrations RegistrationIntegrationTest.MixedRegistrations_SuccessAndFailure RegistrationIntegrationTest.RegistrationOrder_PlayerFirst RegistrationIntegrationTest.RegistrationOrder_TankAlgorithmFirst CommandLineParserTest.BasicMode_ValidArguments CommandLineParserTest.BasicMode_WithVerbose CommandLineParserTest.BasicMode_DifferentOrder CommandLineParserTest.BasicMode_NumThreads_ShouldFail CommandLineParserTest.BasicMode_MissingFlag CommandLineParserTest.BasicMode_MissingParameters CommandLineParserTest.BasicMode_UnsupportedParameter CommandLineParserTest.BasicMode_PositionalArgument_ShouldFail CommandLineParserTest.ComparativeMode_ValidArguments CommandLineParserTest.ComparativeMode_DifferentOrder CommandLineParserTest.ComparativeMode_MissingRequired CommandLineParserTest.CompetitionMode_ValidArguments CommandLineParserTest.CompetitionMode_MissingRequired CommandLineParserTest.CompetitionMode_MatchHistory CommandLineParserTest.CompetitionMode_MapCache CommandLineParserTest.CompetitionMode_SandboxWithLimits CommandLineParserTest.CompetitionMode_LimitsRequireSandbox CommandLineParserTest.CompetitionMode_InvalidLimit CommandLineParserTest.CompetitionMode_ReuseGameManagers CommandLineParserTest.BasicMode_ReuseGameManagersUnsupported CommandLineParserTest.BasicMode_SandboxUnsupported CommandLineParserTest.ComparativeMode_MatchHistoryUnsupported CommandLineParserTest.KeyValueParsing_NoSpacesAroundEquals CommandLineParserTest.KeyValueParsing_EmptyKey CommandLineParserTest.KeyValueParsing_EmptyValue CommandLineParserTest.KeyValueParsing_NoEquals CommandLineParserTest.NumThreads_ValidPositive CommandLineParserTest.NumThreads_Zero CommandLineParserTest.NumThreads_Negative CommandLineParserTest.NumThreads_InvalidNumber CommandLineParserTest.ModeConflict_BasicAndComparative CommandLineParserTest.ModeConflict_AllThreeFlags CommandLineParserTest.NoModeFlag_WithKeyValueParams CommandLineParserTest.VerboseFlag_SingleDashOnly CommandLineParserTest.VerboseFlag_DoubleDash_ShouldFail CommandLineParserTest.BasicModeAccessors_WrongMode CommandLineParserTest.ComparativeModeAccessors_WrongMode CommandLineParserTest.CompetitionModeAccessors_WrongMode CommandLineParserTest.GenerateUsage CommandLineParserTest.ResetFunctionality CommandLineParserTest.EmptyArguments CommandLineParserTest.OnlyModeFlag CommandLineParserTest.UnknownFlag ErrorCollectorTest.ConstructorInitializesEmpty ErrorCollectorTest.AddMapWarningsStoresErrors ErrorCollectorTest.AddMultipleMapWarnings ErrorCollectorTest.SaveToFileWithNoErrors ErrorCollectorTest.SaveToFileWithErrors ErrorCollectorTest.ClearRemovesAllErrors ErrorCollectorTest.FormatMapWarningWithSpecialCharacters ErrorCollectorTest.FormatMapWarningWithEmptyStrings ErrorCollectorTest.SaveToFilePreservesOrder ErrorCollectorTest.GetAllErrorsReturnsConstReference ErrorCollectorTest.AddMapErrorStoresError ErrorCollectorTest.AddMapWarningStoresWarning ErrorCollectorTest.MixedErrorsAndWarnings ErrorCollectorTest.ClearResetsCounters ErrorCollectorTest.ErrorCountWithMultipleWarnings ErrorCollectorTest.AddAllAppendsInOrder FileEnumeratorTest.EnumerateSoFiles_ValidDirectory FileEnumeratorTest.EnumerateSoFiles_NonexistentDirectory FileEnumeratorTest.EnumerateSoFiles_EmptyDirectory FileEnumeratorTest.EnumerateMapFiles_ValidDirectory FileEnumeratorTest.IsValidDirectory_ValidDirectory FileEnumeratorTest.IsValidDirectory_NonexistentDirectory FileEnumeratorTest.IsValidDirectory_EmptyPath FileEnumeratorTest.IsValidDirectory_FileAsDirectory FileEnumeratorTest.ErrorHandling_ThreadLocal FileEnumeratorTest.EnumerateFiles_DoesNotIncludeNestedDirectories FileLoaderTest.LoadBoardFile_NonexistentFile FileLoaderTest.LoadBoardFile_EmptyFile FileLoaderTest.LoadBoardFile_ValidFile FileLoaderTest.LoadBoardFile_InvalidRows FileLoaderTest.LoadBoardFile_MissingHeaderLine FileLoaderTest.LoadBoardFile_ExtraWhitespace FileLoaderTest.LoadBoardFile_OnlyHeaders FileLoaderTest.LoadBoardFile_TrailingWhitespace FileLoaderTest.LoadBoardFile_LeadingWhitespace FileLoaderTest.LoadBoardFile_NegativeMaxSteps FileLoaderTest.LoadBoardFile_NegativeNumShells FileLoaderTest.LoadBoardFile_NegativeCols FileLoaderTest.LoadBoardWithSatelliteView_ValidFile FileLoaderTest.LoadBoardWithSatelliteView_NonexistentFile FileLoaderTest.LoadBoardWithSatelliteView_EmptyFile FileLoaderTest.LoadBoardWithSatelliteView_ComplexBoard FileLoaderTest.BoardInfoValidation_ValidBoard FileLoaderTest.BoardInfoValidation_InvalidBoard FileLoaderTest.BoardInfoValidation_BoardWithWarnings FileLoaderTest.BoardInfoValidation_NullSatelliteView FileLoaderTest.LoadBoardWithSatelliteView_LastLineWithoutNewline FileLoaderTest.LoadBoardWithSatelliteView_RecoversRowsOnRead FileLoaderTest.Benchmark_MappedComparedToCopiedLoad FileSatelliteViewTest.BasicConstruction FileSatelliteViewTest.OutOfBoundsAccess FileSatelliteViewTest.EmptyBoard FileSatelliteViewTest.VariableLengthRows FileSatelliteViewTest.InvalidCharacterHandling FileSatelliteViewTest.AllValidCharacters FileSatelliteViewTest.OutOfBoundsCharacterHandling FileSatelliteViewTest.BoardDimensionsVsStringLength FileSatelliteViewTest.ValidationDefaultState FileSatelliteViewTest.ValidationEmptyBoard FileSatelliteViewTest.ValidationWithVariousBoards FileSatelliteViewTest.ValidationNoTanksError FileSatelliteViewTest.ValidationZeroDimensionsError FileSatelliteViewTest.ValidationShortRowsRecovery FileSatelliteViewTest.ValidationMissingRowsRecovery FileSatelliteViewTest.ValidationExtraRowsRecovery FileSatelliteViewTest.ValidationLongRowsRecovery FileSatelliteViewTest.ValidationMultipleInvalidCharacters FileSatelliteViewTest.RowAccess FileSatelliteViewTest.CompiledMapIsSharedAndRecovered GameManagerPoolTest.ReusableManagerIsResetAndReused GameManagerPoolTest.OtherManagersAreNotKept GameManagerPoolTest.ClearDestroysIdleManagers LibraryManagerTest.SingletonPattern LibraryManagerTest.LoadValidLibrary LibraryManagerTest.LoadNonExistentLibrary LibraryManagerTest.LoadEmptyPath LibraryManagerTest.LoadDuplicateLibrary LibraryManagerTest.LoadMultipleLibraries LibraryManagerTest.UnloadAllLibraries LibraryManagerTest.ErrorClearingBetweenOperations LibraryManagerTest.LoadInvalidSharedLibrary LibraryValidatorTest.LibraryInfo_DefaultConstructor LibraryValidatorTest.LibraryInfo_PathConstructor LibraryValidatorTest.LibraryInfo_PathConstructor_ComplexPath LibraryValidatorTest.LibraryInfo_PathConstructor_WindowsPath LibraryValidatorTest.LibraryInfo_PathConstructor_NoExtension LibraryValidatorTest.LibraryInfo_IsReady LibraryValidatorTest.IsValidLibraryFile_ValidFile LibraryValidatorTest.IsValidLibraryFile_NonexistentFile LibraryValidatorTest.IsValidLibraryFile_EmptyPath LibraryValidatorTest.IsValidLibraryFile_WrongExtension LibraryValidatorTest.IsValidLibraryFile_Directory LibraryValidatorTest.ValidateAlgorithm_InvalidFile LibraryValidatorTest.ValidateAlgorithm_WrongExtension LibraryValidatorTest.ValidateAlgorithm_ValidFileButInvalidLibrary LibraryValidatorTest.ValidateGameManager_InvalidFile LibraryValidatorTest.ValidateGameManager_ValidFileButInvalidLibrary LibraryValidatorTest.ErrorHandling_ThreadLocal LibraryValidatorTest.ErrorHandling_ClearOnSuccess LibraryValidatorTest.Cleanup_NoErrors LibraryValidatorTest.LibraryInfo_NameExtraction_EdgeCases MapCacheTest.StoredBoardLoadsBackWithWarnings MapCacheTest.ChangedMapIsNotLoaded MapCacheTest.MapChangedDuringParseIsNotStored MapCacheTest.DamagedCountsAreAMiss MapCacheTest.InvalidBoardIsNotStored MapCacheTest.Benchmark_ParseComparedToCacheHit MatchSchedulerTest.EstimateCost_GrowsWithBoardStepsAndTanks MatchSchedulerTest.Schedule_WithoutHistorySortsByCost MatchSchedulerTest.Schedule_UsesHistoryBeforeCost MatchSchedulerTest.LoadHistory_MissingFile MatchSchedulerTest.SaveReport_MergesWithHistory MatchSchedulerTest.SaveReport_KeepsNamesWithSpaces MatchSchedulerTest.SaveReport_SkipsNamesWithTabs MatchSchedulerTest.Benchmark_LongestFirstMakespan OutputGeneratorTest.GenerateTimestamp_BasicFormat OutputGeneratorTest.GenerateTimestamp_WithMilliseconds OutputGeneratorTest.GenerateTimestamp_Uniqueness OutputGeneratorTest.WriteToFile_Success OutputGeneratorTest.WriteToFile_NonexistentDirectory OutputGeneratorTest.WriteToFile_InvalidPath OutputGeneratorTest.FormatGameResult_Winner OutputGeneratorTest.FormatGameResult_Tie OutputGeneratorTest.FormatGameResult_ZeroShells OutputGeneratorTest.FormatGameState_SmallBoard OutputGeneratorTest.FormatGameState_LargerBoard OutputGeneratorTest.CreateOutputPath_BasicUsage OutputGeneratorTest.CreateOutputPath_WithDirectory OutputGeneratorTest.CreateOutputPath_WithMilliseconds OutputGeneratorTest.CreateOutputPath_EmptyDirectory OutputGeneratorTest.ErrorHandling_ThreadLocal OutputGeneratorTest.WriteToFile_ClearsPreviousError OutputGeneratorTest.EnsureDirectoryExists_DeepNesting OutputGeneratorTest.WriteToFile_FilePermissions ProcessSandboxTest.RunMatches_ReturnsResultsByIndex ProcessSandboxTest.RunMatches_ReusesWarmWorkers ProcessSandboxTest.RunMatches_CrashOnlyFailsItsMatch ProcessSandboxTest.RunMatches_ExceptionFailsMatch ProcessSandboxTest.RunMatches_CpuLimitStopsEndlessMatch ProcessSandboxTest.RunMatches_WallLimitStopsSleepingMatch ProcessSandboxTest.RunMatches_WallLimitStopsBlockedMatchUnderCpuLimit ProcessSandboxTest.RunMatches_MemoryLimitStopsMemoryBlowup ProcessSandboxTest.Benchmark_ComparedToInProcess ThreadPoolTest.ConstructorWithDefaultThreads ThreadPoolTest.ConstructorWithSpecificThreads ThreadPoolTest.SingleThreadedMode ThreadPoolTest.MultiThreadedMode ThreadPoolTest.ThreadCountNeverEquals2 ThreadPoolTest.ConstructorWithZeroThreads ThreadPoolTest.SimpleTaskExecution ThreadPoolTest.SingleThreadedExecution ThreadPoolTest.MultipleTaskExecution ThreadPoolTest.TaskWithParameters ThreadPoolTest.TasksExecuteInParallel ThreadPoolTest.WaitForAllTasks ThreadPoolTest.ExceptionHandling ThreadPoolTest.TaskQueueGrowth ThreadPoolTest.ThreadSafety ThreadPoolTest.ShutdownPreventsNewTasks ThreadPoolTest.DestructorWaitsForTasks ThreadPoolTest.LargeNumberOfTasks ThreadPoolTest.TaskReturnValues ThreadPoolTest.StressTest WorkStealingThreadPoolTest.ThreadCounts WorkStealingThreadPoolTest.SingleThreadedRunsOnCallerThread WorkStealingThreadPoolTest.TaskReturnValuesAndParameters WorkStealingThreadPoolTest.MoveOnlyArguments WorkStealingThreadPoolTest.ExceptionReachesFuture WorkStealingThreadPoolTest.WaitForAllSubmittedTasks WorkStealingThreadPoolTest.TasksSubmittedFromTasks WorkStealingThreadPoolTest.IdleWorkersStealQueuedTasks WorkStealingThreadPoolTest.ShutdownPreventsNewTasks WorkStealingThreadPoolTest.DestructorRunsQueuedTasks WorkStealingThreadPoolTest.Benchmark_ComparedToThreadPool WorkStealingThreadPoolTest.Benchmark_SubmitBarrierComparedToFutures)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_test_build/usercommon_tests[1]_tests.cmake")
+  include("/root/repo/_test_build/usercommon_tests[1]_tests.cmake")
+else()
+  add_test(usercommon_tests_NOT_BUILT usercommon_tests_NOT_BUILT)
+endif()
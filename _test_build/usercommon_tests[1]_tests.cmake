@@ -0,0 +1,437 @@
+add_test([=[BoardGeneratorTest.DefaultConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.CustomConfigConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.CustomConfigConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.CustomConfigConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.LoadConfig]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.LoadConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.LoadConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.LoadInvalidConfig]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.LoadInvalidConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.LoadInvalidConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.GenerateBasicBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.GenerateBasicBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.GenerateBasicBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.GenerateBoardWithSeed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.GenerateBoardWithSeed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.GenerateBoardWithSeed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.WallAndMineDensity]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.WallAndMineDensity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.WallAndMineDensity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.HorizontalSymmetry]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.HorizontalSymmetry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.HorizontalSymmetry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.VerticalSymmetry]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.VerticalSymmetry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.VerticalSymmetry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.DiagonalSymmetry]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.DiagonalSymmetry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.DiagonalSymmetry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.TankConnectivity]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.TankConnectivity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.TankConnectivity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.TanksNotTrapped]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.TanksNotTrapped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.TanksNotTrapped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BoardGeneratorTest.SaveToFile]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=BoardGeneratorTest.SaveToFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BoardGeneratorTest.SaveToFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompileMatchesInitialize]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompileMatchesInitialize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompileMatchesInitialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompileReadsEveryRow]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompileReadsEveryRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompileReadsEveryRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompileEmptyBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompileEmptyBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompileEmptyBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompileSingleCell]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompileSingleCell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompileSingleCell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompileZeroDimensions]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompileZeroDimensions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompileZeroDimensions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompiledMapOfSharesTheViewsMap]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompiledMapOfSharesTheViewsMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompiledMapOfSharesTheViewsMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.CompiledMapOfCompilesPlainViews]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.CompiledMapOfCompilesPlainViews]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.CompiledMapOfCompilesPlainViews]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompiledMapTest.Benchmark_StartManyGames]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=CompiledMapTest.DISABLED_Benchmark_StartManyGames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompiledMapTest.Benchmark_StartManyGames]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[CompiledMapTest.Benchmark_StartManyGames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Constructor_DefaultCreatesEmptyBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Constructor_DefaultCreatesEmptyBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Constructor_DefaultCreatesEmptyBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Constructor_ParameterizedCreatesCorrectSize]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Constructor_ParameterizedCreatesCorrectSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Constructor_ParameterizedCreatesCorrectSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_EmptyBoardLines]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_EmptyBoardLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_EmptyBoardLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_MissingTank1]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_MissingTank1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_MissingTank1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_MissingTank2]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_MissingTank2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_MissingTank2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_MultipleTanks]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_MultipleTanks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_MultipleTanks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_ValidBoardLines]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_ValidBoardLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_ValidBoardLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_IncompleteRows]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_IncompleteRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_IncompleteRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_IncompleteColumns]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_IncompleteColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_IncompleteColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_ExtraRows]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_ExtraRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_ExtraRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_ExtraColumns]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_ExtraColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_ExtraColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_UnrecognizedCharacters]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_UnrecognizedCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_UnrecognizedCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Initialize_NoTanksReturnsFalse]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.Initialize_NoTanksReturnsFalse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Initialize_NoTanksReturnsFalse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.GetCellType_ValidPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.GetCellType_ValidPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.GetCellType_ValidPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.GetCellType_WrappedPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.GetCellType_WrappedPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.GetCellType_WrappedPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.SetCellType_ValidPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.SetCellType_ValidPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.SetCellType_ValidPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.SetCellType_WrappedPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.SetCellType_WrappedPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.SetCellType_WrappedPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.IsWall_WallAndNonWall]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.IsWall_WallAndNonWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.IsWall_WallAndNonWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.DamageWall_WallDestructionAfterTwoHits]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.DamageWall_WallDestructionAfterTwoHits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.DamageWall_WallDestructionAfterTwoHits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.DamageWall_NonWall]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.DamageWall_NonWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.DamageWall_NonWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.GetWallHealth_WallAndNonWall]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.GetWallHealth_WallAndNonWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.GetWallHealth_WallAndNonWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.SetWallHealth_WallAndNonWall]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.SetWallHealth_WallAndNonWall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.SetWallHealth_WallAndNonWall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.GetRevision_ChangesOnlyWhenCellsChange]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.GetRevision_ChangesOnlyWhenCellsChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.GetRevision_ChangesOnlyWhenCellsChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.WrapPosition_InsideBounds]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.WrapPosition_InsideBounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.WrapPosition_InsideBounds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.WrapPosition_OutsideBoundsPositive]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.WrapPosition_OutsideBoundsPositive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.WrapPosition_OutsideBoundsPositive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.WrapPosition_OutsideBoundsNegative]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.WrapPosition_OutsideBoundsNegative]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.WrapPosition_OutsideBoundsNegative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.CanMoveTo_EmptySpace]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.CanMoveTo_EmptySpace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.CanMoveTo_EmptySpace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.CanMoveTo_Mine]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.CanMoveTo_Mine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.CanMoveTo_Mine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.CanMoveTo_Wall]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.CanMoveTo_Wall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.CanMoveTo_Wall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.CanMoveTo_Tank]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.CanMoveTo_Tank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.CanMoveTo_Tank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.ToString_EmptyBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.ToString_EmptyBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.ToString_EmptyBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.ToString_PopulatedBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.ToString_PopulatedBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.ToString_PopulatedBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.WrapPosition_FarOutside]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.WrapPosition_FarOutside]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.WrapPosition_FarOutside]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.GetCellTypeUnchecked_MatchesGetCellType]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.GetCellTypeUnchecked_MatchesGetCellType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.GetCellTypeUnchecked_MatchesGetCellType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.RayFrom_MatchesWrapPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.RayFrom_MatchesWrapPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.RayFrom_MatchesWrapPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.ZeroDimensionBoard_DoesNotCrash]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.ZeroDimensionBoard_DoesNotCrash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.ZeroDimensionBoard_DoesNotCrash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.StepDistance_NoWrapping_StraightAndDiagonal]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.StepDistance_NoWrapping_StraightAndDiagonal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.StepDistance_NoWrapping_StraightAndDiagonal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.StepDistance_Wrapping_XAxis]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.StepDistance_Wrapping_XAxis]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.StepDistance_Wrapping_XAxis]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.StepDistance_Wrapping_YAxis]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.StepDistance_Wrapping_YAxis]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.StepDistance_Wrapping_YAxis]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.StepDistance_Wrapping_BothAxes]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.StepDistance_Wrapping_BothAxes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.StepDistance_Wrapping_BothAxes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.StepDistance_EdgeCases]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.StepDistance_EdgeCases]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.StepDistance_EdgeCases]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Benchmark_CellAccessThroughput]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.DISABLED_Benchmark_CellAccessThroughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Benchmark_CellAccessThroughput]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[GameBoardTest.Benchmark_CellAccessThroughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameBoardTest.Benchmark_WrapFastPath]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameBoardTest.DISABLED_Benchmark_WrapFastPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameBoardTest.Benchmark_WrapFastPath]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[GameBoardTest.Benchmark_WrapFastPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.Constructor_InitializesCorrectly]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.Constructor_InitializesCorrectly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.Constructor_InitializesCorrectly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.SetPosition_ChangesPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.SetPosition_ChangesPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.SetPosition_ChangesPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.SetDirection_ChangesDirection]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.SetDirection_ChangesDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.SetDirection_ChangesDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.Destroy_MarksAsDestroyed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.Destroy_MarksAsDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.Destroy_MarksAsDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.UpdatePreviousPosition_ExplicitUpdate]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.UpdatePreviousPosition_ExplicitUpdate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.UpdatePreviousPosition_ExplicitUpdate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.MultiplePositionChanges_TracksPreviousPositions]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.MultiplePositionChanges_TracksPreviousPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.MultiplePositionChanges_TracksPreviousPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.MultiplePlayerIds_DifferentObjects]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.MultiplePlayerIds_DifferentObjects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.MultiplePlayerIds_DifferentObjects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[GameObjectTest.DestroyedObject_StateIsPreserved]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=GameObjectTest.DestroyedObject_StateIsPreserved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[GameObjectTest.DestroyedObject_StateIsPreserved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.Constructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.Constructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.Constructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.DifferentPlayers]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.DifferentPlayers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.DifferentPlayers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.DifferentPositions]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.DifferentPositions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.DifferentPositions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.DifferentDirections]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.DifferentDirections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.DifferentDirections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.InitialDestructionState]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.InitialDestructionState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.InitialDestructionState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.SetPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.SetPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.SetPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.Destroy]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.Destroy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.Destroy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.GetNextPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.GetNextPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.GetNextPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.PreviousPosition_InitiallyMatchesPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.PreviousPosition_InitiallyMatchesPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.PreviousPosition_InitiallyMatchesPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.PreviousPosition_UpdatedWhenPositionChanges]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.PreviousPosition_UpdatedWhenPositionChanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.PreviousPosition_UpdatedWhenPositionChanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShellTest.UpdatePreviousPosition_ExplicitUpdate]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ShellTest.UpdatePreviousPosition_ExplicitUpdate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShellTest.UpdatePreviousPosition_ExplicitUpdate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Constructor_InitializesCorrectly]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Constructor_InitializesCorrectly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Constructor_InitializesCorrectly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.SetPosition_ChangesPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.SetPosition_ChangesPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.SetPosition_ChangesPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.SetDirection_ChangesDirection]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.SetDirection_ChangesDirection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.SetDirection_ChangesDirection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.DecrementShells_ReducesShellCount]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.DecrementShells_ReducesShellCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.DecrementShells_ReducesShellCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.DecrementShells_StopsAtZero]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.DecrementShells_StopsAtZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.DecrementShells_StopsAtZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Destroy_MarksTankAsDestroyed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Destroy_MarksTankAsDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Destroy_MarksTankAsDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveForward_UpdatesPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveForward_UpdatesPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveForward_UpdatesPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateLeft_EighthTurn]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateLeft_EighthTurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateLeft_EighthTurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateLeft_QuarterTurn]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateLeft_QuarterTurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateLeft_QuarterTurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateRight_EighthTurn]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateRight_EighthTurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateRight_EighthTurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateRight_QuarterTurn]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateRight_QuarterTurn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateRight_QuarterTurn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.GetNextForwardPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.GetNextForwardPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.GetNextForwardPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.GetNextBackwardPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.GetNextBackwardPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.GetNextBackwardPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.CanShoot_InitiallyTrue]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.CanShoot_InitiallyTrue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.CanShoot_InitiallyTrue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.CanShoot_FalseWhenDestroyed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.CanShoot_FalseWhenDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.CanShoot_FalseWhenDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.CanShoot_FalseWhenNoShells]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.CanShoot_FalseWhenNoShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.CanShoot_FalseWhenNoShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Shoot_SuccessfulShot]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Shoot_SuccessfulShot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Shoot_SuccessfulShot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Shoot_FailsOnCooldown]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Shoot_FailsOnCooldown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Shoot_FailsOnCooldown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.UpdateCooldowns_DecrementsCooldown]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.UpdateCooldowns_DecrementsCooldown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.UpdateCooldowns_DecrementsCooldown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Shoot_FailsWhenNoShells]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Shoot_FailsWhenNoShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Shoot_FailsWhenNoShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Shoot_FailsWhenDestroyed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Shoot_FailsWhenDestroyed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Shoot_FailsWhenDestroyed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveBackward_InitiatesBackwardMoveWithDelay]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveBackward_InitiatesBackwardMoveWithDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveBackward_InitiatesBackwardMoveWithDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveBackward_ContinuousMovesTakeOneStep]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveBackward_ContinuousMovesTakeOneStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveBackward_ContinuousMovesTakeOneStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveForward_CancelsPendingBackwardMove]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveForward_CancelsPendingBackwardMove]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveForward_CancelsPendingBackwardMove]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateRight_IgnoredDuringBackwardDelay]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateRight_IgnoredDuringBackwardDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateRight_IgnoredDuringBackwardDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.RotateLeft_IgnoredDuringBackwardDelay]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.RotateLeft_IgnoredDuringBackwardDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.RotateLeft_IgnoredDuringBackwardDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.Shoot_IgnoredDuringBackwardDelay]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.Shoot_IgnoredDuringBackwardDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.Shoot_IgnoredDuringBackwardDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.ContinuousBackward_ResetByOtherActions]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.ContinuousBackward_ResetByOtherActions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.ContinuousBackward_ResetByOtherActions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.ResetBackwardMovement_ResetsAllBackwardState]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.ResetBackwardMovement_ResetsAllBackwardState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.ResetBackwardMovement_ResetsAllBackwardState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.PreviousPosition_InitiallyMatchesPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.PreviousPosition_InitiallyMatchesPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.PreviousPosition_InitiallyMatchesPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.PreviousPosition_UpdatedWhenPositionChanges]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.PreviousPosition_UpdatedWhenPositionChanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.PreviousPosition_UpdatedWhenPositionChanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveForward_UpdatesPreviousPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveForward_UpdatesPreviousPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveForward_UpdatesPreviousPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.MoveBackward_UpdatesPreviousPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.MoveBackward_UpdatesPreviousPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.MoveBackward_UpdatesPreviousPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.UpdatePreviousPosition_ExplicitUpdate]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.UpdatePreviousPosition_ExplicitUpdate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.UpdatePreviousPosition_ExplicitUpdate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.DoNothing_SavesPreviousPosition]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.DoNothing_SavesPreviousPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.DoNothing_SavesPreviousPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.DoNothing_ProcessesBackwardMovement]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.DoNothing_ProcessesBackwardMovement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.DoNothing_ProcessesBackwardMovement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TankTest.InitialShellsArePerTank]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TankTest.InitialShellsArePerTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TankTest.InitialShellsArePerTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.Varint_RoundTrip]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.Varint_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.Varint_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.Varint_SmallValuesUseOneByte]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.Varint_SmallValuesUseOneByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.Varint_SmallValuesUseOneByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.SignedVarint_RoundTrip]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.SignedVarint_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.SignedVarint_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.String_RoundTrip]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.String_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.String_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.Cursor_FailsOnTruncatedData]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.Cursor_FailsOnTruncatedData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.Cursor_FailsOnTruncatedData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.WrapCoordinate_WrapsBothWays]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.WrapCoordinate_WrapsBothWays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.WrapCoordinate_WrapsBothWays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayFormatTest.WrappedDelta_TakesShortestWay]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayFormatTest.WrappedDelta_TakesShortestWay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayFormatTest.WrappedDelta_TakesShortestWay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.RoundTrip_EveryStepMatchesRandomGames]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.RoundTrip_EveryStepMatchesRandomGames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.RoundTrip_EveryStepMatchesRandomGames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.Header_RoundTrip]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.Header_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.Header_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.SeekStep_BackwardAndForward]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.SeekStep_BackwardAndForward]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.SeekStep_BackwardAndForward]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.UnfinishedReplay_HasStepsButNoResult]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.UnfinishedReplay_HasStepsButNoResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.UnfinishedReplay_HasStepsButNoResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.LoadFromData_RejectsBadMagic]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.LoadFromData_RejectsBadMagic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.LoadFromData_RejectsBadMagic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.LoadFromData_RejectsTruncatedData]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.LoadFromData_RejectsTruncatedData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.LoadFromData_RejectsTruncatedData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.LoadFromData_RejectsHugeBoardSize]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.LoadFromData_RejectsHugeBoardSize]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.LoadFromData_RejectsHugeBoardSize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.LoadFromFile_RoundTrip]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.LoadFromFile_RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.LoadFromFile_RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.FormatActionLog_MatchesGameLog]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.FormatActionLog_MatchesGameLog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.FormatActionLog_MatchesGameLog]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.Size_QuietStepsCostAboutTwoBytesPerTank]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.Size_QuietStepsCostAboutTwoBytesPerTank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.Size_QuietStepsCostAboutTwoBytesPerTank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReplayReaderTest.Benchmark_RecordAndReadLongGame]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=ReplayReaderTest.DISABLED_Benchmark_RecordAndReadLongGame]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReplayReaderTest.Benchmark_RecordAndReadLongGame]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[ReplayReaderTest.Benchmark_RecordAndReadLongGame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowAccessSatelliteViewTest.CopyRowMatchesGetObjectAt]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=RowAccessSatelliteViewTest.CopyRowMatchesGetObjectAt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowAccessSatelliteViewTest.CopyRowMatchesGetObjectAt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowAccessSatelliteViewTest.CopyRowFallsBackForPlainViews]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=RowAccessSatelliteViewTest.CopyRowFallsBackForPlainViews]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowAccessSatelliteViewTest.CopyRowFallsBackForPlainViews]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowAccessSatelliteViewTest.CopyRowOutsideViewReturnsOutOfBounds]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=RowAccessSatelliteViewTest.CopyRowOutsideViewReturnsOutOfBounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowAccessSatelliteViewTest.CopyRowOutsideViewReturnsOutOfBounds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RowAccessSatelliteViewTest.Benchmark_ReadWholeView]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=RowAccessSatelliteViewTest.DISABLED_Benchmark_ReadWholeView]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RowAccessSatelliteViewTest.Benchmark_ReadWholeView]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[RowAccessSatelliteViewTest.Benchmark_ReadWholeView]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.BasicBoardView]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.BasicBoardView]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.BasicBoardView]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.OutOfRangeCoordinates]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.OutOfRangeCoordinates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.OutOfRangeCoordinates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.ShellOverMineReturnsShell]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.ShellOverMineReturnsShell]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.ShellOverMineReturnsShell]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.IgnoresDestroyedTanksAndShells]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.IgnoresDestroyedTanksAndShells]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.IgnoresDestroyedTanksAndShells]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.DestroyedShellOverMineReturnsMine]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.DestroyedShellOverMineReturnsMine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.DestroyedShellOverMineReturnsMine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.ViewsShareOneRendering]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.ViewsShareOneRendering]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.ViewsShareOneRendering]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SatelliteViewImplTest.Benchmark_ManyTanksOneStep]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=SatelliteViewImplTest.DISABLED_Benchmark_ManyTanksOneStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SatelliteViewImplTest.Benchmark_ManyTanksOneStep]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[SatelliteViewImplTest.Benchmark_ManyTanksOneStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.DirectionToString]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.DirectionToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.DirectionToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.RotateLeftEighth]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.RotateLeftEighth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.RotateLeftEighth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.RotateLeftQuarter]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.RotateLeftQuarter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.RotateLeftQuarter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.RotateRightEighth]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.RotateRightEighth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.RotateRightEighth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.RotateRightQuarter]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.RotateRightQuarter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.RotateRightQuarter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.GetDirectionDeltaDefault]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.GetDirectionDeltaDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.GetDirectionDeltaDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.GetDirectionDeltaCustomMagnitude]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.GetDirectionDeltaCustomMagnitude]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.GetDirectionDeltaCustomMagnitude]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.FullRotationSequence]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.FullRotationSequence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.FullRotationSequence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.OppositeDirections]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.OppositeDirections]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.OppositeDirections]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.StreamInsertionOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.StreamInsertionOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.StreamInsertionOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.GetDirectionToPoint_AdjacentPoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.GetDirectionToPoint_AdjacentPoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.GetDirectionToPoint_AdjacentPoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.GetDirectionToPoint_SamePoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.GetDirectionToPoint_SamePoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.GetDirectionToPoint_SamePoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.GetDirectionToPoint_NonAdjacentPoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.GetDirectionToPoint_NonAdjacentPoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.GetDirectionToPoint_NonAdjacentPoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.EvaluatedAtCompileTime]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.EvaluatedAtCompileTime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.EvaluatedAtCompileTime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectionTest.TablesMatchDirectionDelta]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=DirectionTest.TablesMatchDirectionDelta]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectionTest.TablesMatchDirectionDelta]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.DefaultConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.ParameterizedConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.ParameterizedConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.ParameterizedConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.PointConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.PointConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.PointConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_HorizontalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_HorizontalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_HorizontalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_VerticalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_VerticalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_VerticalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_DiagonalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_DiagonalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_DiagonalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_SamePoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_SamePoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_SamePoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_SameMidpoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_SameMidpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_SameMidpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_SameMidpointSwitched]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_SameMidpointSwitched]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_SameMidpointSwitched]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_DifferentMidpoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_DifferentMidpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_DifferentMidpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.EqualityOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.EqualityOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.EqualityOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.InequalityOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.InequalityOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.InequalityOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.ToString]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.StreamOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.StreamOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.StreamOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWraparound]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWraparound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWraparound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWraparound]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWraparound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWraparound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_WraparoundReversed]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_WraparoundReversed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_WraparoundReversed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_WithBoardDimensions_SameMidpoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_WithBoardDimensions_SameMidpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_WithBoardDimensions_SameMidpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_WithBoardDimensions_DifferentMidpoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_WithBoardDimensions_DifferentMidpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_WithBoardDimensions_DifferentMidpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_SamePoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_SamePoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_SamePoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacentPoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacentPoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacentPoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalAdjacent]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalAdjacent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalAdjacent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalSameY]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalSameY]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalSameY]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalSameX]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalSameX]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalSameX]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapLeftToRight]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapLeftToRight]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapLeftToRight]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapRightToLeft]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapRightToLeft]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapRightToLeft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapTopToBottom]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapTopToBottom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapTopToBottom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapBottomToTop]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapBottomToTop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapBottomToTop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalWrap]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalWrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalWrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_SmallBoard]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.CalculateMidpoint_WithBoardDimensions_SmallBoard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.CalculateMidpoint_WithBoardDimensions_SmallBoard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_WithBoardDimensions_DiagonalWraparoundMatch]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_WithBoardDimensions_DiagonalWraparoundMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_WithBoardDimensions_DiagonalWraparoundMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_WithBoardDimensions_AdjacentDifferentAxes]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_WithBoardDimensions_AdjacentDifferentAxes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_WithBoardDimensions_AdjacentDifferentAxes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MidPointTest.MidpointsMatch_WithBoardDimensions_InvalidMidpoints]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=MidPointTest.MidpointsMatch_WithBoardDimensions_InvalidMidpoints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MidPointTest.MidpointsMatch_WithBoardDimensions_InvalidMidpoints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.DefaultConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.ParameterizedConstructor]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.ParameterizedConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.ParameterizedConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.EqualityOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.EqualityOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.EqualityOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.InequalityOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.InequalityOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.InequalityOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.AdditionOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.AdditionOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.AdditionOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.SubtractionOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.SubtractionOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.SubtractionOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.LessThanOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.LessThanOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.LessThanOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.ToString]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.StreamInsertionOperator]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.StreamInsertionOperator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.StreamInsertionOperator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.EuclideanDistance]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.EuclideanDistance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.EuclideanDistance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.EuclideanDistanceFloatingPoint]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.EuclideanDistanceFloatingPoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.EuclideanDistanceFloatingPoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PointTest.ZeroDifference]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=PointTest.ZeroDifference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PointTest.ZeroDifference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TorusRayTest.WrapAxis]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TorusRayTest.WrapAxis]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TorusRayTest.WrapAxis]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TorusRayTest.WalksAcrossEdges]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TorusRayTest.WalksAcrossEdges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TorusRayTest.WalksAcrossEdges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TorusRayTest.ReturnsToStartAfterFullLoop]=]  /root/repo/build/tests/usercommon_tests [==[--gtest_filter=TorusRayTest.ReturnsToStartAfterFullLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TorusRayTest.ReturnsToStartAfterFullLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_test_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  usercommon_tests_TESTS BoardGeneratorTest.DefaultConstructor BoardGeneratorTest.CustomConfigConstructor BoardGeneratorTest.LoadConfig BoardGeneratorTest.LoadInvalidConfig BoardGeneratorTest.GenerateBasicBoard BoardGeneratorTest.GenerateBoardWithSeed BoardGeneratorTest.WallAndMineDensity BoardGeneratorTest.HorizontalSymmetry BoardGeneratorTest.VerticalSymmetry BoardGeneratorTest.DiagonalSymmetry BoardGeneratorTest.TankConnectivity BoardGeneratorTest.TanksNotTrapped BoardGeneratorTest.SaveToFile CompiledMapTest.CompileMatchesInitialize CompiledMapTest.CompileReadsEveryRow CompiledMapTest.CompileEmptyBoard CompiledMapTest.CompileSingleCell CompiledMapTest.CompileZeroDimensions CompiledMapTest.CompiledMapOfSharesTheViewsMap CompiledMapTest.CompiledMapOfCompilesPlainViews CompiledMapTest.Benchmark_StartManyGames GameBoardTest.Constructor_DefaultCreatesEmptyBoard GameBoardTest.Constructor_ParameterizedCreatesCorrectSize GameBoardTest.Initialize_EmptyBoardLines GameBoardTest.Initialize_MissingTank1 GameBoardTest.Initialize_MissingTank2 GameBoardTest.Initialize_MultipleTanks GameBoardTest.Initialize_ValidBoardLines GameBoardTest.Initialize_IncompleteRows GameBoardTest.Initialize_IncompleteColumns GameBoardTest.Initialize_ExtraRows GameBoardTest.Initialize_ExtraColumns GameBoardTest.Initialize_UnrecognizedCharacters GameBoardTest.Initialize_NoTanksReturnsFalse GameBoardTest.GetCellType_ValidPosition GameBoardTest.GetCellType_WrappedPosition GameBoardTest.SetCellType_ValidPosition GameBoardTest.SetCellType_WrappedPosition GameBoardTest.IsWall_WallAndNonWall GameBoardTest.DamageWall_WallDestructionAfterTwoHits GameBoardTest.DamageWall_NonWall GameBoardTest.GetWallHealth_WallAndNonWall GameBoardTest.SetWallHealth_WallAndNonWall GameBoardTest.GetRevision_ChangesOnlyWhenCellsChange GameBoardTest.WrapPosition_InsideBounds GameBoardTest.WrapPosition_OutsideBoundsPositive GameBoardTest.WrapPosition_OutsideBoundsNegative GameBoardTest.CanMoveTo_EmptySpace GameBoardTest.CanMoveTo_Mine GameBoardTest.CanMoveTo_Wall GameBoardTest.CanMoveTo_Tank GameBoardTest.ToString_EmptyBoard GameBoardTest.ToString_PopulatedBoard GameBoardTest.WrapPosition_FarOutside GameBoardTest.GetCellTypeUnchecked_MatchesGetCellType GameBoardTest.RayFrom_MatchesWrapPosition GameBoardTest.ZeroDimensionBoard_DoesNotCrash GameBoardTest.StepDistance_NoWrapping_StraightAndDiagonal GameBoardTest.StepDistance_Wrapping_XAxis GameBoardTest.StepDistance_Wrapping_YAxis GameBoardTest.StepDistance_Wrapping_BothAxes GameBoardTest.StepDistance_EdgeCases GameBoardTest.Benchmark_CellAccessThroughput GameBoardTest.Benchmark_WrapFastPath GameObjectTest.Constructor_InitializesCorrectly GameObjectTest.SetPosition_ChangesPosition GameObjectTest.SetDirection_ChangesDirection GameObjectTest.Destroy_MarksAsDestroyed GameObjectTest.UpdatePreviousPosition_ExplicitUpdate GameObjectTest.MultiplePositionChanges_TracksPreviousPositions GameObjectTest.MultiplePlayerIds_DifferentObjects GameObjectTest.DestroyedObject_StateIsPreserved ShellTest.Constructor ShellTest.DifferentPlayers ShellTest.DifferentPositions ShellTest.DifferentDirections ShellTest.InitialDestructionState ShellTest.SetPosition ShellTest.Destroy ShellTest.GetNextPosition ShellTest.PreviousPosition_InitiallyMatchesPosition ShellTest.PreviousPosition_UpdatedWhenPositionChanges ShellTest.UpdatePreviousPosition_ExplicitUpdate TankTest.Constructor_InitializesCorrectly TankTest.SetPosition_ChangesPosition TankTest.SetDirection_ChangesDirection TankTest.DecrementShells_ReducesShellCount TankTest.DecrementShells_StopsAtZero TankTest.Destroy_MarksTankAsDestroyed TankTest.MoveForward_UpdatesPosition TankTest.RotateLeft_EighthTurn TankTest.RotateLeft_QuarterTurn TankTest.RotateRight_EighthTurn TankTest.RotateRight_QuarterTurn TankTest.GetNextForwardPosition TankTest.GetNextBackwardPosition TankTest.CanShoot_InitiallyTrue TankTest.CanShoot_FalseWhenDestroyed TankTest.CanShoot_FalseWhenNoShells TankTest.Shoot_SuccessfulShot TankTest.Shoot_FailsOnCooldown TankTest.UpdateCooldowns_DecrementsCooldown TankTest.Shoot_FailsWhenNoShells TankTest.Shoot_FailsWhenDestroyed TankTest.MoveBackward_InitiatesBackwardMoveWithDelay TankTest.MoveBackward_ContinuousMovesTakeOneStep TankTest.MoveForward_CancelsPendingBackwardMove TankTest.RotateRight_IgnoredDuringBackwardDelay TankTest.RotateLeft_IgnoredDuringBackwardDelay TankTest.Shoot_IgnoredDuringBackwardDelay TankTest.ContinuousBackward_ResetByOtherActions TankTest.ResetBackwardMovement_ResetsAllBackwardState TankTest.PreviousPosition_InitiallyMatchesPosition TankTest.PreviousPosition_UpdatedWhenPositionChanges TankTest.MoveForward_UpdatesPreviousPosition TankTest.MoveBackward_UpdatesPreviousPosition TankTest.UpdatePreviousPosition_ExplicitUpdate TankTest.DoNothing_SavesPreviousPosition TankTest.DoNothing_ProcessesBackwardMovement TankTest.InitialShellsArePerTank ReplayFormatTest.Varint_RoundTrip ReplayFormatTest.Varint_SmallValuesUseOneByte ReplayFormatTest.SignedVarint_RoundTrip ReplayFormatTest.String_RoundTrip ReplayFormatTest.Cursor_FailsOnTruncatedData ReplayFormatTest.WrapCoordinate_WrapsBothWays ReplayFormatTest.WrappedDelta_TakesShortestWay ReplayReaderTest.RoundTrip_EveryStepMatchesRandomGames ReplayReaderTest.Header_RoundTrip ReplayReaderTest.SeekStep_BackwardAndForward ReplayReaderTest.UnfinishedReplay_HasStepsButNoResult ReplayReaderTest.LoadFromData_RejectsBadMagic ReplayReaderTest.LoadFromData_RejectsTruncatedData ReplayReaderTest.LoadFromData_RejectsHugeBoardSize ReplayReaderTest.LoadFromFile_RoundTrip ReplayReaderTest.FormatActionLog_MatchesGameLog ReplayReaderTest.Size_QuietStepsCostAboutTwoBytesPerTank ReplayReaderTest.Benchmark_RecordAndReadLongGame RowAccessSatelliteViewTest.CopyRowMatchesGetObjectAt RowAccessSatelliteViewTest.CopyRowFallsBackForPlainViews RowAccessSatelliteViewTest.CopyRowOutsideViewReturnsOutOfBounds RowAccessSatelliteViewTest.Benchmark_ReadWholeView SatelliteViewImplTest.BasicBoardView SatelliteViewImplTest.OutOfRangeCoordinates SatelliteViewImplTest.ShellOverMineReturnsShell SatelliteViewImplTest.IgnoresDestroyedTanksAndShells SatelliteViewImplTest.DestroyedShellOverMineReturnsMine SatelliteViewImplTest.ViewsShareOneRendering SatelliteViewImplTest.Benchmark_ManyTanksOneStep DirectionTest.DirectionToString DirectionTest.RotateLeftEighth DirectionTest.RotateLeftQuarter DirectionTest.RotateRightEighth DirectionTest.RotateRightQuarter DirectionTest.GetDirectionDeltaDefault DirectionTest.GetDirectionDeltaCustomMagnitude DirectionTest.FullRotationSequence DirectionTest.OppositeDirections DirectionTest.StreamInsertionOperator DirectionTest.GetDirectionToPoint_AdjacentPoints DirectionTest.GetDirectionToPoint_SamePoint DirectionTest.GetDirectionToPoint_NonAdjacentPoints DirectionTest.EvaluatedAtCompileTime DirectionTest.TablesMatchDirectionDelta MidPointTest.DefaultConstructor MidPointTest.ParameterizedConstructor MidPointTest.PointConstructor MidPointTest.CalculateMidpoint_HorizontalAdjacent MidPointTest.CalculateMidpoint_VerticalAdjacent MidPointTest.CalculateMidpoint_DiagonalAdjacent MidPointTest.CalculateMidpoint_SamePoint MidPointTest.MidpointsMatch_SameMidpoint MidPointTest.MidpointsMatch_SameMidpointSwitched MidPointTest.MidpointsMatch_DifferentMidpoints MidPointTest.EqualityOperator MidPointTest.InequalityOperator MidPointTest.ToString MidPointTest.StreamOperator MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalAdjacent MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalAdjacent MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWraparound MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWraparound MidPointTest.CalculateMidpoint_WithBoardDimensions_WraparoundReversed MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacent MidPointTest.MidpointsMatch_WithBoardDimensions_SameMidpoint MidPointTest.MidpointsMatch_WithBoardDimensions_DifferentMidpoints MidPointTest.CalculateMidpoint_WithBoardDimensions_SamePoint MidPointTest.CalculateMidpoint_WithBoardDimensions_NonAdjacentPoints MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalAdjacent MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalSameY MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalSameX MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapLeftToRight MidPointTest.CalculateMidpoint_WithBoardDimensions_HorizontalWrapRightToLeft MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapTopToBottom MidPointTest.CalculateMidpoint_WithBoardDimensions_VerticalWrapBottomToTop MidPointTest.CalculateMidpoint_WithBoardDimensions_DiagonalWrap MidPointTest.CalculateMidpoint_WithBoardDimensions_SmallBoard MidPointTest.MidpointsMatch_WithBoardDimensions_DiagonalWraparoundMatch MidPointTest.MidpointsMatch_WithBoardDimensions_AdjacentDifferentAxes MidPointTest.MidpointsMatch_WithBoardDimensions_InvalidMidpoints PointTest.DefaultConstructor PointTest.ParameterizedConstructor PointTest.EqualityOperator PointTest.InequalityOperator PointTest.AdditionOperator PointTest.SubtractionOperator PointTest.LessThanOperator PointTest.ToString PointTest.StreamInsertionOperator PointTest.EuclideanDistance PointTest.EuclideanDistanceFloatingPoint PointTest.ZeroDifference TorusRayTest.WrapAxis TorusRayTest.WalksAcrossEdges TorusRayTest.ReturnsToStartAfterFullLoop)